@@ -15,6 +15,7 @@
 
 #include <math.h>  // log10
 
+#include <algorithm>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
@@ -24,6 +25,7 @@
 #include "Events/ProgressToClinicalEvent.h"
 #include "IndividualsFileReporter.h"
 #include "MDC/ModelDataCollector.h"
+#include "ParameterSweep.h"
 #include "Simulation/Model.h"
 #include "PkPdReporter.h"
 #include "Population/ImmuneSystem/ImmuneSystem.h"
@@ -44,6 +46,7 @@ using namespace std;
 bool validate_config_for_ee(utils::Cli::DxGAppInput & input);
 double getEfficacyForTherapy(std::string g_str, Model* p_model,utils::Cli::DxGAppInput& input, int therapy_id);
 double getEfficacyForTherapyCRT(Model* p_model,utils::Cli::DxGAppInput& input, int therapy_id);
+void resetModelState(Model* p_model);
 
 // efficacy_map efficacies;
 
@@ -62,6 +65,10 @@ int main(int argc, char** argv) {
 
     auto p_model = Model::get_instance();
     auto input = utils::Cli::get_instance().get_dxg_app_input();
+    // Cells are seeded from their index so the table does not depend on the number of workers,
+    // serial runs included
+    const auto base_seed = p_model->get_random()->get_seed();
+    const ParameterSweep sweep(input.jobs);
 
     if (input.as_iiv != -1) {
         for (auto& sd : p_model->get_drug_db()->at(0)->age_group_specific_drug_concentration_sd()) {
@@ -89,6 +96,13 @@ int main(int argc, char** argv) {
         }
     }
 
+    std::vector<int> therapy_ids = input.therapy_list;
+    if (therapy_ids.empty()) {
+        for (auto therapy_id = min_therapy_id; therapy_id <= max_therapy_id; therapy_id++) {
+            therapy_ids.push_back(therapy_id);
+        }
+    }
+
     // TODO: Genotype should be imported  from input files
 
     if(input.is_crt_calibration){
@@ -108,17 +122,19 @@ int main(int argc, char** argv) {
             }
         }
         std::cout << std::endl;
-        if(input.therapy_list.empty()){
-            for (auto therapy_id = min_therapy_id; therapy_id <= max_therapy_id; therapy_id++) {
-              double efficacy = getEfficacyForTherapyCRT(p_model, input, therapy_id);
-              ss << efficacy << (therapy_id == max_therapy_id ? "" : "\t");
-            }
-        }
-        else{
-            for (int t_index = 0; t_index < input.therapy_list.size(); t_index++) {
-              double efficacy = getEfficacyForTherapyCRT(p_model, input, input.therapy_list[t_index]);
-              ss << efficacy << (input.therapy_list[t_index] == input.therapy_list.size() - 1 ? "" : "\t");
-            }
+        const auto efficacies = sweep.run(therapy_ids.size(), [&](std::size_t cell) {
+            p_model->get_random()->set_seed(base_seed + cell);
+            resetModelState(p_model);
+            // Only the last cell writes the PkPd output
+            auto cell_input = input;
+            if (cell + 1 != therapy_ids.size()) { cell_input.output_file.clear(); }
+            const auto efficacy = getEfficacyForTherapyCRT(p_model, cell_input, therapy_ids[cell]);
+            // Close the PkPd output before a worker exits
+            p_model->get_reporters().clear();
+            return efficacy;
+        });
+        for (std::size_t t_index = 0; t_index < efficacies.size(); t_index++) {
+            ss << efficacies[t_index] << (t_index + 1 == efficacies.size() ? "" : "\t");
         }
         std::cout << ss.str() << std::endl;
     }
@@ -223,6 +239,20 @@ int main(int argc, char** argv) {
             }
         }
         std::cout << std::endl;
+        // Evaluate the genotype x therapy grid up front, in this process or shared between workers
+        const auto number_of_cells = input.genotypes.size() * therapy_ids.size();
+        const auto efficacies = sweep.run(number_of_cells, [&](std::size_t cell) {
+            p_model->get_random()->set_seed(base_seed + cell);
+            resetModelState(p_model);
+            // Only the last cell writes the PkPd output
+            auto cell_input = input;
+            if (cell + 1 != number_of_cells) { cell_input.output_file.clear(); }
+            const auto efficacy = getEfficacyForTherapy(input.genotypes[cell / therapy_ids.size()], p_model,
+                                                        cell_input, therapy_ids[cell % therapy_ids.size()]);
+            // Close the PkPd output before a worker exits
+            p_model->get_reporters().clear();
+            return efficacy;
+        });
         for(int g_index = 0; g_index < input.genotypes.size(); g_index++){
             std::stringstream ss;
             if(input.is_old_format){
@@ -231,19 +261,8 @@ int main(int argc, char** argv) {
             else{
                 ss << g_index << "\t" << p_model->get_mosquito()->get_old_genotype_string(input.genotypes[g_index]) << "\t";
             }
-            if(input.therapy_list.empty()){
-              for (auto therapy_id = min_therapy_id; therapy_id <= max_therapy_id; therapy_id++) {
-                double efficacy = getEfficacyForTherapy(input.genotypes[g_index], p_model, input, therapy_id);
-//                ss << efficacy << (therapy_id == max_therapy_id ? "" : "\t");
-                  ss << efficacy << "\t";
-              }
-            }
-            else{
-              for (int t_index = 0; t_index < input.therapy_list.size(); t_index++) {
-                double efficacy = getEfficacyForTherapy(input.genotypes[g_index], p_model, input, input.therapy_list[t_index]);
-//                ss << efficacy << (input.therapy_list[t_index] == input.therapy_list.size() - 1 ? "" : "\t");
-                ss << efficacy << "\t";
-              }
+            for (std::size_t t_index = 0; t_index < therapy_ids.size(); t_index++) {
+                ss << efficacies[(g_index * therapy_ids.size()) + t_index] << "\t";
             }
             std::cout << ss.str() << std::endl;
         }
@@ -289,22 +308,13 @@ double getEfficacyForTherapy(std::string g_str, Model* p_model, utils::Cli::DxGA
     }
 
     p_model->run();
-    const auto result = 1 - p_model->get_mdc()->blood_slide_prevalence_by_location()[0];
-
-    p_model->set_population(std::make_unique<Population>());
-    p_model->set_scheduler(std::make_unique<Scheduler>());
-
-    p_model->get_scheduler()->initialize(p_model->get_config()->get_simulation_timeframe().get_starting_date(),
-      p_model->get_config()->get_simulation_timeframe().get_ending_date());
-    p_model->get_population()->initialize();
-
-    return result;
+    return 1 - p_model->get_mdc()->blood_slide_prevalence_by_location()[0];
 }
 
 double getEfficacyForTherapyCRT(Model* p_model, utils::Cli::DxGAppInput& input, int therapy_id) {
     Therapy* mainTherapy = p_model->get_therapy_db()[therapy_id].get();
-    dynamic_cast<SFTStrategy*>(p_model->get_treatment_coverage())->get_therapy_list().clear();
-    dynamic_cast<SFTStrategy*>(p_model->get_treatment_coverage())->add_therapy(mainTherapy);
+    dynamic_cast<SFTStrategy*>(p_model->get_treatment_strategy())->get_therapy_list().clear();
+    dynamic_cast<SFTStrategy*>(p_model->get_treatment_strategy())->add_therapy(mainTherapy);
 
     // reset reporter
     p_model->get_reporters().clear();
@@ -353,16 +363,17 @@ double getEfficacyForTherapyCRT(Model* p_model, utils::Cli::DxGAppInput& input,
     }
 
     p_model->run();
-    const auto result = 1 - p_model->get_mdc()->blood_slide_prevalence_by_location()[0];
+    return 1 - p_model->get_mdc()->blood_slide_prevalence_by_location()[0];
+}
 
+// Start the next evaluation from a fresh population and scheduler
+void resetModelState(Model* p_model) {
     p_model->set_population(std::make_unique<Population>());
     p_model->set_scheduler(std::make_unique<Scheduler>());
 
     p_model->get_scheduler()->initialize(Model::get_config()->get_simulation_timeframe().get_starting_date(),
-Model::get_config()->get_simulation_timeframe().get_ending_date());
+      Model::get_config()->get_simulation_timeframe().get_ending_date());
     p_model->get_population()->initialize();
-
-    return result;
 }
 
 bool validate_config_for_ee(utils::Cli::DxGAppInput& input) {
@@ -0,0 +1,188 @@
+/*
+ * ParameterSweep.cpp
+ *
+ * Implement the ParameterSweep class.
+ */
+#include "ParameterSweep.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define PARAMETER_SWEEP_FORK
+#endif
+
+namespace {
+// Record sent by a worker for each evaluated cell
+struct CellResult {
+  uint64_t cell;
+  double value;
+};
+
+#ifdef PARAMETER_SWEEP_FORK
+bool write_all(int fd, const void* data, std::size_t size) {
+  const auto* bytes = static_cast<const char*>(data);
+  while (size > 0) {
+    const auto written = ::write(fd, bytes, size);
+    if (written < 0) {
+      if (errno == EINTR) { continue; }
+      return false;
+    }
+    bytes += written;
+    size -= static_cast<std::size_t>(written);
+  }
+  return true;
+}
+
+// Body of a worker process, never returns
+[[noreturn]] void run_worker(int worker, int number_of_workers, std::size_t number_of_cells,
+                             const ParameterSweep::CellFunction &evaluate, int fd) {
+  auto status = 0;
+  try {
+    for (auto cell = static_cast<std::size_t>(worker); cell < number_of_cells;
+         cell += number_of_workers) {
+      const CellResult result{cell, evaluate(cell)};
+      if (!write_all(fd, &result, sizeof(result))) {
+        status = 1;
+        break;
+      }
+    }
+  } catch (const std::exception &ex) {
+    std::cerr << "Parameter sweep worker " << worker << " failed: " << ex.what() << '\n';
+    status = 1;
+  }
+  ::close(fd);
+  std::cout.flush();
+  std::cerr.flush();
+  // Skip the destructors of the state copied from the parent
+  ::_exit(status);
+}
+
+// Do not leave the workers forked so far running on their own
+void stop_workers(const std::vector<pid_t> &pids, const std::vector<pollfd> &fds) {
+  for (const auto &fd : fds) {
+    if (fd.fd >= 0) { ::close(fd.fd); }
+  }
+  for (const auto pid : pids) { ::kill(pid, SIGTERM); }
+  for (const auto pid : pids) {
+    while (::waitpid(pid, nullptr, 0) < 0 && errno == EINTR) {}
+  }
+}
+#endif
+}  // namespace
+
+ParameterSweep::ParameterSweep(int number_of_workers) : number_of_workers_(number_of_workers) {
+  if (number_of_workers_ < 0) {
+    throw std::invalid_argument("The number of parameter sweep workers cannot be negative.");
+  }
+}
+
+std::vector<double> ParameterSweep::run_in_process(std::size_t number_of_cells,
+                                                   const CellFunction &evaluate) const {
+  std::vector<double> results(number_of_cells);
+  for (std::size_t cell = 0; cell < number_of_cells; cell++) { results[cell] = evaluate(cell); }
+  return results;
+}
+
+std::vector<double> ParameterSweep::run(std::size_t number_of_cells,
+                                        const CellFunction &evaluate) const {
+#ifndef PARAMETER_SWEEP_FORK
+  return run_in_process(number_of_cells, evaluate);
+#else
+  const auto number_of_workers =
+      static_cast<int>(std::min<std::size_t>(number_of_workers_, number_of_cells));
+  if (number_of_workers <= 1) { return run_in_process(number_of_cells, evaluate); }
+
+  // Buffered output would otherwise be written again by every worker
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  std::vector<pid_t> pids;
+  std::vector<pollfd> fds;
+  for (auto worker = 0; worker < number_of_workers; worker++) {
+    int pipe_fds[2];
+    if (::pipe(pipe_fds) != 0) {
+      const auto error = errno;
+      stop_workers(pids, fds);
+      throw std::runtime_error(std::string("Cannot create worker pipe: ") + std::strerror(error));
+    }
+    const auto pid = ::fork();
+    if (pid < 0) {
+      const auto error = errno;
+      ::close(pipe_fds[0]);
+      ::close(pipe_fds[1]);
+      stop_workers(pids, fds);
+      throw std::runtime_error(std::string("Cannot fork worker: ") + std::strerror(error));
+    }
+    if (pid == 0) {
+      ::close(pipe_fds[0]);
+      // Drop the read ends of the workers forked before this one
+      for (const auto &fd : fds) { ::close(fd.fd); }
+      run_worker(worker, number_of_workers, number_of_cells, evaluate, pipe_fds[1]);
+    }
+    ::close(pipe_fds[1]);
+    pids.push_back(pid);
+    fds.push_back(pollfd{pipe_fds[0], POLLIN, 0});
+  }
+
+  // Collect the results as they arrive, a record may be split across reads
+  std::vector<double> results(number_of_cells);
+  std::vector<bool> received(number_of_cells, false);
+  std::vector<std::string> pending(fds.size());
+  auto open_fds = fds.size();
+  while (open_fds > 0) {
+    if (::poll(fds.data(), fds.size(), -1) < 0) {
+      if (errno == EINTR) { continue; }
+      const auto error = errno;
+      stop_workers(pids, fds);
+      throw std::runtime_error(std::string("Cannot poll workers: ") + std::strerror(error));
+    }
+    for (std::size_t i = 0; i < fds.size(); i++) {
+      if (fds[i].fd < 0 || fds[i].revents == 0) { continue; }
+      char buffer[4096];
+      const auto count = ::read(fds[i].fd, buffer, sizeof(buffer));
+      if (count < 0 && errno == EINTR) { continue; }
+      if (count <= 0) {
+        ::close(fds[i].fd);
+        fds[i].fd = -1;
+        open_fds--;
+        continue;
+      }
+      pending[i].append(buffer, static_cast<std::size_t>(count));
+      auto offset = std::size_t{0};
+      for (; offset + sizeof(CellResult) <= pending[i].size(); offset += sizeof(CellResult)) {
+        CellResult result{};
+        std::memcpy(&result, pending[i].data() + offset, sizeof(result));
+        if (result.cell < number_of_cells) {
+          results[result.cell] = result.value;
+          received[result.cell] = true;
+        }
+      }
+      pending[i].erase(0, offset);
+    }
+  }
+
+  auto failed = false;
+  for (const auto pid : pids) {
+    auto status = 0;
+    while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) { failed = true; }
+  }
+  for (std::size_t cell = 0; cell < number_of_cells; cell++) {
+    if (!received[cell]) { failed = true; }
+  }
+  if (failed) { throw std::runtime_error("A parameter sweep worker did not complete its cells."); }
+  return results;
+#endif
+}
@@ -0,0 +1,37 @@
+/*
+ * ParameterSweep.h
+ *
+ * Evaluate the cells of a parameter grid (e.g. genotype x therapy) across a
+ * number of worker processes. Each worker is forked from the caller, so it
+ * starts from a copy of the initialized model and owns that copy for the rest
+ * of the sweep. Cell i is evaluated by worker i % number_of_workers and the
+ * results are returned in cell order, so the merged table does not depend on
+ * the timing of the workers. With no more than one worker the cells are
+ * evaluated in the calling process.
+ */
+#ifndef PARAMETERSWEEP_H
+#define PARAMETERSWEEP_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+class ParameterSweep {
+public:
+  using CellFunction = std::function<double(std::size_t cell)>;
+
+  explicit ParameterSweep(int number_of_workers);
+
+  // Evaluate every cell in [0, number_of_cells), throws if a worker fails
+  std::vector<double> run(std::size_t number_of_cells, const CellFunction &evaluate) const;
+
+  [[nodiscard]] int number_of_workers() const { return number_of_workers_; }
+
+private:
+  std::vector<double> run_in_process(std::size_t number_of_cells,
+                                     const CellFunction &evaluate) const;
+
+  int number_of_workers_;
+};
+
+#endif  // PARAMETERSWEEP_H
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Population/Person/Person.h"
+#include "Utils/Arena.h"
+
+// Person-sized slots from utils::Arena against the global allocator. The
+// argument is the number of objects. Each object is allocated next to a small
+// heap allocation, like the containers a person owns, and half of them are
+// replaced in random order as births and deaths do, before the timed loop
+// touches every object in index order.
+
+namespace {
+
+constexpr std::size_t OBJECT_SIZE = sizeof(Person);
+constexpr std::size_t COMPANION_SIZE = 48;
+
+struct HeapSource {
+  void* allocate() { return ::operator new(OBJECT_SIZE); }
+  void deallocate(void* ptr) { ::operator delete(ptr); }
+};
+
+struct ArenaSource {
+  utils::Arena arena{OBJECT_SIZE, alignof(Person)};
+  void* allocate() { return arena.allocate(); }
+  void deallocate(void* ptr) { arena.deallocate(ptr); }
+};
+
+template <typename Source>
+void BM_PersonSizedScan(benchmark::State &state) {
+  const auto number_of_objects = static_cast<std::size_t>(state.range(0));
+  Source source;
+  std::vector<void*> objects(number_of_objects);
+  std::vector<std::unique_ptr<char[]>> companions(number_of_objects);
+  for (std::size_t i = 0; i < number_of_objects; i++) {
+    objects[i] = source.allocate();
+    std::memset(objects[i], 0, OBJECT_SIZE);
+    companions[i] = std::make_unique<char[]>(COMPANION_SIZE);
+  }
+
+  // Replace half of the objects in random order
+  std::vector<std::size_t> order(number_of_objects);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937_64{42});
+  order.resize(number_of_objects / 2);
+  for (auto i : order) {
+    source.deallocate(objects[i]);
+    companions[i].reset();
+  }
+  for (auto i : order) {
+    objects[i] = source.allocate();
+    std::memset(objects[i], 0, OBJECT_SIZE);
+    companions[i] = std::make_unique<char[]>(COMPANION_SIZE);
+  }
+
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto* object : objects) {
+      auto* words = static_cast<std::uint64_t*>(object);
+      words[0]++;
+      sum += words[OBJECT_SIZE / sizeof(std::uint64_t) - 1];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(number_of_objects));
+
+  for (auto* object : objects) { source.deallocate(object); }
+}
+BENCHMARK_TEMPLATE(BM_PersonSizedScan, HeapSource)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PersonSizedScan, ArenaSource)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <typename Source>
+void BM_PersonSizedAllocation(benchmark::State &state) {
+  const auto number_of_objects = static_cast<std::size_t>(state.range(0));
+  Source source;
+  std::vector<void*> objects(number_of_objects);
+  for (auto _ : state) {
+    for (auto &object : objects) { object = source.allocate(); }
+    for (auto* object : objects) { source.deallocate(object); }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(number_of_objects));
+}
+BENCHMARK_TEMPLATE(BM_PersonSizedAllocation, HeapSource)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PersonSizedAllocation, ArenaSource)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
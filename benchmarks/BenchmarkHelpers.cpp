@@ -0,0 +1,86 @@
+#include "BenchmarkHelpers.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+#include <yaml-cpp/yaml.h>
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+
+namespace bench {
+
+std::string output_directory() {
+  auto path = std::filesystem::temp_directory_path() / "malasim_bench";
+  std::filesystem::create_directories(path);
+  return path.string() + "/";
+}
+
+std::string write_synthetic_input(int number_of_locations, int persons_per_location,
+                                  int number_of_days) {
+  auto input = YAML::LoadFile(MALASIM_BENCH_BASE_INPUT);
+
+  input["model_settings"]["days_between_stdout_output"] = number_of_days + 1;
+  input["model_settings"]["initial_seed_number"] = 42;
+
+  // Run from 2000/1/1 for the requested number of days
+  using namespace std::chrono;
+  const auto start = sys_days{year{2000} / January / 1};
+  const year_month_day end{start + days{number_of_days}};
+  input["simulation_timeframe"]["starting_date"] = "2000/1/1";
+  input["simulation_timeframe"]["start_of_comparison_period"] = "2000/1/1";
+  input["simulation_timeframe"]["ending_date"] =
+      fmt::format("{}/{}/{}", static_cast<int>(end.year()), static_cast<unsigned>(end.month()),
+                  static_cast<unsigned>(end.day()));
+
+  // Lay the locations out on a square grid, roughly 5km apart
+  auto spatial = input["spatial_settings"];
+  spatial["mode"] = "location_based";
+  auto location_info = YAML::Node(YAML::NodeType::Sequence);
+  const auto width = static_cast<int>(std::ceil(std::sqrt(number_of_locations)));
+  for (auto loc = 0; loc < number_of_locations; loc++) {
+    auto row = YAML::Node(YAML::NodeType::Sequence);
+    row.push_back(loc);
+    row.push_back(0.045 * (loc / width));
+    row.push_back(0.045 * (loc % width));
+    location_info.push_back(row);
+  }
+  spatial["location_based"]["location_info"] = location_info;
+  auto population_size = YAML::Node(YAML::NodeType::Sequence);
+  population_size.push_back(persons_per_location);
+  spatial["location_based"]["population_size_by_location"] = population_size;
+
+  // Movement that only needs the coordinates
+  input["movement_settings"]["spatial_model"]["name"] = "Barabasi";
+  input["seasonality_settings"]["enable"] = false;
+  input["mosquito_parameters"]["mosquito_config"]["mode"] = "location_based";
+
+  auto path = fmt::format("{}input_{}x{}_{}.yml", output_directory(), number_of_locations,
+                          persons_per_location, number_of_days);
+  std::ofstream out(path);
+  out << input;
+  return path;
+}
+
+void initialize_model(int number_of_locations, int persons_per_location, int number_of_days) {
+  release_model();
+  spdlog::set_level(spdlog::level::warn);
+
+  utils::Cli::get_instance().set_input_path(
+      write_synthetic_input(number_of_locations, persons_per_location, number_of_days));
+  utils::Cli::get_instance().set_output_path(output_directory());
+  if (!Model::get_instance()->initialize()) {
+    throw std::runtime_error("Unable to initialize the model for the benchmark scenario.");
+  }
+}
+
+void release_model() {
+  if (Model::get_population() != nullptr) { Model::get_instance()->release(); }
+}
+
+}  // namespace bench
@@ -0,0 +1,32 @@
+/*
+ * BenchmarkHelpers.h
+ *
+ * Synthetic scenarios for the benchmarks. A scenario is the sample input
+ * switched to location-based mode with N locations laid out on a grid and M
+ * persons in every location, so the cost of the daily loop can be measured at
+ * any scale without raster files.
+ */
+#ifndef BENCHMARK_HELPERS_H
+#define BENCHMARK_HELPERS_H
+
+#include <string>
+
+namespace bench {
+
+// Write the input file for a scenario of the given size and return its path
+std::string write_synthetic_input(int number_of_locations, int persons_per_location,
+                                  int number_of_days);
+
+// Initialize the Model singleton with a synthetic scenario, releasing the
+// previous model if there is one
+void initialize_model(int number_of_locations, int persons_per_location, int number_of_days = 365);
+
+// Release the Model singleton
+void release_model();
+
+// Directory used for the inputs and the databases written by the benchmarks
+std::string output_directory();
+
+}  // namespace bench
+
+#endif  // BENCHMARK_HELPERS_H
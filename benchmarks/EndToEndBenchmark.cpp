@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelpers.h"
+#include "Population/Population.h"
+#include "Simulation/Model.h"
+
+namespace {
+
+// Full simulation of a synthetic scenario, the arguments are the number of
+// locations, persons per location and simulated days. Reports the throughput
+// in agent-days per second, model initialization is not timed.
+void BM_EndToEnd(benchmark::State &state) {
+  const auto number_of_locations = static_cast<int>(state.range(0));
+  const auto persons_per_location = static_cast<int>(state.range(1));
+  const auto number_of_days = static_cast<int>(state.range(2));
+
+  double agent_days = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    bench::initialize_model(number_of_locations, persons_per_location, number_of_days);
+    state.ResumeTiming();
+
+    Model::get_instance()->run();
+
+    state.PauseTiming();
+    // Population changes over the run, use the mean of the first and last day
+    agent_days += 0.5
+                  * static_cast<double>(number_of_locations * persons_per_location
+                                        + Model::get_population()->size())
+                  * number_of_days;
+    bench::release_model();
+    state.ResumeTiming();
+  }
+
+  state.counters["agent_days_per_second"] =
+      benchmark::Counter(agent_days, benchmark::Counter::kIsRate);
+  state.counters["agents"] = number_of_locations * persons_per_location;
+}
+BENCHMARK(BM_EndToEnd)
+    ->Args({1, 10000, 365})
+    ->Args({100, 1000, 365})
+    ->Args({1000, 100, 365})
+    ->Unit(benchmark::kSecond)
+    ->Iterations(1);
+
+}  // namespace
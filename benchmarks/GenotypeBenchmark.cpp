@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "BenchmarkHelpers.h"
+#include "Parasites/Genotype.h"
+#include "Parasites/GenotypeDatabase.h"
+#include "Simulation/Model.h"
+
+// Both benchmarks use the genotypes introduced by the sample input, a small
+// scenario is enough since the population is not touched
+
+namespace {
+
+void BM_GenotypeFreeRecombine(benchmark::State &state) {
+  bench::initialize_model(1, 100);
+  auto* genotype_db = Model::get_genotype_db();
+  auto* female = genotype_db->at(0);
+  auto* male = genotype_db->at(static_cast<int>(genotype_db->size()) - 1);
+
+  for (auto _ : state) {
+    auto* child =
+        Genotype::free_recombine(Model::get_config(), Model::get_random(), female, male);
+    benchmark::DoNotOptimize(child);
+  }
+  state.SetItemsProcessed(state.iterations());
+  bench::release_model();
+}
+BENCHMARK(BM_GenotypeFreeRecombine);
+
+void BM_GenotypeDatabaseGetGenotype(benchmark::State &state) {
+  bench::initialize_model(1, 100);
+  auto* genotype_db = Model::get_genotype_db();
+  const auto aa_sequence = genotype_db->at(0)->get_aa_sequence();
+
+  for (auto _ : state) {
+    auto* genotype = genotype_db->get_genotype(aa_sequence);
+    benchmark::DoNotOptimize(genotype);
+  }
+  state.SetItemsProcessed(state.iterations());
+  bench::release_model();
+}
+BENCHMARK(BM_GenotypeDatabaseGetGenotype);
+
+}  // namespace
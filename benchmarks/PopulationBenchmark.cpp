@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelpers.h"
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Mosquito/Mosquito.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Simulation/Model.h"
+#include "Utils/Index/PersonIndexAll.h"
+
+// The model is initialized outside of the timed loop, the arguments are the
+// number of locations and the number of persons per location
+
+namespace {
+
+void BM_UpdateCurrentFoi(benchmark::State &state) {
+  bench::initialize_model(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  auto* population = Model::get_population();
+
+  for (auto _ : state) { population->update_current_foi(); }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(population->size()));
+  bench::release_model();
+}
+BENCHMARK(BM_UpdateCurrentFoi)->Args({1, 10000})->Args({100, 1000})->Unit(benchmark::kMicrosecond);
+
+void BM_PersonUpdate(benchmark::State &state) {
+  bench::initialize_model(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  auto &persons = Model::get_population()->all_persons()->v_person();
+
+  // Person::update only does work once per day, advance the clock every pass
+  auto day = 1;
+  for (auto _ : state) {
+    Model::get_scheduler()->set_current_time(day++);
+    for (const auto &person : persons) { person->update(); }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(persons.size()));
+  bench::release_model();
+}
+BENCHMARK(BM_PersonUpdate)->Args({1, 10000})->Args({100, 1000})->Unit(benchmark::kMillisecond);
+
+void BM_InfectNewCohortInPrmc(benchmark::State &state) {
+  bench::initialize_model(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+  Model::get_population()->update_current_foi();
+
+  auto day = 0;
+  for (auto _ : state) {
+    const auto tracking_index = day++ % Model::get_config()->number_of_tracking_days();
+    Model::get_mosquito()->infect_new_cohort_in_PRMC(Model::get_config(), Model::get_random(),
+                                                     Model::get_population(), tracking_index);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  bench::release_model();
+}
+BENCHMARK(BM_InfectNewCohortInPrmc)
+    ->Args({1, 10000})
+    ->Args({100, 1000})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Utils/Random.h"
+
+namespace {
+
+// Number of candidates to sample from, number of samples drawn
+void BM_RouletteSampling(benchmark::State &state) {
+  utils::Random random;
+  random.set_seed(42);
+
+  const auto number_of_objects = static_cast<int>(state.range(0));
+  const auto number_of_samples = static_cast<int>(state.range(1));
+  std::vector<int> objects(number_of_objects);
+  std::vector<int*> object_ptrs;
+  std::vector<double> distribution;
+  for (auto &object : objects) {
+    object_ptrs.push_back(&object);
+    distribution.push_back(random.random_uniform());
+  }
+
+  for (auto _ : state) {
+    auto samples = random.roulette_sampling(number_of_samples, distribution, object_ptrs, false);
+    benchmark::DoNotOptimize(samples);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_samples);
+}
+BENCHMARK(BM_RouletteSampling)->Args({1000, 10})->Args({10000, 100})->Args({100000, 1000});
+
+// Number of categories, number of trials
+void BM_RandomMultinomial(benchmark::State &state) {
+  utils::Random random;
+  random.set_seed(42);
+
+  const auto categories = static_cast<std::size_t>(state.range(0));
+  const auto trials = static_cast<unsigned>(state.range(1));
+  std::vector<double> probabilities(categories);
+  for (auto &probability : probabilities) { probability = random.random_uniform(); }
+  std::vector<unsigned> results(categories);
+
+  for (auto _ : state) {
+    random.random_multinomial(categories, trials, probabilities, results);
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * trials);
+}
+BENCHMARK(BM_RandomMultinomial)->Args({10, 100})->Args({1000, 1000})->Args({100000, 10000});
+
+}  // namespace
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "BenchmarkHelpers.h"
+#include "Reporters/Reporter.h"
+#include "Simulation/Model.h"
+
+namespace {
+
+// Cost of one monthly write of the SQLite reporter, including the genome data,
+// the arguments are the number of locations and persons per location
+void BM_SQLiteMonthlyReport(benchmark::State &state) {
+  bench::initialize_model(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+
+  // A separate job number keeps the database apart from the model's reporter
+  auto reporter = Reporter::MakeReport(Reporter::SQLITE_MONTHLY_REPORTER);
+  reporter->initialize(static_cast<int>(state.range(0)) + 1000, bench::output_directory());
+  reporter->before_run();
+
+  for (auto _ : state) { reporter->monthly_report(); }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+
+  reporter.reset();
+  bench::release_model();
+}
+BENCHMARK(BM_SQLiteMonthlyReport)
+    ->Args({1, 1000})
+    ->Args({100, 100})
+    ->Args({1000, 10})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
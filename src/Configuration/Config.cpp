@@ -7,6 +7,7 @@
 
 #include "Simulation/Model.h"
 #include "Utils/Cli.h"
+#include "Utils/Constants.h"
 
 int inline get_pipe_count(const std::string &str) {
   int pipe_count = 0;
@@ -160,6 +161,8 @@ bool Config::load(const std::string &filename) {
           get_simulation_timeframe().get_starting_date());
     }
 
+    refresh_run_constants();
+
     /*
      * Parse population events last because it depends on all other settings
      */
@@ -701,3 +704,32 @@ void Config::validate_all_cross_field_validations() {
 
 void Config::reload() { load(config_file_path_); }
 
+void Config::refresh_run_constants() {
+  const auto &density_levels = parasite_parameters_.get_parasite_density_levels();
+  run_constants_.log_parasite_density_cured = density_levels.get_log_parasite_density_cured();
+  run_constants_.log_parasite_density_from_liver =
+      density_levels.get_log_parasite_density_from_liver();
+  run_constants_.log_parasite_density_asymptomatic =
+      density_levels.get_log_parasite_density_asymptomatic();
+  run_constants_.log_parasite_density_clinical = density_levels.get_log_parasite_density_clinical();
+  run_constants_.log_parasite_density_clinical_from =
+      density_levels.get_log_parasite_density_clinical_from();
+  run_constants_.log_parasite_density_clinical_to =
+      density_levels.get_log_parasite_density_clinical_to();
+  run_constants_.log_parasite_density_detectable =
+      density_levels.get_log_parasite_density_detectable();
+  run_constants_.log_parasite_density_detectable_pfpr =
+      density_levels.get_log_parasite_density_detectable_pfpr();
+  run_constants_.log_parasite_density_pyrogenic =
+      density_levels.get_log_parasite_density_pyrogenic();
+
+  run_constants_.mutation_probability_per_locus =
+      genotype_parameters_.get_mutation_probability_per_locus();
+
+  run_constants_.daily_death_probability_by_age_class.clear();
+  for (const auto rate : population_demographic_.get_death_rate_by_age_class()) {
+    run_constants_.daily_death_probability_by_age_class.push_back(
+        std::min(1.0, rate / static_cast<double>(Constants::DAYS_IN_YEAR)));
+  }
+}
+
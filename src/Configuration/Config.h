@@ -15,6 +15,7 @@
 #include "PopulationDemographic.h"
 #include "PopulationEvents.h"
 #include "RaptSettings.h"
+#include "RunConstants.h"
 #include "SeasonalitySettings.h"
 #include "SimulationTimeframe.h"
 #include "SpatialSettings/SpatialSettings.h"
@@ -63,6 +64,7 @@ public:
 
   void set_population_demographic(const PopulationDemographic &demographic) {
     population_demographic_ = demographic;
+    refresh_run_constants();
   }
 
   [[nodiscard]] const EpidemiologicalParameters &get_epidemiological_parameters() const {
@@ -77,6 +79,7 @@ public:
   }
   void set_parasite_parameters(const ParasiteParameters &parameters) {
     parasite_parameters_ = parameters;
+    refresh_run_constants();
   }
 
   [[nodiscard]] SpatialSettings &get_spatial_settings() {
@@ -104,6 +107,12 @@ public:
   [[nodiscard]] PopulationEvents &get_population_events() { return population_events_; }
   [[nodiscard]] RaptSettings &get_rapt_settings() { return rapt_settings_; }
 
+  // Values read in the per-person and per-clone loops, see RunConstants.h
+  [[nodiscard]] const RunConstants &get_run_constants() const { return run_constants_; }
+  // Rebuild the run constants, to be called by anything that changes one of
+  // the values they copy while the model runs
+  void refresh_run_constants();
+
   // Make relevant getters virtual for mocking
   [[nodiscard]] size_t number_of_locations() const;
   [[nodiscard]] int number_of_age_classes() const;
@@ -150,6 +159,7 @@ private:
   MosquitoParameters mosquito_parameters_;
   PopulationEvents population_events_;
   RaptSettings rapt_settings_;
+  RunConstants run_constants_;
 };
 
 #endif  // CONFIG_H
@@ -1,5 +1,6 @@
 #include "GenotypeParameters.h"
 
+#include "Parasites/Genotype.h"
 #include "Simulation/Model.h"
 
 void GenotypeParameters::process_config_with_number_of_locations(size_t number_of_locations) {
@@ -27,3 +28,29 @@ void GenotypeParameters::process_config_with_number_of_locations(size_t number_o
   }
 }
 
+
+void GenotypeParameters::validate_allele_markers() const {
+  if (allele_markers_.size() > Genotype::MAX_ALLELE_MARKERS) {
+    throw std::runtime_error(
+        fmt::format("At most {} allele markers are supported", Genotype::MAX_ALLELE_MARKERS));
+  }
+  for (const auto &marker : allele_markers_) {
+    auto found = false;
+    for (const auto &chromosome : pf_genotype_info_.chromosome_infos) {
+      for (const auto &gene : chromosome.get_genes()) {
+        if (gene.get_name() != marker.get_gene()) { continue; }
+        if (marker.get_copy_number() > 0) {
+          found = found || gene.get_max_copies() > 1;
+          continue;
+        }
+        for (const auto &aa_position : gene.get_aa_positions()) {
+          found = found || aa_position.get_position() == marker.get_position();
+        }
+      }
+    }
+    if (!found) {
+      throw std::runtime_error(
+          fmt::format("Allele marker {} does not match the genotype info", marker.get_label()));
+    }
+  }
+}
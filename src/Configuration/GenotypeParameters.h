@@ -250,6 +250,41 @@ public:
     double ec50_ = 0.0;
   };
 
+  // Inner class: AlleleMarker, an amino acid at a position of a gene (e.g. Pfkelch13 580Y) or,
+  // when copy_number is set, at least that many copies of the gene
+  class AlleleMarker {
+  public:
+    // Getters and Setters
+    [[nodiscard]] const std::string &get_name() const { return name_; }
+    void set_name(const std::string &value) { name_ = value; }
+
+    [[nodiscard]] const std::string &get_gene() const { return gene_; }
+    void set_gene(const std::string &value) { gene_ = value; }
+
+    [[nodiscard]] int get_position() const { return position_; }
+    void set_position(const int value) { position_ = value; }
+
+    [[nodiscard]] const std::string &get_amino_acid() const { return amino_acid_; }
+    void set_amino_acid(const std::string &value) { amino_acid_ = value; }
+
+    [[nodiscard]] int get_copy_number() const { return copy_number_; }
+    void set_copy_number(const int value) { copy_number_ = value; }
+
+    // Name used in the reports, e.g. Pfkelch13:580Y or Pfplasmepsin:2x
+    [[nodiscard]] std::string get_label() const {
+      if (!name_.empty()) { return name_; }
+      if (copy_number_ > 0) { return gene_ + ":" + std::to_string(copy_number_) + "x"; }
+      return gene_ + ":" + std::to_string(position_) + amino_acid_;
+    }
+
+  private:
+    std::string name_;
+    std::string gene_;
+    int position_ = -1;
+    std::string amino_acid_;
+    int copy_number_ = 0;
+  };
+
   // Inner class: GenotypeInfo
   class ParasiteInfo {
   public:
@@ -328,6 +363,16 @@ public:
   [[nodiscard]] PfGenotypeInfo get_pf_genotype_info() const { return pf_genotype_info_; }
   void set_pf_genotype_info(const PfGenotypeInfo &value) { pf_genotype_info_ = value; }
 
+  // Markers flagged on every genotype, at most Genotype::MAX_ALLELE_MARKERS
+  [[nodiscard]] const std::vector<AlleleMarker> &get_allele_markers() const {
+    return allele_markers_;
+  }
+  void set_allele_markers(const std::vector<AlleleMarker> &value) { allele_markers_ = value; }
+
+  // Throw if there are too many markers or a marker names a gene, position or
+  // copy number that is not in pf_genotype_info
+  void validate_allele_markers() const;
+
   void process_config() override {}
 
   void process_config_with_number_of_locations(size_t number_of_locations);
@@ -339,6 +384,7 @@ private:
   std::vector<OverrideEC50Pattern> override_ec50_patterns_;
   std::vector<InitialParasiteInfo> initial_parasite_info_;
   std::vector<InitialParasiteInfoRaw> initial_parasite_info_raw_;
+  std::vector<AlleleMarker> allele_markers_;
 };
 
 namespace YAML {
@@ -514,6 +560,42 @@ struct convert<GenotypeParameters::OverrideEC50Pattern> {
   }
 };
 
+// GenotypeParameters::AlleleMarker YAML conversion
+template <>
+struct convert<GenotypeParameters::AlleleMarker> {
+  static Node encode(const GenotypeParameters::AlleleMarker &rhs) {
+    Node node;
+    if (!rhs.get_name().empty()) { node["name"] = rhs.get_name(); }
+    node["gene"] = rhs.get_gene();
+    if (rhs.get_copy_number() > 0) {
+      node["copy_number"] = rhs.get_copy_number();
+    } else {
+      node["position"] = rhs.get_position();
+      node["amino_acid"] = rhs.get_amino_acid();
+    }
+    return node;
+  }
+
+  static bool decode(const Node &node, GenotypeParameters::AlleleMarker &rhs) {
+    if (!node["gene"]
+        || (!node["copy_number"] && (!node["position"] || !node["amino_acid"]))) {
+      throw std::runtime_error("Missing fields in GenotypeParameters::AlleleMarker");
+    }
+    if (node["name"]) { rhs.set_name(node["name"].as<std::string>()); }
+    rhs.set_gene(node["gene"].as<std::string>());
+    if (node["copy_number"]) {
+      rhs.set_copy_number(node["copy_number"].as<int>());
+    } else {
+      rhs.set_position(node["position"].as<int>());
+      rhs.set_amino_acid(node["amino_acid"].as<std::string>());
+      if (rhs.get_amino_acid().size() != 1) {
+        throw std::runtime_error("GenotypeParameters::AlleleMarker amino_acid must be one letter");
+      }
+    }
+    return true;
+  }
+};
+
 // GenotypeParameters::GenotypeInfo YAML conversion
 template <>
 struct convert<GenotypeParameters::ParasiteInfo> {
@@ -565,6 +647,7 @@ struct convert<GenotypeParameters> {
     node["pf_genotype_info"] = rhs.get_pf_genotype_info();
     node["override_ec50_patterns"] = rhs.get_override_ec50_patterns();
     node["initial_parasite_info"] = rhs.get_initial_parasite_info_raw();
+    if (!rhs.get_allele_markers().empty()) { node["allele_markers"] = rhs.get_allele_markers(); }
     return node;
   }
 
@@ -582,6 +665,12 @@ struct convert<GenotypeParameters> {
     rhs.set_initial_parasite_info_raw(
         node["initial_parasite_info"]
             .as<std::vector<GenotypeParameters::InitialParasiteInfoRaw>>());
+    // Optional, markers to report allele frequencies for
+    if (node["allele_markers"]) {
+      rhs.set_allele_markers(
+          node["allele_markers"].as<std::vector<GenotypeParameters::AlleleMarker>>());
+      rhs.validate_allele_markers();
+    }
     return true;
   }
 };
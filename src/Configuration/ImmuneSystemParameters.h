@@ -2,11 +2,17 @@
 #define IMMUNESYSTEMPARAMETERS_H
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "IConfigData.h"
 #include "Utils/Helpers/NumberHelpers.h"
 
 class ImmuneSystemParameters : public IConfigData {
 public:
+  // Number of intervals of the tables over the immune level in [0, 1]
+  static constexpr int IMMUNE_TABLE_INTERVALS = 1000;
+
   // Getters and Setters
   [[nodiscard]] double get_b1() const { return b1_; }
   void set_b1(const double value) { b1_ = value; }
@@ -125,6 +131,26 @@ public:
                         / duration_for_fully_immune);
     c_max = pow(
         10, -(log_parasite_density_asymptomatic - log_parasite_density_cured) / duration_for_naive);
+
+    // Tabulate the functions of the immune level evaluated for every infection
+    // and every parasite update
+    clinical_probability_by_immune.resize(IMMUNE_TABLE_INTERVALS + 1);
+    log10_growth_by_immune.resize(IMMUNE_TABLE_INTERVALS + 1);
+    for (int i = 0; i <= IMMUNE_TABLE_INTERVALS; i++) {
+      const double immune = static_cast<double>(i) / IMMUNE_TABLE_INTERVALS;
+      clinical_probability_by_immune[i] =
+          max_clinical_probability
+          / (1 + pow((immune / midpoint), immune_effect_on_progression_to_clinical));
+      log10_growth_by_immune[i] = log10((c_max * (1 - immune)) + (c_min * immune));
+    }
+  }
+
+  // Linear interpolation of a table built over the immune level
+  [[nodiscard]] static double interpolate(const std::vector<double> &table, double immune) {
+    const double position = std::clamp(immune, 0.0, 1.0) * IMMUNE_TABLE_INTERVALS;
+    const int index = std::min(static_cast<int>(position), IMMUNE_TABLE_INTERVALS - 1);
+    const double fraction = position - index;
+    return table[index] + (fraction * (table[index + 1] - table[index]));
   }
 
 private:
@@ -164,6 +190,12 @@ public:
   double c_min{-1};
   double c_max{-1};
 
+  // Clinical progression probability and log10 of the daily parasite growth
+  // factor, c_max * (1 - immune) + c_min * immune, at immune level
+  // i / IMMUNE_TABLE_INTERVALS
+  std::vector<double> clinical_probability_by_immune;
+  std::vector<double> log10_growth_by_immune;
+
   double alpha_immune{-1};
   double beta_immune{-1};
 
@@ -40,6 +40,16 @@ public:
   bool get_cell_level_reporting() const { return cell_level_reporting_; }
   void set_cell_level_reporting(const bool value) { cell_level_reporting_ = value; }
 
+  // Number of raw mutation and recombination events sampled next to their
+  // counts, 0 keeps the counts only
+  [[nodiscard]] int get_event_sample_capacity() const { return event_sample_capacity_; }
+  void set_event_sample_capacity(const int value) {
+    if (value < 0) {
+      throw std::invalid_argument("event_sample_capacity must be non-negative");
+    }
+    event_sample_capacity_ = value;
+  }
+
   void process_config() override {
     spdlog::info("Processing ModelSettings");
   }
@@ -49,6 +59,7 @@ private:
   long initial_seed_number_ = 0;
   bool record_genome_db_ = true;
   bool cell_level_reporting_ = true;
+  int event_sample_capacity_ = 0;
 };
 
 template <>
@@ -59,6 +70,7 @@ struct YAML::convert<ModelSettings> {
     node["initial_seed_number"] = rhs.get_initial_seed_number();
     node["record_genome_db"] = rhs.get_record_genome_db();
     node["cell_level_reporting"] = rhs.get_cell_level_reporting();
+    node["event_sample_capacity"] = rhs.get_event_sample_capacity();
     return node;
   }
 
@@ -81,6 +93,10 @@ struct YAML::convert<ModelSettings> {
     rhs.set_initial_seed_number(node["initial_seed_number"].as<long>());
     rhs.set_record_genome_db(node["record_genome_db"].as<bool>());
     rhs.set_cell_level_reporting(node["cell_level_reporting"].as<bool>());
+    // Optional, older inputs only keep the counts
+    if (node["event_sample_capacity"]) {
+      rhs.set_event_sample_capacity(node["event_sample_capacity"].as<int>());
+    }
     return true;
   }
 };  // namespace YAML
@@ -70,6 +70,24 @@ public:
     artificial_rescaling_of_population_size_ = value;
   }
 
+  // When set, never-infected susceptibles are kept as counts in a
+  // SusceptibleCompartment until an infection, importation or MDA touches them
+  [[nodiscard]] bool get_aggregate_never_infected_susceptibles() const {
+    return aggregate_never_infected_susceptibles_;
+  }
+  void set_aggregate_never_infected_susceptibles(const bool value) {
+    aggregate_never_infected_susceptibles_ = value;
+  }
+
+  [[nodiscard]] int get_number_of_biting_rate_buckets() const {
+    return number_of_biting_rate_buckets_;
+  }
+  void set_number_of_biting_rate_buckets(const int value) {
+    if (value <= 0)
+      throw std::invalid_argument("number_of_biting_rate_buckets must be greater than 0");
+    number_of_biting_rate_buckets_ = value;
+  }
+
   void process_config() override {
     spdlog::info("Processing PopulationDemographic");
     number_of_age_classes_ = static_cast<int>(age_structure_.size());
@@ -83,6 +101,8 @@ private:
   std::vector<double> death_rate_by_age_class_;
   std::vector<double> mortality_when_treatment_fail_by_age_class_;
   double artificial_rescaling_of_population_size_{1.0};
+  bool aggregate_never_infected_susceptibles_{false};
+  int number_of_biting_rate_buckets_{10};
 };
 
 template <>
@@ -97,6 +117,8 @@ struct YAML::convert<PopulationDemographic> {
         rhs.get_mortality_when_treatment_fail_by_age_class();
     node["artificial_rescaling_of_population_size"] =
         rhs.get_artificial_rescaling_of_population_size();
+    node["aggregate_never_infected_susceptibles"] = rhs.get_aggregate_never_infected_susceptibles();
+    node["number_of_biting_rate_buckets"] = rhs.get_number_of_biting_rate_buckets();
     return node;
   }
 
@@ -130,6 +152,15 @@ struct YAML::convert<PopulationDemographic> {
     rhs.set_artificial_rescaling_of_population_size(
         node["artificial_rescaling_of_population_size"].as<double>());
 
+    // Optional, the population is fully individual-based by default
+    if (node["aggregate_never_infected_susceptibles"]) {
+      rhs.set_aggregate_never_infected_susceptibles(
+          node["aggregate_never_infected_susceptibles"].as<bool>());
+    }
+    if (node["number_of_biting_rate_buckets"]) {
+      rhs.set_number_of_biting_rate_buckets(node["number_of_biting_rate_buckets"].as<int>());
+    }
+
     return true;
   }
 };  // namespace YAML
@@ -0,0 +1,35 @@
+/*
+ * RunConstants.h
+ *
+ * Flat copy of the configuration values read inside the per-person and
+ * per-clone loops. A loop takes one reference to this block up front instead
+ * of chaining through the Model singleton and the getters of several settings
+ * classes for every person or clone.
+ *
+ * Config rebuilds the block after the configuration is loaded and whenever
+ * one of the values changes (see Config::refresh_run_constants()).
+ */
+#ifndef RUNCONSTANTS_H
+#define RUNCONSTANTS_H
+
+#include <vector>
+
+struct alignas(64) RunConstants {
+  // Parasite density levels, log10 per uL of blood
+  double log_parasite_density_cured{0};
+  double log_parasite_density_from_liver{0};
+  double log_parasite_density_asymptomatic{0};
+  double log_parasite_density_clinical{0};
+  double log_parasite_density_clinical_from{0};
+  double log_parasite_density_clinical_to{0};
+  double log_parasite_density_detectable{0};
+  double log_parasite_density_detectable_pfpr{0};
+  double log_parasite_density_pyrogenic{0};
+
+  double mutation_probability_per_locus{0};
+
+  // Probability of dying on a given day, by age class
+  std::vector<double> daily_death_probability_by_age_class;
+};
+
+#endif  // RUNCONSTANTS_H
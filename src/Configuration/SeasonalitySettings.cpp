@@ -1,5 +1,59 @@
 #include "SeasonalitySettings.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 SeasonalitySettings::SeasonalitySettings() = default;
 
 SeasonalitySettings::~SeasonalitySettings() = default;
+
+const double* SeasonalitySettings::get_seasonal_factors(const date::sys_days &today) const {
+  if (factor_table_.empty()) {
+    throw std::logic_error("The seasonal factor table has not been built.");
+  }
+  const date::year_month_day ymd{today};
+  const auto leap = TimeHelpers::is_leap_year(static_cast<int>(ymd.year())) ? 1 : 0;
+  const auto row = row_of_day_[leap][TimeHelpers::day_of_year(today) - 1];
+  return &factor_table_[static_cast<size_t>(row) * number_of_locations_];
+}
+
+void SeasonalitySettings::build_seasonal_factor_table(size_t number_of_locations) {
+  number_of_locations_ = number_of_locations;
+  factor_table_.clear();
+  if (number_of_locations_ == 0) { return; }
+
+  // Returns the row holding the same factors as the given one, or -1
+  auto find_row = [this](const std::vector<double> &factors, int row) {
+    if (row < 0) { return -1; }
+    const auto first = factor_table_.begin() + (static_cast<ptrdiff_t>(row) * number_of_locations_);
+    return std::equal(factors.begin(), factors.end(), first) ? row : -1;
+  };
+
+  // The factors may depend on the day of year (equation, daily data) or on the
+  // month (monthly data), so a common and a leap year cover every case
+  const std::array<date::year, 2> reference_years{date::year{2023}, date::year{2024}};
+  std::vector<double> factors(number_of_locations_);
+  auto number_of_rows = 0;
+  for (auto leap = 0; leap < 2; leap++) {
+    const auto first_day = date::sys_days{reference_years[leap] / 1 / 1};
+    const auto days_in_year = leap == 1 ? 366 : 365;
+    for (auto day = 0; day < days_in_year; day++) {
+      const auto today = first_day + date::days{day};
+      for (size_t loc = 0; loc < number_of_locations_; loc++) {
+        factors[loc] = evaluate_seasonal_factor(today, static_cast<int>(loc));
+      }
+
+      // Share the row of the previous day or of the same day in a common year
+      auto row = find_row(factors, day > 0 ? row_of_day_[leap][day - 1] : -1);
+      if (row == -1 && leap == 1 && day < 365) { row = find_row(factors, row_of_day_[0][day]); }
+      if (row == -1) {
+        row = number_of_rows++;
+        factor_table_.insert(factor_table_.end(), factors.begin(), factors.end());
+      }
+      row_of_day_[leap][day] = row;
+    }
+  }
+  row_of_day_[0][365] = row_of_day_[0][364];
+  spdlog::info("Seasonal factor table built with {} rows for {} locations", number_of_rows,
+               number_of_locations_);
+}
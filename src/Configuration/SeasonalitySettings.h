@@ -4,6 +4,7 @@
 #include <Utils/Helpers/TimeHelpers.h>
 #include <spdlog/spdlog.h>
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -53,21 +54,22 @@ public:
     seasonal_equation_ = std::move(value);
   }
 
+  // Return the seasonal factor for the given day and location, served from the
+  // factor table once it is built
   [[nodiscard]] double get_seasonal_factor(const date::sys_days &today, const int &location) {
-    if (enable_) {
-      if (mode_ == "equation") {
-        return get_seasonal_equation()->get_seasonal_factor(today, location);
-      }
-      if (mode_ == "rainfall") {
-        return get_seasonal_rainfall()->get_seasonal_factor(today, location);
-      }
-      if (mode_ == "pattern") {
-        return get_seasonal_pattern()->get_seasonal_factor(today, location);
-      }
-    }
-    return 1.0;
+    if (!factor_table_.empty()) { return get_seasonal_factors(today)[location]; }
+    return evaluate_seasonal_factor(today, location);
   }
 
+  // Return the seasonal factors of all locations for the given day as a row of
+  // the factor table, indexed by location
+  [[nodiscard]] const double* get_seasonal_factors(const date::sys_days &today) const;
+
+  // Evaluate the active model for every day of a common and a leap year and
+  // store the factors of all locations, days with identical factors share a
+  // row. Must be called again if the parameters of the model are changed.
+  void build_seasonal_factor_table(size_t number_of_locations);
+
   void process_config() override {}
 
   void process_config_using_number_of_locations(SpatialData* spatial_data,
@@ -93,14 +95,38 @@ public:
     } else {
       spdlog::info("Seasonality disabled, using default value of 1.0");
     }
+    build_seasonal_factor_table(number_of_locations);
   }
 
 private:
+  [[nodiscard]] double evaluate_seasonal_factor(const date::sys_days &today,
+                                                const int &location) const {
+    if (enable_) {
+      if (mode_ == "equation") {
+        return get_seasonal_equation()->get_seasonal_factor(today, location);
+      }
+      if (mode_ == "rainfall") {
+        return get_seasonal_rainfall()->get_seasonal_factor(today, location);
+      }
+      if (mode_ == "pattern") {
+        return get_seasonal_pattern()->get_seasonal_factor(today, location);
+      }
+    }
+    return 1.0;
+  }
+
   bool enable_ = false;
   std::string mode_;
   std::unique_ptr<SeasonalEquation> seasonal_equation_{nullptr};
   std::unique_ptr<SeasonalRainfall> seasonal_rainfall_{nullptr};
   std::unique_ptr<SeasonalPattern> seasonal_pattern_{nullptr};
+
+  // Factor table, row-major with one row of number_of_locations_ factors per
+  // distinct day, and the row of each day of year in a common [0] and a leap
+  // [1] year
+  size_t number_of_locations_{0};
+  std::vector<double> factor_table_;
+  std::array<std::array<int, 366>, 2> row_of_day_{};
 };
 
 namespace YAML {
@@ -2,6 +2,7 @@
 #define STRATEGYPARAMETERS_H
 
 #include <yaml-cpp/yaml.h>
+#include <algorithm>
 #include <stdexcept>
 #include <map>
 #include <vector>
@@ -97,7 +98,19 @@ public:
         void set_mda_therapy_id(const int value) { mda_therapy_id_ = value; }
 
         [[nodiscard]] const std::vector<int>& get_age_bracket_prob_individual_present_at_mda() const { return age_bracket_prob_individual_present_at_mda_; }
-        void set_age_bracket_prob_individual_present_at_mda(const std::vector<int>& value) { age_bracket_prob_individual_present_at_mda_ = value; }
+        void set_age_bracket_prob_individual_present_at_mda(const std::vector<int>& value) {
+          age_bracket_prob_individual_present_at_mda_ = value;
+          build_age_bracket_table();
+        }
+
+        // Index of the first age bracket the age does not exceed, or the number
+        // of brackets when the age exceeds them all
+        [[nodiscard]] int age_bracket_of(int age) const {
+          if (age >= 0 && age < static_cast<int>(age_bracket_table_.size())) {
+            return age_bracket_table_[age];
+          }
+          return age < 0 ? 0 : static_cast<int>(age_bracket_prob_individual_present_at_mda_.size());
+        }
 
         [[nodiscard]] const std::vector<double>& get_mean_prob_individual_present_at_mda() const { return mean_prob_individual_present_at_mda_; }
         void set_mean_prob_individual_present_at_mda(const std::vector<double>& value) { mean_prob_individual_present_at_mda_ = value; }
@@ -105,13 +118,31 @@ public:
         [[nodiscard]] const std::vector<double>& get_sd_prob_individual_present_at_mda() const { return sd_prob_individual_present_at_mda_; }
         void set_sd_prob_individual_present_at_mda(const std::vector<double>& value) { sd_prob_individual_present_at_mda_ = value; }
 
-        std::vector<beta_distribution_params> get_prob_individual_present_at_mda_distribution() { return prob_individual_present_at_mda_distribution_; }
+        [[nodiscard]] const std::vector<beta_distribution_params>& get_prob_individual_present_at_mda_distribution() const { return prob_individual_present_at_mda_distribution_; }
         void set_prob_individual_present_at_mda_distribution(const std::vector<beta_distribution_params>& value) { prob_individual_present_at_mda_distribution_ = value; }
 
     private:
+        // Age bracket of every age up to the largest bracket, so looking it up
+        // does not scan the brackets
+        void build_age_bracket_table() {
+          age_bracket_table_.clear();
+          if (age_bracket_prob_individual_present_at_mda_.empty()) { return; }
+          const auto max_age = *std::max_element(age_bracket_prob_individual_present_at_mda_.begin(),
+                                                 age_bracket_prob_individual_present_at_mda_.end());
+          for (auto age = 0; age <= max_age; age++) {
+            auto index = 0;
+            while (index < static_cast<int>(age_bracket_prob_individual_present_at_mda_.size())
+                   && age > age_bracket_prob_individual_present_at_mda_[index]) {
+              index++;
+            }
+            age_bracket_table_.push_back(index);
+          }
+        }
+
         bool enable_ = false;
         int mda_therapy_id_ = -1;
         std::vector<int> age_bracket_prob_individual_present_at_mda_;
+        std::vector<int> age_bracket_table_;
         std::vector<double> mean_prob_individual_present_at_mda_;
         std::vector<double> sd_prob_individual_present_at_mda_;
         std::vector<beta_distribution_params> prob_individual_present_at_mda_distribution_;
@@ -127,7 +158,7 @@ public:
     [[nodiscard]] int get_recurrent_therapy_id() const { return recurrent_therapy_id_; }
     void set_recurrent_therapy_id(const int &value) { recurrent_therapy_id_ = value; }
 
-    [[nodiscard]] MassDrugAdministration get_mda() const { return mass_drug_administration_; }
+    [[nodiscard]] const MassDrugAdministration& get_mda() const { return mass_drug_administration_; }
     void set_mass_drug_administration(const MassDrugAdministration& value) { mass_drug_administration_ = value; }
 
     [[nodiscard]] const YAML::Node& get_node() const { return node_; }
@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 
+#include "Core/Scheduler/EventTelemetry.h"
 #include "spdlog/spdlog.h"
 
 template <typename EventType>
@@ -38,6 +39,7 @@ public:
     while (!events_.empty() && events_.begin()->first <= time) {
       // take the first event
       auto event = events_.begin()->second.get();
+      if (event->get_telemetry_type() >= 0) { EventTelemetry::get_instance().on_executed(event); }
       // execute the event
       event->execute();
       // set the event as not executable
@@ -51,6 +53,9 @@ public:
   void schedule_event(std::unique_ptr<EventType> event) {
     if (event) {
       event->set_executable(true);
+      if (EventTelemetry::get_instance().is_enabled()) {
+        EventTelemetry::get_instance().on_scheduled(event.get());
+      }
       events_.emplace(event->get_time(), std::move(event));
     }
   }
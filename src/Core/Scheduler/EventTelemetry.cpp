@@ -0,0 +1,148 @@
+#include "EventTelemetry.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <typeinfo>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "Events/Event.h"
+
+namespace {
+// A std::multimap node holds the colour and three links of the red-black tree
+// next to the (time, unique_ptr) value
+constexpr std::size_t MULTIMAP_NODE_BYTES =
+    4 * sizeof(void*) + sizeof(std::pair<const int, std::unique_ptr<Event>>);
+}  // namespace
+
+int EventTelemetry::register_type(const Event* event) {
+  const std::type_index key{typeid(*event)};
+  if (auto it = type_ids_.find(key); it != type_ids_.end()) { return it->second; }
+
+  // The object size is only known through the allocation, measure it once on
+  // the most derived object and assume every event of the type matches
+  std::size_t object_bytes = sizeof(Event);
+#ifdef __GLIBC__
+  object_bytes = malloc_usable_size(const_cast<void*>(dynamic_cast<const void*>(event)));
+#endif
+
+  const auto id = static_cast<int>(counters_.size());
+  counters_.push_back(Counters{.name = event->name(),
+                               .bytes_per_event = object_bytes + MULTIMAP_NODE_BYTES});
+  last_sample_.push_back(Counters{.name = counters_.back().name});
+  type_ids_.emplace(key, id);
+  return id;
+}
+
+void EventTelemetry::on_scheduled(Event* event) {
+  if (event->get_telemetry_type() < 0) { event->set_telemetry_type(register_type(event)); }
+  auto &counters = counters_[event->get_telemetry_type()];
+  counters.scheduled++;
+  counters.pending++;
+}
+
+void EventTelemetry::on_executed(const Event* event) {
+  auto &counters = counters_[event->get_telemetry_type()];
+  if (event->is_executable()) {
+    counters.executed++;
+  } else {
+    counters.stale++;
+  }
+}
+
+int64_t EventTelemetry::get_total_pending() const {
+  return std::accumulate(counters_.begin(), counters_.end(), int64_t{0},
+                         [](int64_t sum, const Counters &c) { return sum + c.pending; });
+}
+
+std::size_t EventTelemetry::get_pending_bytes() const {
+  std::size_t bytes = 0;
+  for (const auto &counters : counters_) {
+    if (counters.pending > 0) {
+      bytes += static_cast<std::size_t>(counters.pending) * counters.bytes_per_event;
+    }
+  }
+  return bytes;
+}
+
+void EventTelemetry::set_metrics_path(const std::string &path) {
+  if (metrics_file_.is_open()) { metrics_file_.close(); }
+  metrics_path_ = path;
+  if (path.empty()) { return; }
+
+  metrics_file_.open(path);
+  if (!metrics_file_.is_open()) {
+    spdlog::error("EventTelemetry: unable to open metrics file {}", path);
+    return;
+  }
+  metrics_file_ << "day,event,scheduled,executed,cancelled,stale,pending,pending_bytes\n";
+}
+
+void EventTelemetry::sample(int day) {
+  if (!enabled_) { return; }
+
+  for (std::size_t id = 0; id < counters_.size(); id++) {
+    const auto &current = counters_[id];
+    auto &last = last_sample_[id];
+    const auto scheduled = current.scheduled - last.scheduled;
+    const auto executed = current.executed - last.executed;
+    const auto cancelled = current.cancelled - last.cancelled;
+    const auto stale = current.stale - last.stale;
+
+    const auto idle = scheduled == 0 && executed == 0 && cancelled == 0 && stale == 0;
+    if (metrics_file_.is_open() && (!idle || current.pending > 0)) {
+      metrics_file_ << fmt::format(
+          "{},{},{},{},{},{},{},{}\n", day, current.name, scheduled, executed, cancelled, stale,
+          current.pending,
+          std::max<int64_t>(current.pending, 0) * static_cast<int64_t>(current.bytes_per_event));
+    }
+    last = current;
+  }
+}
+
+void EventTelemetry::log_summary(int day) const {
+  if (!enabled_ || counters_.empty()) { return; }
+
+  const auto busiest = std::ranges::max_element(
+      counters_, [](const Counters &lhs, const Counters &rhs) { return lhs.pending < rhs.pending; });
+  spdlog::info("Day {}: {} pending events ({:.2f} MB), most pending: {} ({})", day,
+               get_total_pending(), static_cast<double>(get_pending_bytes()) / (1024.0 * 1024.0),
+               busiest->name, busiest->pending);
+}
+
+void EventTelemetry::report() const {
+  if (!enabled_ || counters_.empty()) { return; }
+
+  std::vector<int> order(counters_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, [this](int lhs, int rhs) {
+    return counters_[lhs].scheduled > counters_[rhs].scheduled;
+  });
+
+  spdlog::info("Event telemetry summary:");
+  spdlog::info("{:<40} {:>12} {:>12} {:>12} {:>12} {:>10}", "event", "scheduled", "executed",
+               "cancelled", "stale", "pending");
+  for (const auto id : order) {
+    const auto &counters = counters_[id];
+    spdlog::info("{:<40} {:>12} {:>12} {:>12} {:>12} {:>10}", counters.name, counters.scheduled,
+                 counters.executed, counters.cancelled, counters.stale, counters.pending);
+  }
+  spdlog::info("Pending at end of run: {} events ({:.2f} MB)", get_total_pending(),
+               static_cast<double>(get_pending_bytes()) / (1024.0 * 1024.0));
+}
+
+void EventTelemetry::reset() {
+  // Events already in the queues keep their type id, so keep the registrations
+  for (std::size_t id = 0; id < counters_.size(); id++) {
+    counters_[id] = Counters{.name = counters_[id].name,
+                             .bytes_per_event = counters_[id].bytes_per_event};
+    last_sample_[id] = Counters{.name = counters_[id].name};
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * EventTelemetry.h
+ *
+ * Per-event-type counters for the event queues. Every event scheduled through
+ * an EventManager is tagged with a small type id on first sight; from then on
+ * the telemetry counts how many events of that type were
+ *
+ *   scheduled  - handed to EventManager::schedule_event
+ *   executed   - reached their time while still executable
+ *   cancelled  - marked as not executable before reaching their time
+ *   stale      - reached their time after having been cancelled
+ *
+ * together with the number of events still pending and an estimate of the
+ * memory they hold (object plus multimap node). The telemetry is sampled once
+ * a day by the scheduler, optionally to a CSV metrics file, and a cumulative
+ * summary is logged at the end of the run.
+ *
+ * Collection is off unless enabled from the command line (--event-telemetry /
+ * --event-metrics); when off, events are never tagged and the hooks reduce to
+ * a single branch.
+ */
+#ifndef EVENT_TELEMETRY_H
+#define EVENT_TELEMETRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+class Event;
+
+class EventTelemetry {
+public:
+  struct Counters {
+    std::string name;
+    uint64_t scheduled{0};
+    uint64_t executed{0};
+    uint64_t cancelled{0};
+    uint64_t stale{0};
+    int64_t pending{0};
+    // Estimated bytes held by one pending event of this type
+    std::size_t bytes_per_event{0};
+  };
+
+  EventTelemetry(const EventTelemetry &) = delete;
+  EventTelemetry &operator=(const EventTelemetry &) = delete;
+  EventTelemetry(EventTelemetry &&) = delete;
+  EventTelemetry &operator=(EventTelemetry &&) = delete;
+
+  static EventTelemetry &get_instance() {
+    // Never destroyed, events owned by the Model singleton may be released
+    // after function-local statics and still report their destruction
+    static auto* instance = new EventTelemetry();
+    return *instance;
+  }
+
+  [[nodiscard]] bool is_enabled() const { return enabled_; }
+  void set_enabled(bool value) { enabled_ = value; }
+
+  // Write one row per event type and day to the given CSV file, an empty path
+  // closes the file
+  void set_metrics_path(const std::string &path);
+  [[nodiscard]] const std::string &get_metrics_path() const { return metrics_path_; }
+  // Write out the buffered rows, e.g. before the process is forked
+  void flush_metrics() {
+    if (metrics_file_.is_open()) { metrics_file_.flush(); }
+  }
+
+  // Hooks called by EventManager and Event
+  void on_scheduled(Event* event);
+  void on_executed(const Event* event);
+  void on_cancelled(int type_id) { counters_[type_id].cancelled++; }
+  void on_destroyed(int type_id) { counters_[type_id].pending--; }
+
+  [[nodiscard]] const std::vector<Counters> &get_counters() const { return counters_; }
+  [[nodiscard]] int64_t get_total_pending() const;
+  [[nodiscard]] std::size_t get_pending_bytes() const;
+
+  // Write the counters accumulated since the previous sample to the metrics
+  // file, pending counts are written as they are
+  void sample(int day);
+
+  // Log the total pending events and the busiest event type
+  void log_summary(int day) const;
+
+  // Log the cumulative counters of every event type
+  void report() const;
+
+  // Zero all counters, registered event types are kept
+  void reset();
+
+private:
+  EventTelemetry() = default;
+  ~EventTelemetry() = default;
+
+  int register_type(const Event* event);
+
+  bool enabled_{false};
+  std::string metrics_path_;
+  std::ofstream metrics_file_;
+
+  std::vector<Counters> counters_;
+  // Counters at the previous sample, used to write daily deltas
+  std::vector<Counters> last_sample_;
+  std::unordered_map<std::type_index, int> type_ids_;
+};
+
+#endif  // EVENT_TELEMETRY_H
@@ -2,9 +2,13 @@
 
 #include <Configuration/Config.h>
 
+#include <limits>
+
+#include "EventTelemetry.h"
 #include "Population/Population.h"
 #include "Simulation/Model.h"
 #include "Utils/Helpers/TimeHelpers.h"
+#include "Utils/Profiler.h"
 #include "spdlog/spdlog.h"
 
 Scheduler::Scheduler() = default;
@@ -20,14 +24,28 @@ void Scheduler::initialize(const date::year_month_day &starting_date,
 
 void Scheduler::run() {
   current_time_ = 0;
-  for (current_time_ = 0; !can_stop(); current_time_++) {
+  run_until(std::numeric_limits<int>::max());
+}
+
+void Scheduler::run_until(int day) {
+  for (; !can_stop() && current_time_ < day; current_time_++) {
     if (current_time_ % Model::get_config()->get_model_settings().get_days_between_stdout_output()
         == 0) {
       spdlog::info("Day: {}", current_time_);
     }
+    MALASIM_PROFILE_SET_DAY(current_time_);
+    MALASIM_PROFILE_SCOPE("Scheduler::day");
     begin_time_step();
     daily_update();
     end_time_step();
+    if (EventTelemetry::get_instance().is_enabled()) {
+      EventTelemetry::get_instance().sample(current_time_);
+      if (current_time_
+              % Model::get_config()->get_model_settings().get_days_between_stdout_output()
+          == 0) {
+        EventTelemetry::get_instance().log_summary(current_time_);
+      }
+    }
     calendar_date_ += date::days{1};
   }
 }
@@ -38,17 +56,44 @@ void Scheduler::begin_time_step() {
 
 void Scheduler::daily_update() {
   if (Model::get_instance() != nullptr) {
-    Model::get_instance()->daily_update();
+    {
+      MALASIM_PROFILE_SCOPE("Model::daily_update");
+      Model::get_instance()->daily_update();
+    }
 
-    if (is_today_first_day_of_month()) { Model::get_instance()->monthly_update(); }
+    if (is_today_first_day_of_month()) {
+      MALASIM_PROFILE_SCOPE("Model::monthly_update");
+      Model::get_instance()->monthly_update();
+    }
 
-    if (is_today_first_day_of_year()) { Model::get_instance()->yearly_update(); }
+    if (is_today_first_day_of_year()) {
+      MALASIM_PROFILE_SCOPE("Model::yearly_update");
+      Model::get_instance()->yearly_update();
+    }
 
-    // Execute world/population events
-    world_events_.execute_events(current_time_);
+    {
+      // Execute world/population events
+      MALASIM_PROFILE_SCOPE("Scheduler::world_events");
+      world_events_.execute_events(current_time_);
+    }
+
+    {
+      // Age today's birthday cohort in one pass instead of per-person events
+      MALASIM_PROFILE_SCOPE("Population::perform_birthday_event");
+      Model::get_population()->perform_birthday_event();
+    }
 
-    // Update individual events through the population
-    Model::get_population()->execute_all_individual_events(current_time_);
+    {
+      // Move today's liver parasites to the blood in one pass
+      MALASIM_PROFILE_SCOPE("Population::perform_move_parasite_to_blood_event");
+      Model::get_population()->perform_move_parasite_to_blood_event();
+    }
+
+    {
+      // Update individual events through the population
+      MALASIM_PROFILE_SCOPE("Population::execute_all_individual_events");
+      Model::get_population()->execute_all_individual_events(current_time_);
+    }
   }
 }
 
@@ -47,6 +47,8 @@ public:
                   const date::year_month_day &ending_date);
 
   void run();
+  // Continue the run from the current day, stop before simulating the given day
+  void run_until(int day);
   void begin_time_step();
   void end_time_step();
   void daily_update();
@@ -4,6 +4,9 @@ SeasonalRainfall::SeasonalRainfall() = default;
 
 void SeasonalRainfall::build() {
   read(filename_);
+  if (adjustments_.empty()) {
+    throw std::invalid_argument("The rainfall data file has no data points: " + filename_);
+  }
   if (adjustments_.size() != period_) {
     throw std::invalid_argument(fmt::format(
         "The number of rainfall data points ({}) should match the period ({}).",
@@ -14,7 +17,10 @@ void SeasonalRainfall::build() {
 double SeasonalRainfall::get_seasonal_factor(const date::sys_days &today, const int &location) {
   int doy = TimeHelpers::day_of_year(today);
   doy = (doy == 366) ? doy - 2 : doy - 1;
-  return adjustments_[doy];
+  // Not built yet, no seasonal effect
+  if (adjustments_.empty()) { return 1.0; }
+  // Data with a period shorter than a year repeats
+  return adjustments_[doy % adjustments_.size()];
 }
 
 void SeasonalRainfall::read(const std::string &filename) {
@@ -24,6 +24,10 @@ private:
 
     auto* seasons = Model::get_config()->get_seasonality_settings().get_seasonal_equation();
     seasons->update_seasonality(from_, to_);
+
+    // Transmission and the reporters read the precomputed factors
+    Model::get_config()->get_seasonality_settings().build_seasonal_factor_table(
+        Model::get_config()->number_of_locations());
   }
 
 public:
@@ -1,6 +1,7 @@
 #include "Event.h"
 
 #include <Core/Scheduler/EventManager.h>
+#include <Core/Scheduler/EventTelemetry.h>
 #include <spdlog/spdlog.h>
 
 #include <iostream>
@@ -17,4 +18,12 @@ void Event::execute() {
     }
     executable_ = false;
   }
-}
\ No newline at end of file
+}
+
+Event::~Event() {
+  if (telemetry_type_ >= 0) { EventTelemetry::get_instance().on_destroyed(telemetry_type_); }
+}
+
+void Event::record_cancelled() const {
+  EventTelemetry::get_instance().on_cancelled(telemetry_type_);
+}
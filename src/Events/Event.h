@@ -1,6 +1,7 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <cstdint>
 #include <string>
 
 class Event {
@@ -14,7 +15,7 @@ public:
   Event& operator=(Event&&) = delete;
 
   Event() = default;
-  virtual ~Event() = default;
+  virtual ~Event();
 
   // Public interface
   void execute();  // Non-virtual public interface (Template Method)
@@ -22,17 +23,27 @@ public:
 
   // Public state management
   [[nodiscard]] bool is_executable() const { return executable_; }
-  void set_executable(bool value) { executable_ = value; }
+  void set_executable(bool value) {
+    if (executable_ && !value && telemetry_type_ >= 0) { record_cancelled(); }
+    executable_ = value;
+  }
 
   [[nodiscard]] int get_time() const { return time_; }
   void set_time(int value) { time_ = value; }
 
+  // Event type id assigned by EventTelemetry, -1 when telemetry is off
+  [[nodiscard]] int get_telemetry_type() const { return telemetry_type_; }
+  void set_telemetry_type(int value) { telemetry_type_ = static_cast<int16_t>(value); }
+
 protected:
   // Protected interface for derived classes
   virtual void do_execute() = 0;  // Hook method for derived classes
 
 private:
+  void record_cancelled() const;
+
   bool executable_{false};
+  int16_t telemetry_type_{-1};
   int time_{-1};
 };
 
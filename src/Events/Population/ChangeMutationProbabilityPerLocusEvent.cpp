@@ -14,6 +14,7 @@ ChangeMutationProbabilityPerLocusEvent::ChangeMutationProbabilityPerLocusEvent(c
 }
 void ChangeMutationProbabilityPerLocusEvent::do_execute() {
     Model::get_config()->get_genotype_parameters().set_mutation_probability_per_locus(value);
+    Model::get_config()->refresh_run_constants();
     spdlog::info("{}: Change mutation probability per locus to {}",
       Model::get_scheduler()->get_current_date_string(),value);
 }
\ No newline at end of file
@@ -43,11 +43,9 @@ void ImportationPeriodicallyEvent::do_execute() {
   for (auto i = 0; i < number_of_importation_cases; i++) {
     std::size_t ind_ac = Model::get_random()->random_uniform(
         static_cast<unsigned long>(pi->vPerson()[location_][0].size()));
-    if (pi->vPerson()[location_][0][ind_ac].empty()) { continue; }
-
-    std::size_t index = Model::get_random()->random_uniform(
-        pi->vPerson()[location_][0][ind_ac].size());
-    auto* p = pi->vPerson()[location_][0][ind_ac][index];
+    // Aggregated susceptibles are promoted when they are picked
+    auto* p = Model::get_population()->sample_susceptible(location_, static_cast<int>(ind_ac));
+    if (p == nullptr) { continue; }
 
     p->get_immune_system()->set_increase(true);
     p->set_host_state(Person::ASYMPTOMATIC);
@@ -39,14 +39,14 @@ void ImportationPeriodicallyRandomEvent::do_execute() {
     do {
       age_class = Model::get_random()->random_uniform(static_cast<unsigned long>(
           pi->vPerson()[location][Person::HostStates::SUSCEPTIBLE].size()));
-    } while (pi->vPerson()[location][0][age_class].empty());
+    } while (Model::get_population()->size(static_cast<int>(location),
+                                           Person::HostStates::SUSCEPTIBLE,
+                                           static_cast<int>(age_class))
+             == 0);
 
-    // Get the individual
-    unsigned long index = Model::get_random()->random_uniform(
-        pi->vPerson()[location][Person::HostStates::SUSCEPTIBLE][age_class]
-            .size());
-    auto* person = pi->vPerson()[location][Person::HostStates::SUSCEPTIBLE]
-                                [age_class][index];
+    // Get the individual, aggregated susceptibles are promoted when picked
+    auto* person = Model::get_population()->sample_susceptible(
+        static_cast<int>(location), static_cast<int>(age_class));
 
     // Inflict the infection
     infect(person, genotypeId_);
@@ -90,9 +90,9 @@ std::size_t ImportationPeriodicallyRandomEvent::get_location() {
   auto population = 0ul;
   for (std::size_t location = 0; location < locations; location++) {
     for (std::size_t age_class = 0; age_class < age_classes; age_class++) {
-      population +=
-          pi->vPerson()[location][Person::HostStates::SUSCEPTIBLE][age_class]
-              .size();
+      population += Model::get_population()->size(static_cast<int>(location),
+                                                  Person::HostStates::SUSCEPTIBLE,
+                                                  static_cast<int>(age_class));
     }
   }
 
@@ -105,14 +105,11 @@ std::size_t ImportationPeriodicallyRandomEvent::get_location() {
     // Note we have to check for each age class since we don't know exactly how
     // many individuals are in a given location otherwise
     for (std::size_t age_class = 0; age_class < age_classes; age_class++) {
-      if (target
-          < pi->vPerson()[location][Person::HostStates::SUSCEPTIBLE][age_class]
-                .size()) {
-        return location;
-      }
-      target -=
-          pi->vPerson()[location][Person::HostStates::SUSCEPTIBLE][age_class]
-              .size();
+      const auto susceptibles = Model::get_population()->size(
+          static_cast<int>(location), Person::HostStates::SUSCEPTIBLE,
+          static_cast<int>(age_class));
+      if (target < susceptibles) { return location; }
+      target -= susceptibles;
     }
   }
 
@@ -12,6 +12,7 @@
 #include "Population/Population.h"
 #include "Utils/Helpers/StringHelpers.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/Logger.h"
 
 double IntroduceMutantEventBase::calculate(std::vector<int> &locations) const {
   double mutant_fraction = 0.0;
@@ -61,8 +62,8 @@ int IntroduceMutantEventBase::mutate(std::vector<int> &locations,
                         + pi->vPerson()[location][Person::CLINICAL][ac].size();
 
       if (infections > 0) {
-        spdlog::trace("mutate location: {}, age class: {}, infections: {}",
-                      location, ac, infections);
+        MALASIM_LOG_HOT_TRACE("mutate location: {}, age class: {}, infections: {}",
+                              location, ac, infections);
       }
       // Use a Poisson distribution to determine the number of mutations in this
       // location
@@ -97,7 +98,7 @@ int IntroduceMutantEventBase::mutate(std::vector<int> &locations,
           auto* old_genotype = pp->genotype();
           auto* new_genotype =
               old_genotype->modify_genotype_allele(alleles_, Model::get_config());
-          spdlog::trace("location {} Introduce mutant new genotype: {}", location,new_genotype->get_aa_sequence());
+          MALASIM_LOG_HOT_TRACE("location {} Introduce mutant new genotype: {}", location,new_genotype->get_aa_sequence());
           pp->set_genotype(new_genotype);
         }
       }
@@ -2,6 +2,8 @@
 
 #include "SingleRoundMDAEvent.h"
 
+#include <algorithm>
+
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Events/ReceiveMDATherapyEvent.h"
@@ -21,46 +23,75 @@ SingleRoundMDAEvent::SingleRoundMDAEvent(const int& at_time) {
 void SingleRoundMDAEvent::do_execute() {
   spdlog::info("{}: executing Single Round MDA", Model::get_scheduler()->get_current_date_string());
 
+  auto* population = Model::get_population();
+  auto* random = Model::get_random();
+  auto* pi_lsa = population->get_person_index<PersonIndexByLocationStateAgeClass>();
+  auto* compartment = population->susceptible_compartment();
+  const auto number_of_age_classes = Model::get_config()->number_of_age_classes();
+  const auto &mda = Model::get_config()->get_strategy_parameters().get_mda();
+  auto* therapy = Model::get_therapy_db()[mda.get_mda_therapy_id()].get();
+
+  // Reused by every location
+  std::vector<Person*> all_persons_in_location;
+  std::vector<Person*> targeted;
+
   // for all location
   for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
     // step 1: get number of individuals for MDA
-    auto* pi_lsa = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
-    std::vector<Person*> all_persons_in_location;
+    all_persons_in_location.clear();
     for (auto hs = 0; hs < Person::DEAD; hs++) {
-      for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
-        for (auto* person : pi_lsa->vPerson()[loc][hs][ac]) {
-          all_persons_in_location.push_back(person);
-        }
+      for (auto ac = 0; ac < number_of_age_classes; ac++) {
+        const auto &persons = pi_lsa->vPerson()[loc][hs][ac];
+        all_persons_in_location.insert(all_persons_in_location.end(), persons.begin(),
+                                       persons.end());
       }
     }
 
-    const auto number_indidividuals_in_location = all_persons_in_location.size();
-    auto number_of_individuals_will_receive_mda = Model::get_random()->random_poisson(
-        fraction_population_targeted[loc] * number_indidividuals_in_location);
-
-    number_of_individuals_will_receive_mda =
-        number_of_individuals_will_receive_mda > number_indidividuals_in_location
-            ? number_indidividuals_in_location
-            : number_of_individuals_will_receive_mda;
-    // shuffle app_persons_in_location index for sampling without replacement
-    Model::get_random()->shuffle(all_persons_in_location);
+    const auto number_of_aggregated =
+        compartment == nullptr ? 0 : static_cast<std::size_t>(compartment->size(loc));
 
-    for (auto p_i = 0; p_i < number_of_individuals_will_receive_mda; p_i++) {
-      auto* person = all_persons_in_location[p_i];
-      // step 2: determine whether person will receive treatment
-      const auto prob = Model::get_random()->random_flat(0.0, 1.0);
-      if (prob < person->prob_present_at_mda()) {
-        // receive MDA
-        auto* therapy =
-            Model::get_therapy_db()
-                [Model::get_config()->get_strategy_parameters().get_mda().get_mda_therapy_id()]
-                    .get();
-        // schedule received therapy in within days_to_complete_all_treatments
-        int days_to_receive_mda_therapy =
-            Model::get_random()->random_uniform(days_to_complete_all_treatments) + 1;
+    const auto number_indidividuals_in_location =
+        all_persons_in_location.size() + number_of_aggregated;
+    if (number_indidividuals_in_location == 0) { continue; }
+    const auto number_targeted = std::min(
+        static_cast<std::size_t>(random->random_poisson(fraction_population_targeted[loc]
+                                                        * number_indidividuals_in_location)),
+        number_indidividuals_in_location);
 
-        person->schedule_receive_mda_therapy_event(therapy, days_to_receive_mda_therapy);
+    targeted.clear();
+    if (number_of_aggregated > 0) {
+      // Promote the aggregated susceptibles that are targeted, in proportion
+      // to their share of the location, and put them first in line
+      auto number_of_promotions = static_cast<std::size_t>(random->random_binomial(
+          static_cast<double>(number_of_aggregated)
+              / static_cast<double>(number_indidividuals_in_location),
+          static_cast<unsigned int>(number_targeted)));
+      number_of_promotions = std::clamp(
+          number_of_promotions,
+          number_targeted - std::min(number_targeted, all_persons_in_location.size()),
+          std::min(number_targeted, number_of_aggregated));
+      for (std::size_t i = 0; i < number_of_promotions; i++) {
+        targeted.push_back(
+            population->promote_susceptible(loc, compartment->remove_uniform(loc, -1, random)));
       }
     }
+
+    // Sample the rest without replacement, only the targeted part of the
+    // persons is shuffled
+    const auto number_of_persons = all_persons_in_location.size();
+    for (auto i = std::size_t{0}; targeted.size() < number_targeted; i++) {
+      const auto j = i + random->random_uniform(number_of_persons - i);
+      std::swap(all_persons_in_location[i], all_persons_in_location[j]);
+      targeted.push_back(all_persons_in_location[i]);
+    }
+
+    // step 2: determine whether person will receive treatment and schedule
+    // the therapy within days_to_complete_all_treatments
+    for (auto* person : targeted) {
+      if (random->random_flat(0.0, 1.0) >= person->prob_present_at_mda()) { continue; }
+      const auto days_to_receive_mda_therapy =
+          static_cast<int>(random->random_uniform(days_to_complete_all_treatments)) + 1;
+      person->schedule_receive_mda_therapy_event(therapy, days_to_receive_mda_therapy);
+    }
   }
 }
@@ -11,6 +11,7 @@ TurnOffMutationEvent::TurnOffMutationEvent(const int &at_time) {
 
 void TurnOffMutationEvent::do_execute() {
   Model::get_config()->get_genotype_parameters().set_mutation_probability_per_locus(0.0);
+  Model::get_config()->refresh_run_constants();
   spdlog::info("{}: turn mutation off",
     Model::get_scheduler()->get_current_date_string());
 }
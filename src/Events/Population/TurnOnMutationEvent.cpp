@@ -12,6 +12,7 @@ TurnOnMutationEvent::TurnOnMutationEvent(const int& at_time, const double& mutat
 
 void TurnOnMutationEvent::do_execute() {
   Model::get_config()->get_genotype_parameters().set_mutation_probability_per_locus(mutation_probability);
+  Model::get_config()->refresh_run_constants();
     spdlog::info("{}: turn mutation on with probability {}",
         Model::get_scheduler()->get_current_date_string(),
         mutation_probability);
@@ -49,16 +49,7 @@ std::pair<Therapy*, bool> ProgressToClinicalEvent::determine_therapy(Person* per
   if (strategy != nullptr) {
     // if the strategy is NestedMFT and the therapy is the public sector
     const auto probability = Model::get_random()->random_flat(0.0, 1.0);
-
-    double sum = 0;
-    std::size_t s_id = -1;
-    for (std::size_t i = 0; i < strategy->distribution.size(); i++) {
-      sum += strategy->distribution[i];
-      if (probability <= sum) {
-        s_id = i;
-        break;
-      }
-    }
+    const auto s_id = strategy->select_strategy(probability);
     // this is public sector
     if (s_id == 0) {
       if (is_recurrence
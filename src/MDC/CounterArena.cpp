@@ -0,0 +1,68 @@
+/*
+ * CounterArena.cpp
+ *
+ * Implement the CounterArena class.
+ */
+#include "CounterArena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace {
+std::size_t align_up(std::size_t value, std::size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+void CounterArena::AlignedDelete::operator()(std::byte* data) const {
+  ::operator delete[](data, std::align_val_t{GROUP_ALIGNMENT});
+}
+
+CounterArena::Storage CounterArena::allocate_zeroed(std::size_t size) {
+  auto* data = static_cast<std::byte*>(
+      ::operator new[](std::max<std::size_t>(size, 1), std::align_val_t{GROUP_ALIGNMENT}));
+  std::memset(data, 0, size);
+  return Storage(data);
+}
+
+void CounterArena::allocate() {
+  // Keep the registration order within a group
+  std::vector<std::size_t> order(entries_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+    return entries_[lhs].group < entries_[rhs].group;
+  });
+
+  groups_.clear();
+  std::size_t offset = 0;
+  for (const auto index : order) {
+    auto &entry = entries_[index];
+    if (entry.group >= groups_.size()) {
+      offset = align_up(offset, GROUP_ALIGNMENT);
+      groups_.resize(entry.group + 1, {offset, offset});
+    }
+    offset = align_up(offset, entry.alignment);
+    entry.offset = offset;
+    offset += entry.bytes;
+    groups_[entry.group].second = offset;
+  }
+  size_ = align_up(offset, GROUP_ALIGNMENT);
+
+  data_ = allocate_zeroed(size_);
+  for (const auto &entry : entries_) { entry.bind(data_.get() + entry.offset); }
+}
+
+void CounterArena::clear() {
+  entries_.clear();
+  groups_.clear();
+  data_.reset();
+  size_ = 0;
+}
+
+void CounterArena::reset(std::size_t group) {
+  if (group >= groups_.size()) { return; }
+  const auto [begin, end] = groups_[group];
+  std::memset(data_.get() + begin, 0, end - begin);
+}
@@ -0,0 +1,174 @@
+/*
+ * CounterArena.h
+ *
+ * Contiguous storage for the counters of the ModelDataCollector. Each counter
+ * is a dense tensor (e.g. location x age class) registered with a reset group;
+ * the counters of a group are laid out next to each other so resetting the
+ * group is a single memset. The counters themselves are lightweight views
+ * that index like the nested vectors they replace, e.g. counter[loc][ac].
+ */
+#ifndef COUNTERARENA_H
+#define COUNTERARENA_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "Utils/TypeDef.h"
+
+// View of a dense row-major tensor stored in a CounterArena
+template <typename T, std::size_t Rank>
+class Counter {
+  static_assert(Rank >= 1, "A counter needs at least one dimension.");
+
+public:
+  using Row = std::conditional_t<Rank == 1, T &, Counter<T, Rank - 1>>;
+
+  class Iterator {
+  public:
+    Iterator(T* data, const Counter* counter) : data_(data), counter_(counter) {}
+    Row operator*() const { return counter_->row_at(data_); }
+    Iterator &operator++() {
+      data_ += counter_->row_size();
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const { return data_ != other.data_; }
+    bool operator==(const Iterator &other) const { return data_ == other.data_; }
+
+  private:
+    T* data_;
+    const Counter* counter_;
+  };
+
+  Counter() = default;
+  Counter(T* data, const std::array<std::size_t, Rank> &extents)
+      : data_(data), extents_(extents) {}
+
+  Row operator[](std::size_t index) const { return row_at(data_ + (index * row_size())); }
+
+  [[nodiscard]] std::size_t size() const { return extents_[0]; }
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] const std::array<std::size_t, Rank> &extents() const { return extents_; }
+
+  // Number of elements in the whole tensor
+  [[nodiscard]] std::size_t element_count() const { return extents_[0] * row_size(); }
+
+  [[nodiscard]] T* data() const { return data_; }
+
+  // Plain pointers for a single dimension so the standard algorithms apply
+  auto begin() const {
+    if constexpr (Rank == 1) {
+      return data_;
+    } else {
+      return Iterator(data_, this);
+    }
+  }
+  auto end() const {
+    if constexpr (Rank == 1) {
+      return data_ + size();
+    } else {
+      return Iterator(data_ + element_count(), this);
+    }
+  }
+
+private:
+  template <typename, std::size_t>
+  friend class Counter;
+  friend class CounterArena;
+
+  [[nodiscard]] std::size_t row_size() const {
+    std::size_t size = 1;
+    for (std::size_t i = 1; i < Rank; i++) { size *= extents_[i]; }
+    return size;
+  }
+
+  Row row_at(T* row) const {
+    if constexpr (Rank == 1) {
+      return *row;
+    } else {
+      std::array<std::size_t, Rank - 1> extents{};
+      for (std::size_t i = 1; i < Rank; i++) { extents[i - 1] = extents_[i]; }
+      return Counter<T, Rank - 1>(row, extents);
+    }
+  }
+
+  T* data_{nullptr};
+  std::array<std::size_t, Rank> extents_{};
+};
+
+using IntCounter = Counter<int, 1>;
+using IntCounter2 = Counter<int, 2>;
+using IntCounter3 = Counter<int, 3>;
+using LongCounter = Counter<Ul, 1>;
+using LongCounter2 = Counter<Ul, 2>;
+using DoubleCounter = Counter<double, 1>;
+using DoubleCounter2 = Counter<double, 2>;
+
+class CounterArena {
+  struct AlignedDelete {
+    void operator()(std::byte* data) const;
+  };
+  using Storage = std::unique_ptr<std::byte[], AlignedDelete>;
+
+public:
+  // Disallow copy, the counters point into the arena
+  CounterArena(const CounterArena &) = delete;
+  CounterArena &operator=(const CounterArena &) = delete;
+
+  // Disallow move
+  CounterArena(CounterArena &&) = delete;
+  CounterArena &operator=(CounterArena &&) = delete;
+
+  CounterArena() = default;
+  ~CounterArena() = default;
+
+  // Counters of different groups are placed on different cache lines
+  static constexpr std::size_t GROUP_ALIGNMENT = 64;
+
+  // Register the counter, it is bound to zeroed storage by allocate()
+  template <typename T, std::size_t Rank>
+  void add(Counter<T, Rank> &counter, std::size_t group,
+           const std::array<std::size_t, Rank> &extents) {
+    static_assert(std::is_arithmetic_v<T>, "Counters hold arithmetic values.");
+    counter = Counter<T, Rank>(nullptr, extents);
+    entries_.push_back(Entry{group, counter.element_count() * sizeof(T), alignof(T),
+                             [&counter](std::byte* data) {
+                               counter.data_ = reinterpret_cast<T*>(data);
+                             }});
+  }
+
+  // Lay out the registered counters, grouped by reset group
+  void allocate();
+
+  // Release the storage and forget the registered counters
+  void clear();
+
+  // Zero every counter of the group
+  void reset(std::size_t group);
+
+  // Bytes used by the counters including padding
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+private:
+  struct Entry {
+    std::size_t group;
+    std::size_t bytes;
+    std::size_t alignment;
+    std::function<void(std::byte*)> bind;
+    std::size_t offset{0};
+  };
+
+  static Storage allocate_zeroed(std::size_t size);
+
+  std::vector<Entry> entries_;
+  // [begin, end) byte range of each group
+  std::vector<std::pair<std::size_t, std::size_t>> groups_;
+  Storage data_;
+  std::size_t size_{0};
+};
+
+#endif  // COUNTERARENA_H
@@ -0,0 +1,102 @@
+/*
+ * EventTally.h
+ *
+ * Count events by a fixed-size integer key (e.g. location, month, drug,
+ * from genotype, to genotype) instead of logging every event, so the memory
+ * used only depends on the number of distinct keys. Optionally a uniform
+ * sample of at most sample_capacity raw events, with the day they occurred,
+ * is kept next to the counts (reservoir sampling).
+ *
+ * The sampling uses its own generator so it does not consume numbers from
+ * the model's random stream.
+ */
+#ifndef EVENTTALLY_H
+#define EVENTTALLY_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Utils/TypeDef.h"
+
+template <std::size_t KeySize>
+class EventTally {
+public:
+  using Key = std::array<int, KeySize>;
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const {
+      // FNV-1a over the fields of the key
+      std::uint64_t hash = 14695981039346656037ULL;
+      for (const auto value : key) {
+        hash ^= static_cast<std::uint32_t>(value);
+        hash *= 1099511628211ULL;
+      }
+      return static_cast<std::size_t>(hash);
+    }
+  };
+
+  using Counts = std::unordered_map<Key, Ul, KeyHash>;
+
+  struct Sample {
+    int day;
+    Key key;
+  };
+
+  explicit EventTally(std::size_t sample_capacity = 0) : sample_capacity_(sample_capacity) {}
+
+  void record(int day, const Key &key) {
+    counts_[key]++;
+    total_++;
+    if (sample_capacity_ == 0) { return; }
+    if (samples_.size() < sample_capacity_) {
+      samples_.push_back(Sample{day, key});
+      return;
+    }
+    // Keep each of the events seen so far with the same probability
+    const auto index = std::uniform_int_distribution<Ul>(0, total_ - 1)(generator_);
+    if (index < sample_capacity_) { samples_[index] = Sample{day, key}; }
+  }
+
+  // Number of events per key, in unspecified order
+  [[nodiscard]] const Counts &counts() const { return counts_; }
+
+  // Number of events per key, ordered by key
+  [[nodiscard]] std::vector<std::pair<Key, Ul>> sorted_counts() const {
+    std::vector<std::pair<Key, Ul>> result(counts_.begin(), counts_.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  [[nodiscard]] const std::vector<Sample> &samples() const { return samples_; }
+
+  // Number of events recorded since the last clear()
+  [[nodiscard]] Ul total() const { return total_; }
+  [[nodiscard]] bool empty() const { return total_ == 0; }
+
+  [[nodiscard]] std::size_t sample_capacity() const { return sample_capacity_; }
+  void set_sample_capacity(std::size_t value) {
+    sample_capacity_ = value;
+    if (samples_.size() > sample_capacity_) { samples_.resize(sample_capacity_); }
+  }
+
+  void clear() {
+    counts_.clear();
+    samples_.clear();
+    total_ = 0;
+  }
+
+private:
+  Counts counts_;
+  std::vector<Sample> samples_;
+  std::size_t sample_capacity_;
+  Ul total_{0};
+  std::minstd_rand generator_;
+};
+
+#endif  // EVENTTALLY_H
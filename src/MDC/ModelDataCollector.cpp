@@ -20,10 +20,6 @@
 // Fill the vector indicated with zeros, this should compile into a memset call
 // which is faster than a loop
 #define zero_fill(vector) std::fill(vector.begin(), vector.end(), 0)
-#define zero_fill_matrix_2d(vector) \
-  std::for_each(vector.begin(), vector.end(), [](auto &v) { zero_fill(v); })
-#define zero_fill_matrix_3d(vector) \
-  std::for_each(vector.begin(), vector.end(), [](auto &v) { zero_fill_matrix_2d(v); })
 
 class PersonIndexByLocationStateAgeClass;
 
@@ -32,96 +28,136 @@ ModelDataCollector::ModelDataCollector(){}
 ModelDataCollector::~ModelDataCollector() = default;
 
 void ModelDataCollector::initialize() {
-    births_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    deaths_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    malaria_deaths_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    malaria_deaths_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-
-    popsize_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    popsize_residence_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-
-    blood_slide_prevalence_by_location_ =
-        DoubleVector(Model::get_config()->number_of_locations(), 0.0);
-    blood_slide_prevalence_by_location_age_group_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(Model::get_config()->number_of_age_classes(), 0.0));
-    blood_slide_number_by_location_age_group_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(Model::get_config()->number_of_age_classes(), 0.0));
-    blood_slide_prevalence_by_location_age_group_by_5_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(Model::get_config()->number_of_age_classes(), 0.0));
-    blood_slide_number_by_location_age_group_by_5_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(Model::get_config()->number_of_age_classes(), 0.0));
-    blood_slide_prevalence_by_location_age_ =
-        DoubleVector2(Model::get_config()->number_of_locations(), DoubleVector(80, 0.0));
-    blood_slide_number_by_location_age_ =
-        DoubleVector2(Model::get_config()->number_of_locations(), DoubleVector(80, 0.0));
-    blood_slide_number_by_location_age_group_by_5_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(Model::get_config()->number_of_age_classes(), 0.0));
-    fraction_of_positive_that_are_clinical_by_location_ =
-        DoubleVector(Model::get_config()->number_of_locations(), 0.0);
-    popsize_by_location_hoststate_ = IntVector2(Model::get_config()->number_of_locations(),
-                                                IntVector(Person::NUMBER_OF_STATE, 0));
-    popsize_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    popsize_by_location_age_class_by_5_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    popsize_by_location_hoststate_age_class_ =
-        IntVector3(Model::get_config()->number_of_locations(),
-                   IntVector2(Person::NUMBER_OF_STATE,
-                              IntVector(Model::get_config()->number_of_age_classes(), 0)));
-
-    total_immune_by_location_ = DoubleVector(Model::get_config()->number_of_locations(), 0.0);
-    total_immune_by_location_age_class_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(Model::get_config()->number_of_age_classes(), 0.0));
-    total_immune_by_location_age_ =
-        DoubleVector2(Model::get_config()->number_of_locations(),
-                      DoubleVector(100, 0.0));
-
-    total_number_of_bites_by_location_ = LongVector(Model::get_config()->number_of_locations(), 0);
-    total_number_of_bites_by_location_year_ =
-        LongVector(Model::get_config()->number_of_locations(), 0);
-    person_days_by_location_year_ = LongVector(Model::get_config()->number_of_locations(), 0);
+    const auto locations = static_cast<std::size_t>(Model::get_config()->number_of_locations());
+    const auto age_classes =
+        static_cast<std::size_t>(Model::get_config()->number_of_age_classes());
+    const auto therapies = Model::get_therapy_db().size();
+
+    // Counters live in one arena, grouped by when they are reset
+    counters_.clear();
+    counters_.add(total_number_of_bites_by_location_, NEVER, {locations});
+    counters_.add(last_update_total_number_of_bites_by_location_, NEVER, {locations});
+    counters_.add(person_days_by_location_year_, NEVER, {locations});
+    counters_.add(cumulative_clinical_episodes_by_location_, NEVER, {locations});
+    counters_.add(cumulative_clinical_episodes_by_location_age_, NEVER, {locations, 100});
+    counters_.add(cumulative_clinical_episodes_by_location_age_group_, NEVER,
+                  {locations, age_classes});
+    counters_.add(cumulative_mutants_by_location_, NEVER, {locations});
+    counters_.add(cumulative_discounted_ntf_by_location_, NEVER, {locations});
+    counters_.add(cumulative_ntf_by_location_, NEVER, {locations});
+    counters_.add(cumulative_tf_by_location_, NEVER, {locations});
+    counters_.add(cumulative_number_treatments_by_location_, NEVER, {locations});
+    counters_.add(number_of_treatments_with_therapy_id_, NEVER, {therapies});
+    counters_.add(number_of_treatments_success_with_therapy_id_, NEVER, {therapies});
+    counters_.add(number_of_treatments_fail_with_therapy_id_, NEVER, {therapies});
+    counters_.add(number_of_death_by_location_age_group_, NEVER, {locations, age_classes});
+    counters_.add(mosquito_recombination_events_count_, NEVER, {locations, 2});
+    counters_.add(today_tf_by_location_, DAILY, {locations});
+    counters_.add(today_number_of_treatments_by_location_, DAILY, {locations});
+    counters_.add(today_ritf_by_location_, DAILY, {locations});
+    counters_.add(today_tf_by_therapy_, DAILY, {therapies});
+    counters_.add(today_number_of_treatments_by_therapy_, DAILY, {therapies});
+    counters_.add(births_by_location_, MONTHLY, {locations});
+    counters_.add(deaths_by_location_, MONTHLY, {locations});
+    counters_.add(malaria_deaths_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(malaria_deaths_by_location_age_class_, MONTHLY_COLLECTING,
+                  {locations, age_classes});
+    counters_.add(monthly_number_of_treatment_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_number_of_treatment_by_location_age_class_, MONTHLY_COLLECTING,
+                  {locations, age_classes});
+    counters_.add(monthly_number_of_treatment_by_location_therapy_, MONTHLY_COLLECTING,
+                  {locations, therapies});
+    counters_.add(monthly_number_of_recrudescence_treatment_by_location_, MONTHLY_COLLECTING,
+                  {locations});
+    counters_.add(monthly_number_of_recrudescence_treatment_by_location_age_class_,
+                  MONTHLY_COLLECTING, {locations, age_classes});
+    counters_.add(monthly_number_of_recrudescence_treatment_by_location_age_, MONTHLY_COLLECTING,
+                  {locations, 80});
+    counters_.add(monthly_number_of_tf_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_number_of_new_infections_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_number_of_clinical_episode_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_number_of_clinical_episode_by_location_age_, MONTHLY_COLLECTING,
+                  {locations, 100});
+    counters_.add(monthly_number_of_clinical_episode_by_location_age_class_, MONTHLY_COLLECTING,
+                  {locations, age_classes});
+    counters_.add(monthly_number_of_mutation_events_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_nontreatment_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_nontreatment_by_location_age_class_, MONTHLY_COLLECTING,
+                  {locations, age_classes});
+    counters_.add(monthly_treatment_complete_by_location_therapy_, MONTHLY_COLLECTING,
+                  {locations, therapies});
+    counters_.add(monthly_treatment_failure_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_treatment_failure_by_location_age_class_, MONTHLY_COLLECTING,
+                  {locations, age_classes});
+    counters_.add(monthly_treatment_failure_by_location_therapy_, MONTHLY_COLLECTING,
+                  {locations, therapies});
+    counters_.add(monthly_treatment_success_by_location_, MONTHLY_COLLECTING, {locations});
+    counters_.add(monthly_treatment_success_by_location_age_class_, MONTHLY_COLLECTING,
+                  {locations, age_classes});
+    counters_.add(monthly_treatment_success_by_location_therapy_, MONTHLY_COLLECTING,
+                  {locations, therapies});
+    counters_.add(total_number_of_bites_by_location_year_, YEARLY, {locations});
+    counters_.add(number_of_untreated_cases_by_location_age_year_, YEARLY, {locations, 80});
+    counters_.add(number_of_treatments_by_location_age_year_, YEARLY, {locations, 80});
+    counters_.add(number_of_deaths_by_location_age_year_, YEARLY, {locations, 80});
+    counters_.add(number_of_malaria_deaths_treated_by_location_age_year_, YEARLY, {locations, 80});
+    counters_.add(number_of_malaria_deaths_non_treated_by_location_age_year_, YEARLY,
+                  {locations, 80});
+    counters_.add(popsize_by_location_, POPULATION_STATISTIC, {locations});
+    counters_.add(popsize_residence_by_location_, POPULATION_STATISTIC, {locations});
+    counters_.add(popsize_by_location_hoststate_, POPULATION_STATISTIC,
+                  {locations, Person::NUMBER_OF_STATE});
+    counters_.add(popsize_by_location_hoststate_age_class_, POPULATION_STATISTIC,
+                  {locations, Person::NUMBER_OF_STATE, age_classes});
+    counters_.add(popsize_by_location_age_class_, POPULATION_STATISTIC, {locations, age_classes});
+    counters_.add(popsize_by_location_age_class_by_5_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(popsize_by_location_age_, POPULATION_STATISTIC, {locations, 80});
+    counters_.add(total_immune_by_location_, POPULATION_STATISTIC, {locations});
+    counters_.add(total_immune_by_location_age_class_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(total_immune_by_location_age_, POPULATION_STATISTIC, {locations, 100});
+    counters_.add(blood_slide_prevalence_by_location_, POPULATION_STATISTIC, {locations});
+    counters_.add(blood_slide_prevalence_by_location_age_group_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(blood_slide_number_by_location_age_group_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(blood_slide_prevalence_by_location_age_group_by_5_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(blood_slide_number_by_location_age_group_by_5_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(blood_slide_prevalence_by_location_age_, POPULATION_STATISTIC, {locations, 80});
+    counters_.add(blood_slide_number_by_location_age_, POPULATION_STATISTIC, {locations, 80});
+    counters_.add(fraction_of_positive_that_are_clinical_by_location_, POPULATION_STATISTIC,
+                  {locations});
+    counters_.add(total_parasite_population_by_location_, POPULATION_STATISTIC, {locations});
+    counters_.add(total_parasite_population_by_location_age_group_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(number_of_positive_by_location_, POPULATION_STATISTIC, {locations});
+    counters_.add(number_of_positive_by_location_age_group_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(number_of_clinical_by_location_age_group_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(number_of_clinical_by_location_age_group_by_5_, POPULATION_STATISTIC,
+                  {locations, age_classes});
+    counters_.add(multiple_of_infection_by_location_, POPULATION_STATISTIC,
+                  {locations, NUMBER_OF_REPORTED_MOI});
+    counters_.allocate();
+
+    const auto sample_capacity = static_cast<std::size_t>(
+        Model::get_config()->get_model_settings().get_event_sample_capacity());
+    mutation_tracker.set_sample_capacity(sample_capacity);
+    mosquito_recombined_resistant_genotype_tracker.set_sample_capacity(sample_capacity);
 
     eir_by_location_year_ =
         DoubleVector2(Model::get_config()->number_of_locations());
     eir_by_location_ = DoubleVector(Model::get_config()->number_of_locations(), 0.0);
 
-    cumulative_clinical_episodes_by_location_ =
-        LongVector(Model::get_config()->number_of_locations(), 0);
-    cumulative_clinical_episodes_by_location_age_ =
-        LongVector2(Model::get_config()->number_of_locations(), LongVector(100, 0));
-    cumulative_clinical_episodes_by_location_age_group_ =
-        LongVector2(Model::get_config()->number_of_locations(),
-                    LongVector(Model::get_config()->number_of_age_classes(), 0));
-
     average_number_biten_by_location_person_ =
         DoubleVector2(Model::get_config()->number_of_locations());
     percentage_bites_on_top_20_by_location_ =
         DoubleVector(Model::get_config()->number_of_locations(), 0.0);
 
-    cumulative_mutants_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-
-    cumulative_discounted_ntf_by_location_ =
-        DoubleVector(Model::get_config()->number_of_locations(), 0.0);
-    cumulative_ntf_by_location_ = DoubleVector(Model::get_config()->number_of_locations(), 0.0);
-    cumulative_tf_by_location_ = LongVector(Model::get_config()->number_of_locations(), 0.0);
-    cumulative_number_treatments_by_location_ =
-        LongVector(Model::get_config()->number_of_locations(), 0.0);
-
-    today_tf_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    today_number_of_treatments_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    today_ritf_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-
     total_number_of_treatments_60_by_location_ = IntVector2(
         Model::get_config()->number_of_locations(),
         IntVector(Model::get_config()->get_epidemiological_parameters().get_tf_window_size(), 0));
@@ -135,21 +171,12 @@ void ModelDataCollector::initialize() {
     current_ritf_by_location_ = DoubleVector(Model::get_config()->number_of_locations(), 0.0);
     current_tf_by_location_ = DoubleVector(Model::get_config()->number_of_locations(), 0.0);
 
-    cumulative_mutants_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-
     progress_to_clinical_in_7d_counter = std::vector<ProgressToClinicalCounter>(
         Model::get_config()->number_of_locations(),ProgressToClinicalCounter());
 
     current_utl_duration_ = 0;
     utl_duration_ = IntVector();
 
-    number_of_treatments_with_therapy_id_ = IntVector(Model::get_therapy_db().size(), 0);
-    number_of_treatments_success_with_therapy_id_ = IntVector(Model::get_therapy_db().size(), 0);
-    number_of_treatments_fail_with_therapy_id_ = IntVector(Model::get_therapy_db().size(), 0);
-
-    mosquito_recombination_events_count_ =
-        LongVector2(Model::get_config()->number_of_locations(), LongVector(2, 0));
-
     amu_per_parasite_pop_ = 0;
     amu_per_person_ = 0;
     amu_for_clinical_caused_parasite_ = 0;
@@ -162,12 +189,7 @@ void ModelDataCollector::initialize() {
 
     discounted_afu_ = 0;
 
-    multiple_of_infection_by_location_ = IntVector2(Model::get_config()->number_of_locations(),
-                                                    IntVector(NUMBER_OF_REPORTED_MOI, 0));
-
     current_eir_by_location_ = DoubleVector(Model::get_config()->number_of_locations(), 0.0);
-    last_update_total_number_of_bites_by_location_ =
-        LongVector(Model::get_config()->number_of_locations(), 0);
 
     last_10_blood_slide_prevalence_by_location_ =
         DoubleVector2(Model::get_config()->number_of_locations(), DoubleVector(10, 0.0));
@@ -179,39 +201,6 @@ void ModelDataCollector::initialize() {
     last_10_fraction_positive_that_are_clinical_by_location_age_class_by_5_ = DoubleVector3(
         Model::get_config()->number_of_locations(),
         DoubleVector2(Model::get_config()->number_of_age_classes(), DoubleVector(10, 0.0)));
-    total_parasite_population_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    number_of_positive_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-
-    total_parasite_population_by_location_age_group_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    number_of_positive_by_location_age_group_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    number_of_clinical_by_location_age_group_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    number_of_clinical_by_location_age_group_by_5_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    number_of_death_by_location_age_group_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-
-    number_of_untreated_cases_by_location_age_year_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(80, 0));
-    number_of_treatments_by_location_age_year_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(80, 0));
-    number_of_deaths_by_location_age_year_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(80, 0));
-    number_of_malaria_deaths_treated_by_location_age_year_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(80, 0));
-    number_of_malaria_deaths_non_treated_by_location_age_year_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(80, 0));
-
-    popsize_by_location_age_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(80, 0));
 
     tf_at_15_ = 0;
     single_resistance_frequency_at_15_ = 0;
@@ -229,74 +218,13 @@ void ModelDataCollector::initialize() {
         Model::get_therapy_db().size(),
         IntVector(Model::get_config()->get_epidemiological_parameters().get_tf_window_size(), 0));
     current_tf_by_therapy_ = DoubleVector(Model::get_therapy_db().size(), 0.0);
-    today_tf_by_therapy_ = IntVector(Model::get_therapy_db().size(), 0);
-    today_number_of_treatments_by_therapy_ = IntVector(Model::get_therapy_db().size(), 0);
-
-    monthly_number_of_treatment_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_recrudescence_treatment_by_location_ =
-      LongVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_recrudescence_treatment_by_location_age_class_ =
-      LongVector2(Model::get_config()->number_of_locations(),
-      LongVector(Model::get_config()->number_of_age_classes(), 0));
-    monthly_number_of_recrudescence_treatment_by_location_age_ =
-      LongVector2(Model::get_config()->number_of_locations(),
-                 LongVector(80, 0));
-    monthly_number_of_tf_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_new_infections_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_clinical_episode_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_clinical_episode_by_location_age_ =
-        IntVector2(Model::get_config()->number_of_locations(), IntVector(100, 0));
-    monthly_number_of_mutation_events_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
 
     current_number_of_mutation_events_in_this_year_ = 0;
-    mutation_tracker =
-        std::vector<std::vector<MutationTrackerInfo>>(Model::get_config()->number_of_locations());
-
-    mosquito_recombined_resistant_genotype_tracker =
-        std::vector<std::vector<RecombinedResistantGenotypeInfo>>(
-            Model::get_config()->number_of_locations());
+    mutation_tracker.clear();
+    mosquito_recombined_resistant_genotype_tracker.clear();
 
     number_of_mutation_events_by_year_ = LongVector();
 
-    monthly_treatment_failure_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_nontreatment_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_treatment_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    monthly_number_of_treatment_by_location_therapy_ = IntVector2(
-        Model::get_config()->number_of_locations(), IntVector(Model::get_therapy_db().size(), 0));
-    monthly_number_of_new_infections_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_clinical_episode_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_number_of_clinical_episode_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    monthly_nontreatment_by_location_ = IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_nontreatment_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    monthly_treatment_complete_by_location_therapy_ = IntVector2(
-        Model::get_config()->number_of_locations(), IntVector(Model::get_therapy_db().size(), 0));
-    monthly_treatment_failure_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_treatment_failure_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    monthly_treatment_failure_by_location_therapy_ = IntVector2(
-        Model::get_config()->number_of_locations(), IntVector(Model::get_therapy_db().size(), 0));
-    monthly_treatment_success_by_location_ =
-        IntVector(Model::get_config()->number_of_locations(), 0);
-    monthly_treatment_success_by_location_age_class_ =
-        IntVector2(Model::get_config()->number_of_locations(),
-                   IntVector(Model::get_config()->number_of_age_classes(), 0));
-    monthly_treatment_success_by_location_therapy_ = IntVector2(
-        Model::get_config()->number_of_locations(), IntVector(Model::get_therapy_db().size(), 0));
     current_number_of_mutation_events_ = 0;
     number_of_mutation_events_by_year_ = LongVector();
 }
@@ -323,6 +251,7 @@ void ModelDataCollector::perform_population_statistic() {
           //                    assert(p->has_birthday_event());
           //                    assert(p->get_age_class() == ac);
           // this immune value will include maternal immunity value of the infants
+          person->catch_up();
           double immune_value = person->get_immune_system()->get_latest_immune_value();
           total_immune_by_location_[loc] += immune_value;
           total_immune_by_location_age_class_[loc][ac] += immune_value;
@@ -372,6 +301,20 @@ void ModelDataCollector::perform_population_statistic() {
       }
     }
 
+    // Aggregated never-infected susceptibles only have a location and an age
+    // class, they are left out of the statistics by exact age and immunity
+    if (auto* compartment = Model::get_population()->susceptible_compartment();
+        compartment != nullptr) {
+      for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
+        const auto size = static_cast<int>(compartment->size(loc, ac));
+        popsize_by_location_hoststate_[loc][Person::SUSCEPTIBLE] += size;
+        popsize_by_location_age_class_[loc][ac] += size;
+        popsize_by_location_hoststate_age_class_[loc][Person::SUSCEPTIBLE][ac] += size;
+        popsize_residence_by_location_[loc] += size;
+        multiple_of_infection_by_location_[loc][0] += size;
+      }
+    }
+
     popsize_by_location_[loc] = Model::get_population()->size_at(static_cast<int>(loc));
 
     const auto sum_popsize_by_location =
@@ -611,17 +554,8 @@ void ModelDataCollector::record_1_non_treated_case(const int &location, const in
 }
 
 void ModelDataCollector::begin_time_step() {
-  for (int location = 0; location < Model::get_config()->number_of_locations(); location++) {
-    today_number_of_treatments_by_location_[location] = 0;
-    today_ritf_by_location_[location] = 0;
-    today_tf_by_location_[location] = 0;
-  }
+  counters_.reset(DAILY);
 
-  for (auto therapy_id = 0; static_cast<size_t>(therapy_id) < Model::get_therapy_db().size();
-       therapy_id++) {
-    today_number_of_treatments_by_therapy_[therapy_id] = 0;
-    today_tf_by_therapy_[therapy_id] = 0;
-  }
   if (!recording_
       && Model::get_scheduler()->current_time()
              >= Model::get_config()->get_simulation_timeframe().get_start_collect_data_day()) {
@@ -758,10 +692,10 @@ void ModelDataCollector::record_1_mutation(const int &location, Genotype* from,
 
 void ModelDataCollector::record_1_mutation_by_drug(const int &location, Genotype* from,
                                                    Genotype* to, int drug_id) {
-  auto mutation_tracker_info = std::make_tuple(location, Model::get_scheduler()->current_time(),
-                                               Model::get_scheduler()->get_current_month_in_year(),
-                                               drug_id, from->genotype_id(), to->genotype_id());
-  mutation_tracker[location].push_back(mutation_tracker_info);
+  mutation_tracker.record(
+      Model::get_scheduler()->current_time(),
+      {location, static_cast<int>(Model::get_scheduler()->get_current_month_in_year()), drug_id,
+       from->genotype_id(), to->genotype_id()});
 }
 
 void ModelDataCollector::record_1_treatment_failure_by_therapy(const int &location,
@@ -868,15 +802,8 @@ void ModelDataCollector::yearly_update() {
       //  and also when the individual change location
       person_days_by_location_year_[loc] =
           Model::get_population()->size_at(loc) * Constants::DAYS_IN_YEAR;
-      total_number_of_bites_by_location_year_[loc] = 0;
-      for (auto age = 0; age < 80; age++) {
-        number_of_untreated_cases_by_location_age_year_[loc][age] = 0;
-        number_of_treatments_by_location_age_year_[loc][age] = 0;
-        number_of_deaths_by_location_age_year_[loc][age] = 0;
-        number_of_malaria_deaths_treated_by_location_age_year_[loc][age] = 0;
-        number_of_malaria_deaths_non_treated_by_location_age_year_[loc][age] = 0;
-      }
     }
+    counters_.reset(YEARLY);
     if (Model::get_scheduler()->current_time()
         >= Model::get_config()->get_simulation_timeframe().get_start_of_comparison_period()) {
       number_of_mutation_events_by_year_.push_back(current_number_of_mutation_events_in_this_year_);
@@ -994,99 +921,18 @@ double ModelDataCollector::get_blood_slide_prevalence(const int &location, const
 }
 
 void ModelDataCollector::monthly_update() {
-  zero_fill(births_by_location_);
-  zero_fill(deaths_by_location_);
+  counters_.reset(MONTHLY);
+  // The reporters have read this month's events, the keys only carry the month in year
+  mutation_tracker.clear();
+  mosquito_recombined_resistant_genotype_tracker.clear();
 
   if (Model::get_scheduler()->current_time()
       > Model::get_config()->get_simulation_timeframe().get_start_collect_data_day()) {
-    zero_fill(monthly_number_of_treatment_by_location_);
-    zero_fill(monthly_number_of_recrudescence_treatment_by_location_);
-    zero_fill(monthly_number_of_new_infections_by_location_);
-    zero_fill(monthly_number_of_clinical_episode_by_location_);
-    zero_fill(monthly_nontreatment_by_location_);
-    zero_fill(malaria_deaths_by_location_);
-    zero_fill(monthly_treatment_failure_by_location_);
-    zero_fill(monthly_treatment_success_by_location_);
-
-    for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
-      zero_fill(monthly_nontreatment_by_location_age_class_[loc]);
-      zero_fill(malaria_deaths_by_location_age_class_[loc]);
-      zero_fill(monthly_number_of_clinical_episode_by_location_age_class_[loc]);
-      zero_fill(monthly_number_of_treatment_by_location_therapy_[loc]);
-      zero_fill(monthly_number_of_treatment_by_location_age_class_[loc]);
-      zero_fill(monthly_treatment_complete_by_location_therapy_[loc]);
-      zero_fill(monthly_treatment_failure_by_location_age_class_[loc]);
-      zero_fill(monthly_treatment_failure_by_location_therapy_[loc]);
-      zero_fill(monthly_treatment_success_by_location_age_class_[loc]);
-      zero_fill(monthly_treatment_success_by_location_therapy_[loc]);
-      zero_fill(monthly_number_of_recrudescence_treatment_by_location_age_class_[loc]);
-      zero_fill(monthly_number_of_recrudescence_treatment_by_location_age_[loc]);
-
-      monthly_number_of_treatment_by_location_[loc] = 0;
-      monthly_number_of_tf_by_location_[loc] = 0;
-      monthly_number_of_new_infections_by_location_[loc] = 0;
-      monthly_number_of_clinical_episode_by_location_[loc] = 0;
-      monthly_number_of_mutation_events_by_location_[loc] = 0;
-      for (int age = 0; age < 100; age++) {
-        monthly_number_of_clinical_episode_by_location_age_[loc][age] = 0;
-      }
-    }
+    counters_.reset(MONTHLY_COLLECTING);
   }
 }
 
 void ModelDataCollector::zero_population_statistics() {
-  // // Vectors to be zeroed
-  // zero_fill(popsize_residence_by_location_);
-  // zero_fill(blood_slide_prevalence_by_location_);
-  // zero_fill(fraction_of_positive_that_are_clinical_by_location_);
-  // zero_fill(total_immune_by_location_);
-  // zero_fill(total_parasite_population_by_location_);
-  // zero_fill(number_of_positive_by_location_);
-  //
-  // // Matrices based on number of locations to be zeroed
-  // for (auto location = 0ul; location < Model::get_config()->number_of_locations();
-  //      location++) {
-  //   zero_fill(popsize_by_location_hoststate_[location]);
-  //   zero_fill(total_immune_by_location_age_class_[location]);
-  //   zero_fill(total_parasite_population_by_location_age_group_[location]);
-  //   zero_fill(number_of_positive_by_location_age_group_[location]);
-  //   zero_fill(number_of_clinical_by_location_age_group_[location]);
-  //   zero_fill(number_of_clinical_by_location_age_group_by_5_[location]);
-  //   zero_fill(popsize_by_location_age_class_[location]);
-  //   zero_fill(popsize_by_location_age_class_by_5_[location]);
-  //   zero_fill(blood_slide_prevalence_by_location_age_group_[location]);
-  //   zero_fill(blood_slide_number_by_location_age_group_[location]);
-  //   zero_fill(blood_slide_prevalence_by_location_age_group_by_5_[location]);
-  //   zero_fill(blood_slide_number_by_location_age_group_by_5_[location]);
-  //   zero_fill(multiple_of_infection_by_location_[location]);
-  // }
-
-  // Vectors to be zeroed
-  zero_fill(popsize_by_location_);
-  zero_fill(popsize_residence_by_location_);
-  zero_fill(blood_slide_prevalence_by_location_);
-  zero_fill(fraction_of_positive_that_are_clinical_by_location_);
-  zero_fill(total_immune_by_location_);
-  zero_fill(total_parasite_population_by_location_);
-  zero_fill(number_of_positive_by_location_);
-
-  zero_fill_matrix_2d(popsize_by_location_hoststate_);
-  zero_fill_matrix_3d(popsize_by_location_hoststate_age_class_);
-  zero_fill_matrix_2d(total_immune_by_location_age_class_);
-  zero_fill_matrix_2d(total_immune_by_location_age_);
-  zero_fill_matrix_2d(total_parasite_population_by_location_age_group_);
-  zero_fill_matrix_2d(number_of_positive_by_location_age_group_);
-  zero_fill_matrix_2d(number_of_clinical_by_location_age_group_);
-  zero_fill_matrix_2d(number_of_clinical_by_location_age_group_by_5_);
-  zero_fill_matrix_2d(popsize_by_location_age_class_);
-  zero_fill_matrix_2d(popsize_by_location_age_class_by_5_);
-  zero_fill_matrix_2d(blood_slide_prevalence_by_location_age_group_);
-  zero_fill_matrix_2d(blood_slide_number_by_location_age_group_);
-  zero_fill_matrix_2d(blood_slide_prevalence_by_location_age_group_by_5_);
-  zero_fill_matrix_2d(blood_slide_number_by_location_age_group_by_5_);
-  zero_fill_matrix_2d(blood_slide_prevalence_by_location_age_);
-  zero_fill_matrix_2d(blood_slide_number_by_location_age_);
-  zero_fill_matrix_2d(popsize_by_location_age_);
-  zero_fill_matrix_2d(multiple_of_infection_by_location_);
+  counters_.reset(POPULATION_STATISTIC);
 }
 
@@ -8,6 +8,8 @@
 #ifndef MODELDATACOLLECTOR_H
 #define MODELDATACOLLECTOR_H
 
+#include "MDC/CounterArena.h"
+#include "MDC/EventTally.h"
 #include "Utils/TypeDef.h"
 
 class Model;
@@ -21,205 +23,168 @@ class Therapy;
 class ClonalParasitePopulation;
 
 class ModelDataCollector {
+public:
+  // Reset groups of the counters in the arena
+  enum CounterGroup : std::size_t {
+    // Cumulative counters and counters that are assigned rather than reset
+    NEVER = 0,
+    // Reset by begin_time_step()
+    DAILY,
+    // Reset by monthly_update()
+    MONTHLY,
+    // Reset by monthly_update() once data is being collected
+    MONTHLY_COLLECTING,
+    // Reset by yearly_update() once data is being collected
+    YEARLY,
+    // Reset by perform_population_statistic()
+    POPULATION_STATISTIC
+  };
+
 private:
-  DoubleVector total_immune_by_location_;
+  CounterArena counters_;
+
+  DoubleCounter total_immune_by_location_;
 
 public:
-  DoubleVector &total_immune_by_location() { return total_immune_by_location_; }
-  void set_total_immune_by_location(const DoubleVector &value) {
-    total_immune_by_location_ = value;
-  }
+  DoubleCounter &total_immune_by_location() { return total_immune_by_location_; }
 
 private:
-  DoubleVector2 total_immune_by_location_age_class_;
+  DoubleCounter2 total_immune_by_location_age_class_;
 
 public:
-  DoubleVector2 &total_immune_by_location_age_class() {
+  DoubleCounter2 &total_immune_by_location_age_class() {
     return total_immune_by_location_age_class_;
   }
-  void set_total_immune_by_location_age_class(const DoubleVector2 &value) {
-    total_immune_by_location_age_class_ = value;
-  }
 
 private:
-  DoubleVector2 total_immune_by_location_age_;
+  DoubleCounter2 total_immune_by_location_age_;
 
 public:
-  DoubleVector2 &total_immune_by_location_age() {
+  DoubleCounter2 &total_immune_by_location_age() {
     return total_immune_by_location_age_;
   }
-  void set_total_immune_by_location_age(const DoubleVector2 &value) {
-    total_immune_by_location_age_ = value;
-  }
 
 private:
-  IntVector popsize_by_location_;
+  IntCounter popsize_by_location_;
 
 public:
-  IntVector &popsize_by_location() { return popsize_by_location_; }
-  void set_popsize_by_location(const IntVector &value) { popsize_by_location_ = value; }
+  IntCounter &popsize_by_location() { return popsize_by_location_; }
 
 private:
-  IntVector popsize_residence_by_location_;
+  IntCounter popsize_residence_by_location_;
 
 public:
-  IntVector &popsize_residence_by_location() { return popsize_residence_by_location_; }
-  void set_popsize_residence_by_location(const IntVector &value) {
-    popsize_residence_by_location_ = value;
-  }
+  IntCounter &popsize_residence_by_location() { return popsize_residence_by_location_; }
 
 private:
-  IntVector2 popsize_by_location_age_class_;
+  IntCounter2 popsize_by_location_age_class_;
 
 public:
-  IntVector2 &popsize_by_location_age_class() { return popsize_by_location_age_class_; }
-  void set_popsize_by_location_age_class(const IntVector2 &value) {
-    popsize_by_location_age_class_ = value;
-  }
+  IntCounter2 &popsize_by_location_age_class() { return popsize_by_location_age_class_; }
 
 private:
-  IntVector2 popsize_by_location_age_class_by_5_;
+  IntCounter2 popsize_by_location_age_class_by_5_;
 
 public:
-  IntVector2 &popsize_by_location_age_class_by_5() { return popsize_by_location_age_class_by_5_; }
-  void set_popsize_by_location_age_class_by_5(const IntVector2 &value) {
-    popsize_by_location_age_class_by_5_ = value;
-  }
+  IntCounter2 &popsize_by_location_age_class_by_5() { return popsize_by_location_age_class_by_5_; }
 
 private:
-  IntVector2 popsize_by_location_hoststate_;
+  IntCounter2 popsize_by_location_hoststate_;
 
 public:
-  IntVector2 &popsize_by_location_hoststate() { return popsize_by_location_hoststate_; }
-  void set_popsize_by_location_hoststate(const IntVector2 &value) {
-    popsize_by_location_hoststate_ = value;
-  }
+  IntCounter2 &popsize_by_location_hoststate() { return popsize_by_location_hoststate_; }
 
 private:
-  IntVector3 popsize_by_location_hoststate_age_class_;
+  IntCounter3 popsize_by_location_hoststate_age_class_;
 
 public:
-  IntVector3 &popsize_by_location_hoststate_age_class() {
+  IntCounter3 &popsize_by_location_hoststate_age_class() {
     return popsize_by_location_hoststate_age_class_;
   }
-  void set_popsize_by_location_hoststate_age_class(const IntVector3 &value) {
-    popsize_by_location_hoststate_age_class_ = value;
-  }
 
 private:
-  DoubleVector blood_slide_prevalence_by_location_;
+  DoubleCounter blood_slide_prevalence_by_location_;
 
 public:
-  DoubleVector &blood_slide_prevalence_by_location() { return blood_slide_prevalence_by_location_; }
-  void set_blood_slide_prevalence_by_location(const DoubleVector &value) {
-    blood_slide_prevalence_by_location_ = value;
+  DoubleCounter &blood_slide_prevalence_by_location() {
+    return blood_slide_prevalence_by_location_;
   }
 
 private:
-  DoubleVector2 blood_slide_number_by_location_age_group_;
+  DoubleCounter2 blood_slide_number_by_location_age_group_;
 
 public:
-  DoubleVector2 &blood_slide_number_by_location_age_group() {
+  DoubleCounter2 &blood_slide_number_by_location_age_group() {
     return blood_slide_number_by_location_age_group_;
   }
-  void set_blood_slide_number_by_location_age_group(const DoubleVector2 &value) {
-    blood_slide_number_by_location_age_group_ = value;
-  }
 
 private:
-  DoubleVector2 blood_slide_prevalence_by_location_age_group_;
+  DoubleCounter2 blood_slide_prevalence_by_location_age_group_;
 
 public:
-  DoubleVector2 &blood_slide_prevalence_by_location_age_group() {
+  DoubleCounter2 &blood_slide_prevalence_by_location_age_group() {
     return blood_slide_prevalence_by_location_age_group_;
   }
-  void set_blood_slide_prevalence_by_location_age_group(const DoubleVector2 &value) {
-    blood_slide_prevalence_by_location_age_group_ = value;
-  }
 
 private:
-  DoubleVector2 blood_slide_number_by_location_age_group_by_5_;
+  DoubleCounter2 blood_slide_number_by_location_age_group_by_5_;
 
 public:
-  DoubleVector2 &blood_slide_number_by_location_age_group_by_5() {
+  DoubleCounter2 &blood_slide_number_by_location_age_group_by_5() {
     return blood_slide_number_by_location_age_group_by_5_;
   }
-  void set_blood_slide_number_by_location_age_group_by_5(const DoubleVector2 &value) {
-    blood_slide_number_by_location_age_group_by_5_ = value;
-  }
 
 private:
-  DoubleVector2 blood_slide_prevalence_by_location_age_group_by_5_;
+  DoubleCounter2 blood_slide_prevalence_by_location_age_group_by_5_;
 
 public:
-  DoubleVector2 &blood_slide_prevalence_by_location_age_group_by_5() {
+  DoubleCounter2 &blood_slide_prevalence_by_location_age_group_by_5() {
     return blood_slide_prevalence_by_location_age_group_by_5_;
   }
-  void set_blood_slide_prevalence_by_location_age_group_by_5(const DoubleVector2 &value) {
-    blood_slide_prevalence_by_location_age_group_by_5_ = value;
-  }
 
 private:
-  DoubleVector2 blood_slide_prevalence_by_location_age_;
+  DoubleCounter2 blood_slide_prevalence_by_location_age_;
 
 public:
-  DoubleVector2 &blood_slide_prevalence_by_location_age() {
+  DoubleCounter2 &blood_slide_prevalence_by_location_age() {
     return blood_slide_prevalence_by_location_age_;
   }
-  void set_blood_slide_prevalence_by_location_age(const DoubleVector2 &value) {
-    blood_slide_prevalence_by_location_age_ = value;
-  }
 
 private:
-  DoubleVector2 blood_slide_number_by_location_age_;
+  DoubleCounter2 blood_slide_number_by_location_age_;
 
 public:
-  DoubleVector2 &blood_slide_number_by_location_age() {
+  DoubleCounter2 &blood_slide_number_by_location_age() {
     return blood_slide_number_by_location_age_;
   }
-  void set_blood_slide_number_by_location_age(const DoubleVector2 &value) {
-    blood_slide_number_by_location_age_ = value;
-  }
 
 private:
-  DoubleVector fraction_of_positive_that_are_clinical_by_location_;
+  DoubleCounter fraction_of_positive_that_are_clinical_by_location_;
 
 public:
-  DoubleVector &fraction_of_positive_that_are_clinical_by_location() {
+  DoubleCounter &fraction_of_positive_that_are_clinical_by_location() {
     return fraction_of_positive_that_are_clinical_by_location_;
   }
-  void set_fraction_of_positive_that_are_clinical_by_location(const DoubleVector &value) {
-    fraction_of_positive_that_are_clinical_by_location_ = value;
-  }
 
 private:
-  LongVector total_number_of_bites_by_location_;
+  LongCounter total_number_of_bites_by_location_;
 
 public:
-  LongVector &total_number_of_bites_by_location() { return total_number_of_bites_by_location_; }
-  void set_total_number_of_bites_by_location(const LongVector &value) {
-    total_number_of_bites_by_location_ = value;
-  }
+  LongCounter &total_number_of_bites_by_location() { return total_number_of_bites_by_location_; }
 
 private:
-  LongVector total_number_of_bites_by_location_year_;
+  LongCounter total_number_of_bites_by_location_year_;
 
 public:
-  LongVector &total_number_of_bites_by_location_year() {
+  LongCounter &total_number_of_bites_by_location_year() {
     return total_number_of_bites_by_location_year_;
   }
-  void set_total_number_of_bites_by_location_year(const LongVector &value) {
-    total_number_of_bites_by_location_year_ = value;
-  }
 
 private:
-  LongVector person_days_by_location_year_;
+  LongCounter person_days_by_location_year_;
 
 public:
-  LongVector &person_days_by_location_year() { return person_days_by_location_year_; }
-  void set_person_days_by_location_year(const LongVector &value) {
-    person_days_by_location_year_ = value;
-  }
+  LongCounter &person_days_by_location_year() { return person_days_by_location_year_; }
 
 private:
   DoubleVector2 eir_by_location_year_;
@@ -236,37 +201,28 @@ public:
   void set_eir_by_location(const DoubleVector &value) { eir_by_location_ = value; }
 
 private:
-  LongVector cumulative_clinical_episodes_by_location_;
+  LongCounter cumulative_clinical_episodes_by_location_;
 
 public:
-  LongVector &cumulative_clinical_episodes_by_location() {
+  LongCounter &cumulative_clinical_episodes_by_location() {
     return cumulative_clinical_episodes_by_location_;
   }
-  void set_cumulative_clinical_episodes_by_location(const LongVector &value) {
-    cumulative_clinical_episodes_by_location_ = value;
-  }
 
 private:
-  LongVector2 cumulative_clinical_episodes_by_location_age_;
+  LongCounter2 cumulative_clinical_episodes_by_location_age_;
 
 public:
-  LongVector2 &cumulative_clinical_episodes_by_location_age() {
+  LongCounter2 &cumulative_clinical_episodes_by_location_age() {
     return cumulative_clinical_episodes_by_location_age_;
   }
-  void set_cumulative_clinical_episodes_by_location_age(const LongVector2 &value) {
-    cumulative_clinical_episodes_by_location_age_ = value;
-  }
 
 private:
-  LongVector2 cumulative_clinical_episodes_by_location_age_group_;
+  LongCounter2 cumulative_clinical_episodes_by_location_age_group_;
 
 public:
-  LongVector2 &cumulative_clinical_episodes_by_location_age_group() {
+  LongCounter2 &cumulative_clinical_episodes_by_location_age_group() {
     return cumulative_clinical_episodes_by_location_age_group_;
   }
-  void set_cumulative_clinical_episodes_by_location_age_group(const LongVector2 &value) {
-    cumulative_clinical_episodes_by_location_age_group_ = value;
-  }
 
 private:
   DoubleVector2 average_number_biten_by_location_person_;
@@ -291,69 +247,52 @@ public:
   }
 
 private:
-  DoubleVector cumulative_discounted_ntf_by_location_;
+  DoubleCounter cumulative_discounted_ntf_by_location_;
 
 public:
-  DoubleVector &cumulative_discounted_ntf_by_location() {
+  DoubleCounter &cumulative_discounted_ntf_by_location() {
     return cumulative_discounted_ntf_by_location_;
   }
-  void set_cumulative_discounted_ntf_by_location(const DoubleVector &value) {
-    cumulative_discounted_ntf_by_location_ = value;
-  }
 
 private:
-  DoubleVector cumulative_ntf_by_location_;
+  DoubleCounter cumulative_ntf_by_location_;
 
 public:
-  DoubleVector &cumulative_ntf_by_location() { return cumulative_ntf_by_location_; }
-  void set_cumulative_ntf_by_location(const DoubleVector &value) {
-    cumulative_ntf_by_location_ = value;
-  }
+  DoubleCounter &cumulative_ntf_by_location() { return cumulative_ntf_by_location_; }
 
 private:
-  LongVector cumulative_tf_by_location_;
+  LongCounter cumulative_tf_by_location_;
 
 public:
-  LongVector &cumulative_tf_by_location() { return cumulative_tf_by_location_; }
-  void set_cumulative_tf_by_location(const LongVector &value) {
-    cumulative_tf_by_location_ = value;
-  }
+  LongCounter &cumulative_tf_by_location() { return cumulative_tf_by_location_; }
 
 private:
-  LongVector cumulative_number_treatments_by_location_;
+  LongCounter cumulative_number_treatments_by_location_;
 
 public:
-  LongVector &cumulative_number_treatments_by_location() {
+  LongCounter &cumulative_number_treatments_by_location() {
     return cumulative_number_treatments_by_location_;
   }
-  void set_cumulative_number_treatments_by_location(const LongVector &value) {
-    cumulative_number_treatments_by_location_ = value;
-  }
 
 private:
-  IntVector today_tf_by_location_;
+  IntCounter today_tf_by_location_;
 
 public:
-  IntVector &today_tf_by_location() { return today_tf_by_location_; }
-  void set_today_tf_by_location(const IntVector &value) { today_tf_by_location_ = value; }
+  IntCounter &today_tf_by_location() { return today_tf_by_location_; }
 
 private:
-  IntVector today_number_of_treatments_by_location_;
+  IntCounter today_number_of_treatments_by_location_;
 
 public:
-  IntVector &today_number_of_treatments_by_location() {
+  IntCounter &today_number_of_treatments_by_location() {
     return today_number_of_treatments_by_location_;
   }
-  void set_today_number_of_treatments_by_location(const IntVector &value) {
-    today_number_of_treatments_by_location_ = value;
-  }
 
 private:
-  IntVector today_ritf_by_location_;
+  IntCounter today_ritf_by_location_;
 
 public:
-  IntVector &today_ritf_by_location() { return today_ritf_by_location_; }
-  void set_today_ritf_by_location(const IntVector &value) { today_ritf_by_location_ = value; }
+  IntCounter &today_ritf_by_location() { return today_ritf_by_location_; }
 
 private:
   IntVector2 total_number_of_treatments_60_by_location_;
@@ -399,13 +338,10 @@ public:
   void set_current_tf_by_location(const DoubleVector &value) { current_tf_by_location_ = value; }
 
 private:
-  IntVector cumulative_mutants_by_location_;
+  IntCounter cumulative_mutants_by_location_;
 
 public:
-  IntVector &cumulative_mutants_by_location() { return cumulative_mutants_by_location_; }
-  void set_cumulative_mutants_by_location(const IntVector &value) {
-    cumulative_mutants_by_location_ = value;
-  }
+  IntCounter &cumulative_mutants_by_location() { return cumulative_mutants_by_location_; }
 
 private:
   int current_utl_duration_{0};
@@ -422,37 +358,28 @@ public:
   void set_utl_duration(const IntVector &value) { utl_duration_ = value; }
 
 private:
-  IntVector number_of_treatments_with_therapy_id_;
+  IntCounter number_of_treatments_with_therapy_id_;
 
 public:
-  IntVector &number_of_treatments_with_therapy_id() {
+  IntCounter &number_of_treatments_with_therapy_id() {
     return number_of_treatments_with_therapy_id_;
   }
-  void set_number_of_treatments_with_therapy_id(const IntVector &value) {
-    number_of_treatments_with_therapy_id_ = value;
-  }
 
 private:
-  IntVector number_of_treatments_success_with_therapy_id_;
+  IntCounter number_of_treatments_success_with_therapy_id_;
 
 public:
-  IntVector &number_of_treatments_success_with_therapy_id() {
+  IntCounter &number_of_treatments_success_with_therapy_id() {
     return number_of_treatments_success_with_therapy_id_;
   }
-  void set_number_of_treatments_success_with_therapy_id(const IntVector &value) {
-    number_of_treatments_success_with_therapy_id_ = value;
-  }
 
 private:
-  IntVector number_of_treatments_fail_with_therapy_id_;
+  IntCounter number_of_treatments_fail_with_therapy_id_;
 
 public:
-  IntVector &number_of_treatments_fail_with_therapy_id() {
+  IntCounter &number_of_treatments_fail_with_therapy_id() {
     return number_of_treatments_fail_with_therapy_id_;
   }
-  void set_number_of_treatments_fail_with_therapy_id(const IntVector &value) {
-    number_of_treatments_fail_with_therapy_id_ = value;
-  }
 
 private:
   double amu_per_parasite_pop_{0};
@@ -523,13 +450,10 @@ public:
   void set_discounted_afu(double value) { discounted_afu_ = value; }
 
 private:
-  IntVector2 multiple_of_infection_by_location_;
+  IntCounter2 multiple_of_infection_by_location_;
 
 public:
-  IntVector2 &multiple_of_infection_by_location() { return multiple_of_infection_by_location_; }
-  void set_multiple_of_infection_by_location(const IntVector2 &value) {
-    multiple_of_infection_by_location_ = value;
-  }
+  IntCounter2 &multiple_of_infection_by_location() { return multiple_of_infection_by_location_; }
 
 private:
   DoubleVector current_eir_by_location_;
@@ -539,15 +463,12 @@ public:
   void set_current_eir_by_location(const DoubleVector &value) { current_eir_by_location_ = value; }
 
 private:
-  LongVector last_update_total_number_of_bites_by_location_;
+  LongCounter last_update_total_number_of_bites_by_location_;
 
 public:
-  LongVector &last_update_total_number_of_bites_by_location() {
+  LongCounter &last_update_total_number_of_bites_by_location() {
     return last_update_total_number_of_bites_by_location_;
   }
-  void set_last_update_total_number_of_bites_by_location(const LongVector &value) {
-    last_update_total_number_of_bites_by_location_ = value;
-  }
 
 private:
   DoubleVector2 last_10_blood_slide_prevalence_by_location_;
@@ -606,238 +527,174 @@ public:
   }
 
 private:
-  IntVector total_parasite_population_by_location_;
+  IntCounter total_parasite_population_by_location_;
 
 public:
-  IntVector &total_parasite_population_by_location() {
+  IntCounter &total_parasite_population_by_location() {
     return total_parasite_population_by_location_;
   }
-  void set_total_parasite_population_by_location(const IntVector &value) {
-    total_parasite_population_by_location_ = value;
-  }
 
 private:
-  IntVector number_of_positive_by_location_;
+  IntCounter number_of_positive_by_location_;
 
 public:
-  IntVector &number_of_positive_by_location() { return number_of_positive_by_location_; }
-  void set_number_of_positive_by_location(const IntVector &value) {
-    number_of_positive_by_location_ = value;
-  }
+  IntCounter &number_of_positive_by_location() { return number_of_positive_by_location_; }
 
 private:
-  IntVector2 total_parasite_population_by_location_age_group_;
+  IntCounter2 total_parasite_population_by_location_age_group_;
 
 public:
-  IntVector2 &total_parasite_population_by_location_age_group() {
+  IntCounter2 &total_parasite_population_by_location_age_group() {
     return total_parasite_population_by_location_age_group_;
   }
-  void set_total_parasite_population_by_location_age_group(const IntVector2 &value) {
-    total_parasite_population_by_location_age_group_ = value;
-  }
 
 private:
-  IntVector2 number_of_positive_by_location_age_group_;
+  IntCounter2 number_of_positive_by_location_age_group_;
 
 public:
-  IntVector2 &number_of_positive_by_location_age_group() {
+  IntCounter2 &number_of_positive_by_location_age_group() {
     return number_of_positive_by_location_age_group_;
   }
-  void set_number_of_positive_by_location_age_group(const IntVector2 &value) {
-    number_of_positive_by_location_age_group_ = value;
-  }
 
 private:
-  IntVector2 number_of_clinical_by_location_age_group_;
+  IntCounter2 number_of_clinical_by_location_age_group_;
 
 public:
-  IntVector2 &number_of_clinical_by_location_age_group() {
+  IntCounter2 &number_of_clinical_by_location_age_group() {
     return number_of_clinical_by_location_age_group_;
   }
-  void set_number_of_clinical_by_location_age_group(const IntVector2 &value) {
-    number_of_clinical_by_location_age_group_ = value;
-  }
 
 private:
-  IntVector2 number_of_clinical_by_location_age_group_by_5_;
+  IntCounter2 number_of_clinical_by_location_age_group_by_5_;
 
 public:
-  IntVector2 &number_of_clinical_by_location_age_group_by_5() {
+  IntCounter2 &number_of_clinical_by_location_age_group_by_5() {
     return number_of_clinical_by_location_age_group_by_5_;
   }
-  void set_number_of_clinical_by_location_age_group_by_5(const IntVector2 &value) {
-    number_of_clinical_by_location_age_group_by_5_ = value;
-  }
 
 private:
-  IntVector2 number_of_death_by_location_age_group_;
+  IntCounter2 number_of_death_by_location_age_group_;
 
 public:
-  IntVector2 &number_of_death_by_location_age_group() {
+  IntCounter2 &number_of_death_by_location_age_group() {
     return number_of_death_by_location_age_group_;
   }
-  void set_number_of_death_by_location_age_group(const IntVector2 &value) {
-    number_of_death_by_location_age_group_ = value;
-  }
 
 private:
-  IntVector2 number_of_untreated_cases_by_location_age_year_;
+  IntCounter2 number_of_untreated_cases_by_location_age_year_;
 
 public:
-  IntVector2 &number_of_untreated_cases_by_location_age_year() {
+  IntCounter2 &number_of_untreated_cases_by_location_age_year() {
     return number_of_untreated_cases_by_location_age_year_;
   }
-  void set_number_of_untreated_cases_by_location_age_year(const IntVector2 &value) {
-    number_of_untreated_cases_by_location_age_year_ = value;
-  }
 
 private:
-  IntVector2 number_of_treatments_by_location_age_year_;
+  IntCounter2 number_of_treatments_by_location_age_year_;
 
 public:
-  IntVector2 &number_of_treatments_by_location_age_year() {
+  IntCounter2 &number_of_treatments_by_location_age_year() {
     return number_of_treatments_by_location_age_year_;
   }
-  void set_number_of_treatments_by_location_age_year(const IntVector2 &value) {
-    number_of_treatments_by_location_age_year_ = value;
-  }
 
 private:
-  IntVector2 number_of_deaths_by_location_age_year_;
+  IntCounter2 number_of_deaths_by_location_age_year_;
 
 public:
-  IntVector2 &number_of_deaths_by_location_age_year() {
+  IntCounter2 &number_of_deaths_by_location_age_year() {
     return number_of_deaths_by_location_age_year_;
   }
-  void set_number_of_deaths_by_location_age_year(const IntVector2 &value) {
-    number_of_deaths_by_location_age_year_ = value;
-  }
 
 private:
-  IntVector2 number_of_malaria_deaths_treated_by_location_age_year_;
+  IntCounter2 number_of_malaria_deaths_treated_by_location_age_year_;
 
 public:
-  IntVector2 &number_of_malaria_deaths_treated_by_location_age_year() {
+  IntCounter2 &number_of_malaria_deaths_treated_by_location_age_year() {
     return number_of_malaria_deaths_treated_by_location_age_year_;
   }
-  void set_number_of_malaria_deaths_treated_by_location_age_year(const IntVector2 &value) {
-    number_of_malaria_deaths_treated_by_location_age_year_ = value;
-  }
 
 private:
-  IntVector2 number_of_malaria_deaths_non_treated_by_location_age_year_;
+  IntCounter2 number_of_malaria_deaths_non_treated_by_location_age_year_;
 
 public:
-  IntVector2 &number_of_malaria_deaths_non_treated_by_location_age_year() {
+  IntCounter2 &number_of_malaria_deaths_non_treated_by_location_age_year() {
     return number_of_malaria_deaths_non_treated_by_location_age_year_;
   }
-  void set_number_of_malaria_deaths_non_treated_by_location_age_year(const IntVector2 &value) {
-    number_of_malaria_deaths_non_treated_by_location_age_year_ = value;
-  }
 
 private:
-  IntVector monthly_number_of_treatment_by_location_;
+  IntCounter monthly_number_of_treatment_by_location_;
 
 public:
-  IntVector &monthly_number_of_treatment_by_location() {
+  IntCounter &monthly_number_of_treatment_by_location() {
     return monthly_number_of_treatment_by_location_;
   }
-  void set_monthly_number_of_treatment_by_location(const IntVector &value) {
-    monthly_number_of_treatment_by_location_ = value;
-  }
 
 private:
-  IntVector monthly_number_of_tf_by_location_;
+  IntCounter monthly_number_of_tf_by_location_;
 
 public:
-  IntVector &monthly_number_of_tf_by_location() { return monthly_number_of_tf_by_location_; }
-  void set_monthly_number_of_tf_by_location(const IntVector &value) {
-    monthly_number_of_tf_by_location_ = value;
-  }
+  IntCounter &monthly_number_of_tf_by_location() { return monthly_number_of_tf_by_location_; }
 
 private:
-  IntVector monthly_number_of_new_infections_by_location_;
+  IntCounter monthly_number_of_new_infections_by_location_;
 
 public:
-  IntVector &monthly_number_of_new_infections_by_location() {
+  IntCounter &monthly_number_of_new_infections_by_location() {
     return monthly_number_of_new_infections_by_location_;
   }
-  void set_monthly_number_of_new_infections_by_location(const IntVector &value) {
-    monthly_number_of_new_infections_by_location_ = value;
-  }
 
 private:
-  LongVector monthly_number_of_recrudescence_treatment_by_location_;
+  LongCounter monthly_number_of_recrudescence_treatment_by_location_;
 
 public:
-  LongVector &monthly_number_of_recrudescence_treatment_by_location() {
+  LongCounter &monthly_number_of_recrudescence_treatment_by_location() {
     return monthly_number_of_recrudescence_treatment_by_location_;
   }
-  void set_monthly_number_of_recrudescence_treatment_by_location(const LongVector &value) {
-    monthly_number_of_recrudescence_treatment_by_location_ = value;
-  }
 
 private:
-  LongVector2 monthly_number_of_recrudescence_treatment_by_location_age_class_;
+  LongCounter2 monthly_number_of_recrudescence_treatment_by_location_age_class_;
 
 public:
-  LongVector2 &monthly_number_of_recrudescence_treatment_by_location_age_class() {
+  LongCounter2 &monthly_number_of_recrudescence_treatment_by_location_age_class() {
     return monthly_number_of_recrudescence_treatment_by_location_age_class_;
   }
-  void set_monthly_number_of_recrudescence_treatment_by_location_age_class(const LongVector2 &value) {
-    monthly_number_of_recrudescence_treatment_by_location_age_class_ = value;
-  }
 
 private:
-  LongVector2 monthly_number_of_recrudescence_treatment_by_location_age_;
+  LongCounter2 monthly_number_of_recrudescence_treatment_by_location_age_;
 
 public:
-  LongVector2 &monthly_number_of_recrudescence_treatment_by_location_age() {
+  LongCounter2 &monthly_number_of_recrudescence_treatment_by_location_age() {
     return monthly_number_of_recrudescence_treatment_by_location_age_;
   }
-  void set_monthly_number_of_recrudescence_treatment_by_location_age(const LongVector2 &value) {
-    monthly_number_of_recrudescence_treatment_by_location_age_ = value;
-  }
 
 private:
-  IntVector monthly_number_of_clinical_episode_by_location_;
+  IntCounter monthly_number_of_clinical_episode_by_location_;
 
 public:
-  IntVector &monthly_number_of_clinical_episode_by_location() {
+  IntCounter &monthly_number_of_clinical_episode_by_location() {
     return monthly_number_of_clinical_episode_by_location_;
   }
-  void set_monthly_number_of_clinical_episode_by_location(const IntVector &value) {
-    monthly_number_of_clinical_episode_by_location_ = value;
-  }
 
 private:
-  IntVector2 monthly_number_of_clinical_episode_by_location_age_;
+  IntCounter2 monthly_number_of_clinical_episode_by_location_age_;
 
 public:
-  IntVector2 &monthly_number_of_clinical_episode_by_location_age() {
+  IntCounter2 &monthly_number_of_clinical_episode_by_location_age() {
     return monthly_number_of_clinical_episode_by_location_age_;
   }
-  void set_monthly_number_of_clinical_episode_by_location_age(const IntVector2 &value) {
-    monthly_number_of_clinical_episode_by_location_age_ = value;
-  }
 
 private:
-  IntVector monthly_number_of_mutation_events_by_location_;
+  IntCounter monthly_number_of_mutation_events_by_location_;
 
 public:
-  IntVector &monthly_number_of_mutation_events_by_location() {
+  IntCounter &monthly_number_of_mutation_events_by_location() {
     return monthly_number_of_mutation_events_by_location_;
   }
-  void set_monthly_number_of_mutation_events_by_location(const IntVector &value) {
-    monthly_number_of_mutation_events_by_location_ = value;
-  }
 
 private:
-  IntVector2 popsize_by_location_age_;
+  IntCounter2 popsize_by_location_age_;
 
 public:
-  IntVector2 &popsize_by_location_age() { return popsize_by_location_age_; }
-  void set_popsize_by_location_age(const IntVector2 &value) { popsize_by_location_age_ = value; }
+  IntCounter2 &popsize_by_location_age() { return popsize_by_location_age_; }
 
 private:
   double tf_at_15_{0};
@@ -922,22 +779,18 @@ public:
   }
 
 private:
-  IntVector today_tf_by_therapy_;
+  IntCounter today_tf_by_therapy_;
 
 public:
-  IntVector &today_tf_by_therapy() { return today_tf_by_therapy_; }
-  void set_today_tf_by_therapy(const IntVector &value) { today_tf_by_therapy_ = value; }
+  IntCounter &today_tf_by_therapy() { return today_tf_by_therapy_; }
 
 private:
-  IntVector today_number_of_treatments_by_therapy_;
+  IntCounter today_number_of_treatments_by_therapy_;
 
 public:
-  IntVector &today_number_of_treatments_by_therapy() {
+  IntCounter &today_number_of_treatments_by_therapy() {
     return today_number_of_treatments_by_therapy_;
   }
-  void set_today_number_of_treatments_by_therapy(const IntVector &value) {
-    today_number_of_treatments_by_therapy_ = value;
-  }
 
 private:
   DoubleVector current_tf_by_therapy_;
@@ -992,27 +845,21 @@ public:
   }
 
 private:
-  LongVector2 mosquito_recombination_events_count_;
+  LongCounter2 mosquito_recombination_events_count_;
 
 public:
-  LongVector2 &mosquito_recombination_events_count() {
+  LongCounter2 &mosquito_recombination_events_count() {
     return mosquito_recombination_events_count_;
   }
-  void set_mosquito_recombination_events_count(const LongVector2 &value) {
-    mosquito_recombination_events_count_ = value;
-  }
 
-  using MutationTrackerInfo = std::tuple<int, int, int, int, int, int>;
-  std::vector<std::vector<MutationTrackerInfo>> mutation_tracker;
+  // Drug-driven mutations by (location, month in year, drug, from genotype, to genotype)
+  using MutationTracker = EventTally<5>;
+  MutationTracker mutation_tracker;
 
-  // typedef std::tuple<int, int, int, int, int, int, int, int, int, int, int>
-  // recombined_resistant_genotype_info;
-  // std::vector<std::vector<recombined_resistant_genotype_info>>
-  // mosquito_recombined_resistant_genotype_tracker;
-
-  using RecombinedResistantGenotypeInfo = std::tuple<int, int, int, int>;
-  std::vector<std::vector<RecombinedResistantGenotypeInfo>>
-      mosquito_recombined_resistant_genotype_tracker;
+  // Recombinations in mosquitoes by (location, month in year, first parent genotype,
+  // second parent genotype, recombined genotype)
+  using RecombinationTracker = EventTally<5>;
+  RecombinationTracker mosquito_recombined_resistant_genotype_tracker;
 
   static const int NUMBER_OF_REPORTED_MOI = 10;
   // disallow copy and assign
@@ -1097,170 +944,126 @@ public:
   void collect_1_clinical_episode(const int &location, const int &age_class);
 
 private:
-  IntVector monthly_treatment_failure_by_location_;
+  IntCounter monthly_treatment_failure_by_location_;
 
 public:
-  [[nodiscard]] IntVector &monthly_treatment_failure_by_location() {
+  [[nodiscard]] IntCounter &monthly_treatment_failure_by_location() {
     return monthly_treatment_failure_by_location_;
   }
-  void set_monthly_treatment_failure_by_location(const IntVector &value) {
-    monthly_treatment_failure_by_location_ = value;
-  }
 
 private:
-  IntVector monthly_nontreatment_by_location_;
+  IntCounter monthly_nontreatment_by_location_;
 
 public:
-  [[nodiscard]] IntVector &monthly_nontreatment_by_location() {
+  [[nodiscard]] IntCounter &monthly_nontreatment_by_location() {
     return monthly_nontreatment_by_location_;
   }
-  void set_monthly_nontreatment_by_location(const IntVector &value) {
-    monthly_nontreatment_by_location_ = value;
-  }
 
 private:
-  IntVector2 monthly_number_of_treatment_by_location_age_class_;
+  IntCounter2 monthly_number_of_treatment_by_location_age_class_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_number_of_treatment_by_location_age_class() {
+  [[nodiscard]] IntCounter2 &monthly_number_of_treatment_by_location_age_class() {
     return monthly_number_of_treatment_by_location_age_class_;
   }
-  void set_monthly_number_of_treatment_by_location_age_class(const IntVector2 &value) {
-    monthly_number_of_treatment_by_location_age_class_ = value;
-  }
 
 private:
-  IntVector2 monthly_number_of_clinical_episode_by_location_age_class_;
+  IntCounter2 monthly_number_of_clinical_episode_by_location_age_class_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_number_of_clinical_episode_by_location_age_class() {
+  [[nodiscard]] IntCounter2 &monthly_number_of_clinical_episode_by_location_age_class() {
     return monthly_number_of_clinical_episode_by_location_age_class_;
   }
-  void set_monthly_number_of_clinical_episode_by_location_age_class(const IntVector2 &value) {
-    monthly_number_of_clinical_episode_by_location_age_class_ = value;
-  }
 
 private:
-  IntVector births_by_location_;
+  IntCounter births_by_location_;
 
 public:
-  [[nodiscard]] IntVector &births_by_location() { return births_by_location_; }
-  void set_births_by_location(const IntVector &value) { births_by_location_ = value; }
+  [[nodiscard]] IntCounter &births_by_location() { return births_by_location_; }
 
 private:
-  IntVector deaths_by_location_;
+  IntCounter deaths_by_location_;
 
 public:
-  [[nodiscard]] IntVector &deaths_by_location() { return deaths_by_location_; }
-  void set_deaths_by_location(const IntVector &value) { deaths_by_location_ = value; }
+  [[nodiscard]] IntCounter &deaths_by_location() { return deaths_by_location_; }
 
 private:
-  IntVector malaria_deaths_by_location_;
+  IntCounter malaria_deaths_by_location_;
 
 public:
-  [[nodiscard]] IntVector &malaria_deaths_by_location() { return malaria_deaths_by_location_; }
-  void set_malaria_deaths_by_location(const IntVector &value) {
-    malaria_deaths_by_location_ = value;
-  }
+  [[nodiscard]] IntCounter &malaria_deaths_by_location() { return malaria_deaths_by_location_; }
 
 private:
-  IntVector monthly_treatment_success_by_location_;
+  IntCounter monthly_treatment_success_by_location_;
 
 public:
-  [[nodiscard]] IntVector &monthly_treatment_success_by_location() {
+  [[nodiscard]] IntCounter &monthly_treatment_success_by_location() {
     return monthly_treatment_success_by_location_;
   }
-  void set_monthly_treatment_success_by_location(const IntVector &value) {
-    monthly_treatment_success_by_location_ = value;
-  }
 
 private:
-  IntVector2 monthly_nontreatment_by_location_age_class_;
+  IntCounter2 monthly_nontreatment_by_location_age_class_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_nontreatment_by_location_age_class() {
+  [[nodiscard]] IntCounter2 &monthly_nontreatment_by_location_age_class() {
     return monthly_nontreatment_by_location_age_class_;
   }
-  void set_monthly_nontreatment_by_location_age_class(const IntVector2 &value) {
-    monthly_nontreatment_by_location_age_class_ = value;
-  }
 
 private:
-  IntVector2 malaria_deaths_by_location_age_class_;
+  IntCounter2 malaria_deaths_by_location_age_class_;
 
 public:
-  [[nodiscard]] IntVector2 &malaria_deaths_by_location_age_class() {
+  [[nodiscard]] IntCounter2 &malaria_deaths_by_location_age_class() {
     return malaria_deaths_by_location_age_class_;
   }
-  void set_malaria_deaths_by_location_age_class(const IntVector2 &value) {
-    malaria_deaths_by_location_age_class_ = value;
-  }
 
 private:
-  IntVector2 monthly_number_of_treatment_by_location_therapy_;
+  IntCounter2 monthly_number_of_treatment_by_location_therapy_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_number_of_treatment_by_location_therapy() {
+  [[nodiscard]] IntCounter2 &monthly_number_of_treatment_by_location_therapy() {
     return monthly_number_of_treatment_by_location_therapy_;
   }
-  void set_monthly_number_of_treatment_by_location_therapy(const IntVector2 &value) {
-    monthly_number_of_treatment_by_location_therapy_ = value;
-  }
 
 private:
-  IntVector2 monthly_treatment_complete_by_location_therapy_;
+  IntCounter2 monthly_treatment_complete_by_location_therapy_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_treatment_complete_by_location_therapy() {
+  [[nodiscard]] IntCounter2 &monthly_treatment_complete_by_location_therapy() {
     return monthly_treatment_complete_by_location_therapy_;
   }
-  void set_monthly_treatment_complete_by_location_therapy(const IntVector2 &value) {
-    monthly_treatment_complete_by_location_therapy_ = value;
-  }
 
 private:
-  IntVector2 monthly_treatment_failure_by_location_age_class_;
+  IntCounter2 monthly_treatment_failure_by_location_age_class_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_treatment_failure_by_location_age_class() {
+  [[nodiscard]] IntCounter2 &monthly_treatment_failure_by_location_age_class() {
     return monthly_treatment_failure_by_location_age_class_;
   }
-  void set_monthly_treatment_failure_by_location_age_class(const IntVector2 &value) {
-    monthly_treatment_failure_by_location_age_class_ = value;
-  }
 
 private:
-  IntVector2 monthly_treatment_failure_by_location_therapy_;
+  IntCounter2 monthly_treatment_failure_by_location_therapy_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_treatment_failure_by_location_therapy() {
+  [[nodiscard]] IntCounter2 &monthly_treatment_failure_by_location_therapy() {
     return monthly_treatment_failure_by_location_therapy_;
   }
-  void set_monthly_treatment_failure_by_location_therapy(const IntVector2 &value) {
-    monthly_treatment_failure_by_location_therapy_ = value;
-  }
 
 private:
-  IntVector2 monthly_treatment_success_by_location_age_class_;
+  IntCounter2 monthly_treatment_success_by_location_age_class_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_treatment_success_by_location_age_class() {
+  [[nodiscard]] IntCounter2 &monthly_treatment_success_by_location_age_class() {
     return monthly_treatment_success_by_location_age_class_;
   }
-  void set_monthly_treatment_success_by_location_age_class(const IntVector2 &value) {
-    monthly_treatment_success_by_location_age_class_ = value;
-  }
 
 private:
-  IntVector2 monthly_treatment_success_by_location_therapy_;
+  IntCounter2 monthly_treatment_success_by_location_therapy_;
 
 public:
-  [[nodiscard]] IntVector2 &monthly_treatment_success_by_location_therapy() {
+  [[nodiscard]] IntCounter2 &monthly_treatment_success_by_location_therapy() {
     return monthly_treatment_success_by_location_therapy_;
   }
-  void set_monthly_treatment_success_by_location_therapy(const IntVector2 &value) {
-    monthly_treatment_success_by_location_therapy_ = value;
-  }
 
 private:
   int64_t current_number_of_mutation_events_{0};
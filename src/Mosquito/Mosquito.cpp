@@ -9,6 +9,7 @@
 #include "Simulation/Model.h"
 #include "Utils/Random.h"
 #include "Utils/TypeDef.h"
+#include "Utils/Logger.h"
 
 Mosquito::Mosquito() {
 }
@@ -23,7 +24,7 @@ void Mosquito::initialize(Config* config) {
 
   auto &location_db = config->location_db();
   for (auto loc_index = 0; loc_index < location_db.size(); ++loc_index) {
-    if (Model::get_population()->all_alive_persons_by_location()[loc_index].empty()) continue;
+    if (Model::get_population()->size_at(loc_index) == 0) continue;
     for (auto day = 0; day < config->number_of_tracking_days(); ++day) {
       genotypes_table[day][loc_index] =
           std::vector<Genotype*>(location_db[loc_index].mosquito_size, nullptr);
@@ -44,8 +45,8 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
       // persons", tracking_index,loc);
       continue;
     }
-    spdlog::trace("Day {} ifr = {}", Model::get_scheduler()->current_time(),
-                  location_db[loc].mosquito_ifr);
+    MALASIM_LOG_HOT_TRACE("Day {} ifr = {}", Model::get_scheduler()->current_time(),
+                          location_db[loc].mosquito_ifr);
     // if there is no parasites in location
     if (population->current_force_of_infection_by_location()[loc] <= 0) {
       for (int i = 0; i < location_db[loc].mosquito_size; ++i) {
@@ -63,6 +64,17 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
     std::vector<unsigned int> interrupted_feeding_indices = build_interrupted_feeding_indices(
         random, location_db[loc].mosquito_ifr, location_db[loc].mosquito_size);
 
+    // The second sampling only covers individuals, a feed interrupted on an
+    // aggregated never-infected host adds no genotype
+    const auto aggregated_share = population->aggregated_biting_share(loc);
+    if (aggregated_share > 0) {
+      for (auto &interrupted : interrupted_feeding_indices) {
+        if (interrupted != 0U && random->random_flat(0.0, 1.0) < aggregated_share) {
+          interrupted = 0U;
+        }
+      }
+    }
+
     // uniform sampling in all person
     auto second_sampling = random->roulette_sampling<Person>(
         location_db[loc].mosquito_size, population->individual_relative_biting_by_location()[loc],
@@ -118,7 +130,7 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
             temp_if = static_cast<int>(random->random_uniform(second_sampling.size()));
             if (second_sampling[temp_if] == first_sampling[if_index]) { same_person_counter++; }
             if (same_person_counter > 10) {
-              spdlog::trace(
+              MALASIM_LOG_HOT_TRACE(
                   "second sampling is the same as first sampling, because there is 1 person and "
                   "IFR is non-zero");
               break;
@@ -197,22 +209,12 @@ void Mosquito::infect_new_cohort_in_PRMC(Config* config, utils::Random* random,
         // min_ec50, it is sensitive to that drug
         if (Model::get_scheduler()->current_time()
             >= Model::get_config()->get_simulation_timeframe().get_start_of_comparison_period()) {
-          /*
-           * Print our recombination for counting later
-           * */
-          auto resistant_tracker_info = std::make_tuple(
-              Model::get_scheduler()->current_time(), parent_genotypes[0]->genotype_id(),
-              parent_genotypes[1]->genotype_id(), sampled_genotype->genotype_id());
-          //            if
-          //            (std::find(Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].begin(),
-          //                          Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].end(),
-          //                          resistant_tracker_info)
-          //                ==
-          //                Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].end()){
-          //                Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].push_back(resistant_tracker_info);
-          //            }
-          Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].push_back(
-              resistant_tracker_info);
+          // Tally the recombination for the reporters
+          Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker.record(
+              Model::get_scheduler()->current_time(),
+              {loc, static_cast<int>(Model::get_scheduler()->get_current_month_in_year()),
+               parent_genotypes[0]->genotype_id(), parent_genotypes[1]->genotype_id(),
+               sampled_genotype->genotype_id()});
             }
         // Count number of bites
         Model::get_mdc()->mosquito_recombination_events_count()[loc][1]++;
@@ -246,6 +248,24 @@ int Mosquito::random_genotype(int location, int tracking_index) {
   return genotypes_table[tracking_index][location][genotype_index]->genotype_id();
 }
 
+bool Mosquito::random_genotypes(int location, int tracking_index, int number_of_bites,
+                                std::vector<int> &genotype_ids) {
+  genotype_ids.clear();
+  const auto &genotypes = genotypes_table[tracking_index][location];
+  int max_genotype_numbers = 0;
+  for (auto* genotype : genotypes) {
+    if (genotype != nullptr) { max_genotype_numbers++; }
+  }
+  if (max_genotype_numbers == 0) { return false; }
+
+  genotype_ids.reserve(number_of_bites);
+  for (auto bite = 0; bite < number_of_bites; bite++) {
+    const auto genotype_index = Model::get_random()->random_uniform<int>(0, max_genotype_numbers);
+    genotype_ids.push_back(genotypes[genotype_index]->genotype_id());
+  }
+  return true;
+}
+
 void Mosquito::get_genotypes_profile_from_person(
     Person* person, std::vector<Genotype*> &sampling_genotypes,
     std::vector<double> &relative_infectivity_each_pp) {
@@ -44,6 +44,11 @@ public:
 
   int random_genotype(int location, int tracking_index);
 
+  // Draw the genotype of number_of_bites bites at once, the table is only
+  // scanned once. Returns false when the table has no genotype.
+  bool random_genotypes(int location, int tracking_index, int number_of_bites,
+                        std::vector<int> &genotype_ids);
+
   // this function will populate values for both parasite densities and genotypes that carried by a person
   void get_genotypes_profile_from_person(Person *person, std::vector<Genotype *> &sampling_genotypes,
                                          std::vector<double> &relative_infectivity_each_pp);
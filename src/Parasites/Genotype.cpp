@@ -1,12 +1,14 @@
 #include "Genotype.h"
 
 #include <algorithm>
+#include <cmath>
 
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/DrugDatabase.h"
 #include "Utils/Helpers/NumberHelpers.h"
+#include "Utils/Logger.h"
 
 Genotype::Genotype(const std::string &in_aa_sequence) : aa_sequence{in_aa_sequence} {
   // create aa structure
@@ -136,10 +138,51 @@ bool Genotype::is_valid(const GenotypeParameters::PfGenotypeInfo &gene_info) {
   return true;
 }
 
+void Genotype::calculate_allele_marker_mask(
+    const GenotypeParameters::PfGenotypeInfo &gene_info,
+    const std::vector<GenotypeParameters::AlleleMarker> &markers) {
+  // The markers were validated when the genotype parameters were loaded
+  allele_marker_mask = 0;
+  for (std::size_t marker_i = 0; marker_i < markers.size(); ++marker_i) {
+    const auto &marker = markers[marker_i];
+    auto found = false;
+    for (int chromosome_i = 0; chromosome_i < pf_genotype_str.size() && !found; ++chromosome_i) {
+      const auto &genes = gene_info.chromosome_infos[chromosome_i].get_genes();
+      for (int gene_i = 0; gene_i < genes.size() && !found; ++gene_i) {
+        if (genes[gene_i].get_name() != marker.get_gene()
+            || gene_i >= pf_genotype_str[chromosome_i].size()) {
+          continue;
+        }
+        const auto &gene_str = pf_genotype_str[chromosome_i][gene_i];
+
+        if (marker.get_copy_number() > 0) {
+          if (genes[gene_i].get_max_copies() <= 1) { break; }
+          found = true;
+          if (NumberHelpers::char_to_single_digit_number(gene_str.back())
+              >= marker.get_copy_number()) {
+            allele_marker_mask |= std::uint64_t{1} << marker_i;
+          }
+          continue;
+        }
+
+        const auto &aa_positions = genes[gene_i].get_aa_positions();
+        for (int aa_i = 0; aa_i < aa_positions.size(); ++aa_i) {
+          if (aa_positions[aa_i].get_position() != marker.get_position()) { continue; }
+          found = true;
+          if (gene_str[aa_i] == marker.get_amino_acid()[0]) {
+            allele_marker_mask |= std::uint64_t{1} << marker_i;
+          }
+          break;
+        }
+      }
+    }
+  }
+}
+
 void Genotype::calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo &gene_info) {
   daily_fitness_multiple_infection = 1.0;
 
-  spdlog::trace("Genotype: {}", aa_sequence);
+  MALASIM_LOG_HOT_TRACE("Genotype: {}", aa_sequence);
   for (int chromosome_i = 0; chromosome_i < pf_genotype_str.size(); ++chromosome_i) {
     auto chromosome_info = gene_info.chromosome_infos[chromosome_i];
 
@@ -162,7 +205,7 @@ void Genotype::calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo
 
         if (res_gene_info.get_average_daily_crs() > 0) {
           daily_fitness_multiple_infection *= (1 - res_gene_info.get_average_daily_crs() * cr);
-          spdlog::trace(
+          MALASIM_LOG_HOT_TRACE(
               "\tUsing average CRS chromosome_i: {} gene_i: {} aa_i: {} cr: {} average_daily_crs: "
               "{} cr: {} (1 - res_gene_info.average_daily_crs*cr): {}",
               chromosome_i + 1, gene_i, aa_i, cr, res_gene_info.get_average_daily_crs(), cr,
@@ -170,7 +213,7 @@ void Genotype::calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo
         } else {
           daily_fitness_multiple_infection *= (1 - cr);
         }
-        spdlog::trace(
+        MALASIM_LOG_HOT_TRACE(
             "Genotype: {} chromosome_i: {} gene_i: {} aa_i: {} cr: {} "
             "daily_fitness_multiple_infection: {}",
             aa_sequence, chromosome_i + 1, gene_i, aa_i, cr, daily_fitness_multiple_infection);
@@ -182,7 +225,7 @@ void Genotype::calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo
         if (copy_number > 1) {
           daily_fitness_multiple_infection *=
               1 - res_gene_info.get_cnv_daily_crs()[copy_number - 1];
-          spdlog::trace(
+          MALASIM_LOG_HOT_TRACE(
               "Genotype: {} chromosome_i: {} gene_i: {} copy_number: {} "
               "daily_fitness_multiple_infection: {}",
               aa_sequence, chromosome_i + 1, gene_i, copy_number, daily_fitness_multiple_infection);
@@ -190,6 +233,7 @@ void Genotype::calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo
       }
     }
   }
+  log10_daily_fitness_multiple_infection = log10(daily_fitness_multiple_infection);
   //  std::cout << "\n";
 }
 
@@ -231,14 +275,14 @@ void Genotype::calculate_EC50_power_n(const GenotypeParameters::PfGenotypeInfo &
                        res_gene_info.get_multiplicative_effect_on_ec50_for_2_or_more_mutations()) {
                     if (ec50s_2_or_more.get_drug_id() == dt->id()) {
                       multiplicative_effect_factor = ec50s_2_or_more.get_factor();
-                      spdlog::trace(
+                      MALASIM_LOG_HOT_TRACE(
                           "aa_sequence: {} DOUBLE MUT drug_id: {} chr: {} gene: {} aa: {} "
                           "EC50_power_n: {} * multiplicative_effect_factor: {}  = {}",
                           aa_sequence, dt->id(), chromosome_i + 1, gene_i, aa_i,
                           EC50_power_n[dt->id()], multiplicative_effect_factor,
                           EC50_power_n[dt->id()] * multiplicative_effect_factor);
                     }
-                    spdlog::trace(
+                    MALASIM_LOG_HOT_TRACE(
                         "aa_sequence: {} SINGLE MUT drug_id: {} chr: {} gene: {} aa: {} "
                         "EC50_power_n: {} * multiplicative_effect_factor: {}  = {}",
                         aa_sequence, dt->id(), chromosome_i + 1, gene_i, aa_i, EC50_power_n[dt->id()],
@@ -260,7 +304,7 @@ void Genotype::calculate_EC50_power_n(const GenotypeParameters::PfGenotypeInfo &
           for (const auto &dt : *drug_db) {
             for (auto const &ec50s : res_gene_info.get_cnv_multiplicative_effect_on_EC50()) {
               if (ec50s.get_drug_id() == dt->id()) {
-                spdlog::trace(
+                MALASIM_LOG_HOT_TRACE(
                     "aa_sequence: {} CNV drug_id: {} chr: {} gene: {} EC50_power_n: {} * "
                     "multiplicative_effect_factor: {}  = {}",
                     aa_sequence, dt->id(), chromosome_i + 1, gene_i, EC50_power_n[dt->id()],
@@ -374,7 +418,7 @@ void Genotype::override_EC50_power_n(
       // override ec50 power n
       EC50_power_n[pattern.get_drug_id()] =
           pow(pattern.get_ec50(), drug_db->at(pattern.get_drug_id())->n());
-      spdlog::trace(
+      MALASIM_LOG_HOT_TRACE(
           "aa_sequence: {} OVERRIDE drug_id: {} genotype: {} EC50:{} n: {} EC50_power_n: {}",
           aa_sequence, pattern.get_drug_id(), aa_sequence, pattern.get_ec50(),
           drug_db->at(pattern.get_drug_id())->n(), EC50_power_n[pattern.get_drug_id()]);
@@ -1,6 +1,8 @@
 #ifndef Genotype_H
 #define Genotype_H
 
+#include <cstdint>
+
 #include "Configuration/GenotypeParameters.h"
 #include "Utils/Random.h"
 
@@ -40,9 +42,14 @@ public:
   PfGenotypeStr pf_genotype_str = std::vector<ChromosomalGenotypeStr>(14);
   std::string aa_sequence;
   double daily_fitness_multiple_infection{1};
+  double log10_daily_fitness_multiple_infection{0};
   std::vector<double> EC50_power_n;
   std::vector<MosquitoRecombinedGenotypeInfo> resistant_recombinations_in_mosquito;
 
+  // Bit i is set when the genotype carries allele marker i of the genotype parameters
+  static constexpr std::size_t MAX_ALLELE_MARKERS = 64;
+  std::uint64_t allele_marker_mask{0};
+
   [[nodiscard]] int genotype_id() const { return genotype_id_; }
   void set_genotype_id(int genotype_id) { genotype_id_ = genotype_id; }
 
@@ -61,6 +68,9 @@ public:
 
   void calculate_daily_fitness(const GenotypeParameters::PfGenotypeInfo &gene_info);
 
+  void calculate_allele_marker_mask(const GenotypeParameters::PfGenotypeInfo &gene_info,
+                                    const std::vector<GenotypeParameters::AlleleMarker> &markers);
+
   void calculate_EC50_power_n(const GenotypeParameters::PfGenotypeInfo &info,
                               DrugDatabase* p_database);
 
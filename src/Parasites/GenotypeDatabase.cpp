@@ -54,6 +54,11 @@ Genotype* GenotypeDatabase::get_genotype(const std::string &aa_sequence) {
     new_genotype->calculate_daily_fitness(
         Model::get_config()->get_genotype_parameters().get_pf_genotype_info());
 
+    // flag the allele markers, so reporters only need bit operations
+    new_genotype->calculate_allele_marker_mask(
+        Model::get_config()->get_genotype_parameters().get_pf_genotype_info(),
+        Model::get_config()->get_genotype_parameters().get_allele_markers());
+
     // calculate ec50
     new_genotype->calculate_EC50_power_n(
         Model::get_config()->get_genotype_parameters().get_pf_genotype_info(),
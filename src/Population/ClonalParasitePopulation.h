@@ -3,6 +3,7 @@
 
 #include "ParasiteDensity/ParasiteDensityUpdateFunction.h"
 #include "Treatment/Therapies/DrugType.h"
+#include "Utils/Arena.h"
 #include "Utils/Index/Indexer.h"
 
 class Therapy;
@@ -12,7 +13,7 @@ class Genotype;
 class SingleHostClonalParasitePopulations;
 
 class ClonalParasitePopulation : public utils::Indexer {
-  // OBJECTPOOL(ClonalParasitePopulation);
+  ARENA_ALLOCATED(ClonalParasitePopulation)
 public:
   // disallow copy and assign
 
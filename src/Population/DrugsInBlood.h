@@ -4,6 +4,8 @@
 #include <map>
 #include <memory>
 
+#include "Utils/Arena.h"
+
 class Person;
 
 class Drug;
@@ -15,7 +17,7 @@ class DrugType;
 using DrugPtrMap = std::map<int, std::unique_ptr<Drug>>;
 
 class DrugsInBlood {
-  // OBJECTPOOL(DrugsInBlood)
+  ARENA_ALLOCATED(DrugsInBlood)
   // Disallow copy
   DrugsInBlood(const DrugsInBlood&) = delete;
   DrugsInBlood& operator=(const DrugsInBlood&) = delete;
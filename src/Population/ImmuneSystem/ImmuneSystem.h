@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "Utils/Arena.h"
 #include "Utils/TypeDef.h"
 
 class Model;
@@ -17,7 +18,7 @@ class Config;
 // typedef std::vector<ImmuneComponent*> ImmuneComponentPtrVector;
 
 class ImmuneSystem {
-  // OBJECTPOOL(ImmuneSystem)
+  ARENA_ALLOCATED(ImmuneSystem)
 public:
   // Disallow copy
   ImmuneSystem(const ImmuneSystem&) = delete;
@@ -34,7 +35,7 @@ public:
   void set_immune_component(std::unique_ptr<ImmuneComponent> value);
 
   [[nodiscard]] bool increase() const { return increase_; }
-  void set_increase(bool increase) { increase_ = increase; }
+  void set_increase(bool increase);
 
   virtual void draw_random_immune();
 
@@ -48,7 +49,7 @@ public:
 
   [[nodiscard]] virtual double get_parasite_size_after_t_days(const int &duration,
                                                               const double &original_size,
-                                                              const double &fitness) const;
+                                                              const double &log10_fitness) const;
 
   [[nodiscard]] virtual double get_clinical_progression_probability() const;
 
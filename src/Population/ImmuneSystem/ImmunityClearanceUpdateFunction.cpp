@@ -14,5 +14,5 @@ double ImmunityClearanceUpdateFunction::get_current_parasite_density(ClonalParas
 
   auto *p = parasite->parasite_population()->person();
   return p->get_immune_system()->get_parasite_size_after_t_days(duration, parasite->last_update_log10_parasite_density(),
-                                                            parasite->genotype()->daily_fitness_multiple_infection);
+                                                            parasite->genotype()->log10_daily_fitness_multiple_infection);
 }
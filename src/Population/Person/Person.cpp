@@ -10,18 +10,15 @@
 #include <memory>
 
 #include "Core/Scheduler/Scheduler.h"
-#include "Events/BirthdayEvent.h"
 #include "Events/CirculateToTargetLocationNextDayEvent.h"
 #include "Events/EndClinicalEvent.h"
 #include "Events/MatureGametocyteEvent.h"
-#include "Events/MoveParasiteToBloodEvent.h"
 #include "Events/ProgressToClinicalEvent.h"
 #include "Events/RaptEvent.h"
 #include "Events/ReceiveMDATherapyEvent.h"
 #include "Events/ReceiveTherapyEvent.h"
 #include "Events/ReportTreatmentFailureDeathEvent.h"
 #include "Events/ReturnToResidenceEvent.h"
-#include "Events/SwitchImmuneComponentEvent.h"
 #include "Events/TestTreatmentFailureEvent.h"
 #include "Events/UpdateWhenDrugIsPresentEvent.h"
 #include "MDC/ModelDataCollector.h"
@@ -32,6 +29,7 @@
 #include "Treatment/Therapies/Drug.h"
 #include "Treatment/Therapies/MACTherapy.h"
 #include "Utils/Constants.h"
+#include "Utils/Logger.h"
 
 Person::Person() {
   immune_system_ = std::make_unique<ImmuneSystem>(this);
@@ -128,20 +126,48 @@ void Person::set_immune_system(std::unique_ptr<ImmuneSystem> value) {
   immune_system_ = std::move(value);
 }
 
-ClonalParasitePopulation* Person::add_new_parasite_to_blood(Genotype* parasite_type) const {
+ClonalParasitePopulation* Person::add_new_parasite_to_blood(Genotype* parasite_type) {
+  // The parasite density is updated from latest_update_time_
+  catch_up();
   auto blood_parasite = std::make_unique<ClonalParasitePopulation>(parasite_type);
   auto* raw_ptr = blood_parasite.get();
 
   blood_parasite->set_last_update_log10_parasite_density(
-      Model::get_config()
-          ->get_parasite_parameters()
-          .get_parasite_density_levels()
-          .get_log_parasite_density_from_liver());
+      Model::get_config()->get_run_constants().log_parasite_density_from_liver);
 
   all_clonal_parasite_populations_->add(std::move(blood_parasite));
   return raw_ptr;
 }
 
+void Person::move_liver_parasite_to_blood() {
+  auto* parasite_type = liver_parasite_type_;
+  liver_parasite_type_ = nullptr;
+
+  // add to blood
+  if (host_state_ == EXPOSED) { set_host_state(ASYMPTOMATIC); }
+
+  immune_system_->set_increase(true);
+
+  auto* new_parasite = add_new_parasite_to_blood(parasite_type);
+
+  new_parasite->set_last_update_log10_parasite_density(Model::get_random()->random_normal_truncated(
+      Model::get_config()->get_run_constants().log_parasite_density_asymptomatic, 0.5));
+
+  if (has_effective_drug_in_blood()) {
+    // person has drug in blood
+    new_parasite->set_update_function(Model::get_instance()->having_drug_update_function());
+  } else if (all_clonal_parasite_populations_->size() > 1
+             && !Model::get_config()
+                     ->get_epidemiological_parameters()
+                     .get_allow_new_coinfection_to_cause_symptoms()) {
+    new_parasite->set_update_function(Model::get_instance()->immunity_clearance_update_function());
+  } else {
+    determine_clinical_or_not(new_parasite);
+  }
+
+  schedule_mature_gametocyte_event(new_parasite);
+}
+
 double Person::relative_infectivity(const double &log10_parasite_density) {
   if (log10_parasite_density == ClonalParasitePopulation::LOG_ZERO_PARASITE_DENSITY) return 0.0;
 
@@ -293,6 +319,7 @@ void Person::receive_therapy(SCTherapy* sc_therapy, bool is_mac_therapy) {
 }
 
 void Person::add_drug_to_blood(DrugType* dt, const int &dosing_days, bool is_part_of_mac_therapy) {
+  catch_up();
   // Prepare the drug object
   auto drug = std::make_unique<Drug>(dt);
   drug->set_dosing_days(dosing_days);
@@ -413,11 +440,8 @@ void Person::determine_symptomatic_recrudescence(
     // Set the last update parasite density to the asymptomatic level
 
     clinical_caused_parasite->set_last_update_log10_parasite_density(
-        Model::get_random()->random_normal_truncated(Model::get_config()
-                                                         ->get_parasite_parameters()
-                                                         .get_parasite_density_levels()
-                                                         .get_log_parasite_density_asymptomatic(),
-                                                     0.1));
+        Model::get_random()->random_normal_truncated(
+            Model::get_config()->get_run_constants().log_parasite_density_asymptomatic, 0.1));
     // clinical_caused_parasite->set_last_update_log10_parasite_density(
     //     Model::CONFIG->parasite_density_level()
     //         .log_parasite_density_asymptomatic);
@@ -444,16 +468,10 @@ void Person::determine_symptomatic_recrudescence(
     // level, adjust it. We don't want to have high parasitaemia yn
     // asymptomatic
     if (clinical_caused_parasite->last_update_log10_parasite_density()
-        > Model::get_config()
-              ->get_parasite_parameters()
-              .get_parasite_density_levels()
-              .get_log_parasite_density_asymptomatic()) {
+        > Model::get_config()->get_run_constants().log_parasite_density_asymptomatic) {
       clinical_caused_parasite->set_last_update_log10_parasite_density(
-          Model::get_random()->random_normal_truncated(Model::get_config()
-                                                           ->get_parasite_parameters()
-                                                           .get_parasite_density_levels()
-                                                           .get_log_parasite_density_asymptomatic(),
-                                                       0.1));
+          Model::get_random()->random_normal_truncated(
+              Model::get_config()->get_run_constants().log_parasite_density_asymptomatic, 0.1));
     }
 
     if (drugs_in_blood_->size() > 0) {
@@ -475,10 +493,7 @@ void Person::determine_clinical_or_not(ClonalParasitePopulation* clinical_caused
       // progress to clinical after several days
       clinical_caused_parasite->set_update_function(Model::progress_to_clinical_update_function());
       clinical_caused_parasite->set_last_update_log10_parasite_density(
-          Model::get_config()
-              ->get_parasite_parameters()
-              .get_parasite_density_levels()
-              .get_log_parasite_density_asymptomatic());
+          Model::get_config()->get_run_constants().log_parasite_density_asymptomatic);
       schedule_progress_to_clinical_event(clinical_caused_parasite);
     } else {
       // spdlog::info("Person::determine_clinical_or_not: Person will progress to clearance");
@@ -499,6 +514,15 @@ void Person::update() {
 
   if (latest_update_time_ == Model::get_scheduler()->current_time()) return;
 
+  // Only the immunity of a dormant host changes, and its exponential decay is
+  // exact from latest_update_time_ whenever it is evaluated, so leave the host
+  // behind until catch_up() is called
+  if (is_dormant()) {
+    dormant_ = true;
+    return;
+  }
+  dormant_ = false;
+
   // update parasites by immune system
   //    std::cout << "ppu"<< std::endl;
   // update the density of each blood parasite in parasite population
@@ -516,13 +540,36 @@ void Person::update() {
   update_current_state();
 
   // update biting level only less than 1 to save performance
-  //  the other will be update in birthday event
+  //  the other will be update in the population birthday pass
   update_relative_biting_rate();
 
   latest_update_time_ = Model::get_scheduler()->current_time();
   //    std::cout << "End Person Update"<< std::endl;
 }
 
+bool Person::is_dormant() const {
+  if (host_state_ != SUSCEPTIBLE || liver_parasite_type_ != nullptr
+      || all_clonal_parasite_populations_->size() != 0 || drugs_in_blood_->size() != 0
+      || immune_system_->increase()) {
+    return false;
+  }
+  // The biting rate of infants changes within the year
+  return age_ >= 1
+         || !Model::get_config()
+                 ->get_epidemiological_parameters()
+                 .get_using_age_dependent_biting_level();
+}
+
+void Person::catch_up() {
+  if (!dormant_ || latest_update_time_ == Model::get_scheduler()->current_time()) return;
+
+  // Equivalent to the skipped daily updates: the immunity decays over the
+  // whole gap and the biting rate only depends on the age
+  immune_system_->update();
+  update_relative_biting_rate();
+  latest_update_time_ = Model::get_scheduler()->current_time();
+}
+
 void Person::update_relative_biting_rate() {
   if (Model::get_config()
           ->get_epidemiological_parameters()
@@ -538,10 +585,8 @@ void Person::update_current_state() {
   // clear drugs <=0.1
   drugs_in_blood_->clear_cut_off_drugs();
   // clear cured parasite
-  all_clonal_parasite_populations_->clear_cured_parasites(Model::get_config()
-                                                              ->get_parasite_parameters()
-                                                              .get_parasite_density_levels()
-                                                              .get_log_parasite_density_cured());
+  all_clonal_parasite_populations_->clear_cured_parasites(
+      Model::get_config()->get_run_constants().log_parasite_density_cured);
 
   if (all_clonal_parasite_populations_->size() == 0) {
     change_state_when_no_parasite_in_blood();
@@ -569,13 +614,16 @@ void Person::randomly_choose_parasite() {
 void Person::infected_by(const int &parasite_type_id) {
   // only infect if liver is available :D
   if (liver_parasite_type_ == nullptr) {
+    catch_up();
     if (host_state_ == SUSCEPTIBLE) { set_host_state(EXPOSED); }
 
     Genotype* genotype = Model::get_genotype_db()->at(parasite_type_id);
     liver_parasite_type_ = genotype;
 
-    // move parasite to blood in next 7 days
-    schedule_move_parasite_to_blood(genotype, 7);
+    // The population moves the parasite to the blood at the end of the liver stage
+    population_->person_indexes().get<PersonIndexByLiverStage>().queue(
+        this, Model::get_scheduler()->current_time(),
+        calculate_future_time(PersonIndexByLiverStage::LIVER_STAGE_DAYS));
   }
 }
 
@@ -634,10 +682,8 @@ void Person::cancel_all_return_to_residence_events() {
 }
 
 bool Person::has_detectable_parasite() const {
-  auto detectable_threshold = Model::get_config()
-                                  ->get_parasite_parameters()
-                                  .get_parasite_density_levels()
-                                  .get_log_parasite_density_detectable_pfpr();
+  auto detectable_threshold =
+      Model::get_config()->get_run_constants().log_parasite_density_detectable_pfpr;
   return all_clonal_parasite_populations_->has_detectable_parasite(detectable_threshold);
 }
 
@@ -683,43 +729,18 @@ bool Person::is_gametocytaemic() const {
 
 void Person::generate_prob_present_at_mda_by_age() {
   if (get_prob_present_at_mda_by_age().empty()) {
-    for (auto i = 0; i < Model::get_config()
-                             ->get_strategy_parameters()
-                             .get_mda()
-                             .get_mean_prob_individual_present_at_mda()
-                             .size();
-         i++) {
-      auto value =
-          Model::get_random()->random_beta(Model::get_config()
-                                               ->get_strategy_parameters()
-                                               .get_mda()
-                                               .get_prob_individual_present_at_mda_distribution()[i]
-                                               .alpha,
-                                           Model::get_config()
-                                               ->get_strategy_parameters()
-                                               .get_mda()
-                                               .get_prob_individual_present_at_mda_distribution()[i]
-                                               .beta);
+    const auto &mda = Model::get_config()->get_strategy_parameters().get_mda();
+    const auto &distribution = mda.get_prob_individual_present_at_mda_distribution();
+    for (auto i = 0; i < mda.get_mean_prob_individual_present_at_mda().size(); i++) {
+      auto value = Model::get_random()->random_beta(distribution[i].alpha, distribution[i].beta);
       prob_present_at_mda_by_age_.push_back(value);
     }
   }
 }
 
 double Person::prob_present_at_mda() {
-  auto mda_age_index = 0;
-  // std::cout << "hello " << i << std::endl;
-  while (age_ > Model::get_config()
-                    ->get_strategy_parameters()
-                    .get_mda()
-                    .get_age_bracket_prob_individual_present_at_mda()[mda_age_index]
-         && mda_age_index < Model::get_config()
-                                ->get_strategy_parameters()
-                                .get_mda()
-                                .get_age_bracket_prob_individual_present_at_mda()
-                                .size()) {
-    mda_age_index++;
-  }
-
+  const auto mda_age_index =
+      Model::get_config()->get_strategy_parameters().get_mda().age_bracket_of(age_);
   return prob_present_at_mda_by_age_[mda_age_index];
 }
 
@@ -730,8 +751,6 @@ bool Person::has_effective_drug_in_blood() const {
   return false;
 }
 
-bool Person::has_birthday_event() const { return has_event<BirthdayEvent>(); }
-
 bool Person::has_update_by_having_drug_event() const {
   return has_event<UpdateWhenDrugIsPresentEvent>();
 }
@@ -770,7 +789,12 @@ double Person::age_in_floating(int simulation_time) const {
  * NEW KIEN
  */
 
-void Person::increase_age_by_1_year() { set_age(age_ + 1); }
+void Person::increase_age_by_1_year() {
+  catch_up();
+  set_age(age_ + 1);
+  // Dormant hosts would otherwise keep the biting rate of the previous age
+  if (dormant_) { update_relative_biting_rate(); }
+}
 
 PersonEvent* Person::schedule_basic_event(std::unique_ptr<PersonEvent> event) {
   event->set_person(this);
@@ -852,7 +876,7 @@ void Person::schedule_clinical_recurrence_event(ClonalParasitePopulation* parasi
     if (end_clinical_event != nullptr) {
       int end_clinical_existing_time = end_clinical_event->get_time();
       if (new_event_time <= end_clinical_existing_time) {
-        spdlog::info(
+        MALASIM_LOG_HOT_DEBUG(
             "Model time {}, schedule recurrence event at time {}, clinical end event at time {}",
             Model::get_scheduler()->current_time(),new_event_time,end_clinical_existing_time);
       }
@@ -922,19 +946,6 @@ void Person::schedule_receive_therapy_event(ClonalParasitePopulation* parasite,
   schedule_basic_event(std::move(event));
 }
 
-void Person::schedule_switch_immune_component_event(int days_delay) {
-  auto event = std::make_unique<SwitchImmuneComponentEvent>(this);
-  event->set_time(calculate_future_time(days_delay));
-  schedule_basic_event(std::move(event));
-}
-
-void Person::schedule_move_parasite_to_blood(Genotype* genotype, int days_delay) {
-  auto event = std::make_unique<MoveParasiteToBloodEvent>(this);
-  event->set_time(calculate_future_time(days_delay));
-  event->set_infection_genotype(genotype);
-  schedule_basic_event(std::move(event));
-}
-
 void Person::schedule_mature_gametocyte_event(ClonalParasitePopulation* parasite) {
   const int days_to_mature = (age_ <= 5) ? Model::get_config()
                                                ->get_epidemiological_parameters()
@@ -964,15 +975,6 @@ void Person::schedule_return_to_residence_event(int length_of_trip) {
   schedule_basic_event(std::move(event));
 }
 
-void Person::schedule_birthday_event(int days_to_next_birthday) {
-  if (days_to_next_birthday <= 0) {
-    throw std::invalid_argument("days_to_next_birthday must be greater than 0");
-  }
-  auto event = std::make_unique<BirthdayEvent>(this);
-  event->set_time(calculate_future_time(days_to_next_birthday));
-  schedule_basic_event(std::move(event));
-}
-
 int Person::calculate_future_time(int days_from_now) {
   return Model::get_scheduler()->current_time() + days_from_now;
 }
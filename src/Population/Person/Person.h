@@ -8,7 +8,10 @@
 
 #include "Events/Event.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
+#include "Utils/Arena.h"
 #include "Utils/Index/PersonIndexAllHandler.h"
+#include "Utils/Index/PersonIndexByBirthdayHandler.h"
+#include "Utils/Index/PersonIndexByLiverStageHandler.h"
 #include "Utils/Index/PersonIndexByLocationMovingLevelHandler.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClassHandler.h"
 
@@ -24,8 +27,10 @@ class ImmuneSystem;
 
 class Person : public PersonIndexAllHandler,
                public PersonIndexByLocationStateAgeClassHandler,
-               public PersonIndexByLocationMovingLevelHandler {
-  // OBJECTPOOL(Person)
+               public PersonIndexByLocationMovingLevelHandler,
+               public PersonIndexByBirthdayHandler,
+               public PersonIndexByLiverStageHandler {
+  ARENA_ALLOCATED(Person)
 public:
   // day_that_last_trip_outside_district_was_initiated_sable copy and assignment
   Person(const Person &) = delete;
@@ -90,6 +95,14 @@ public:
 
   void update();
 
+  // A dormant host is susceptible with no parasites, no drugs and a decaying
+  // immunity; its daily update is skipped and done in closed form by
+  // catch_up() when the host is touched (bitten, treated, reported, ageing)
+  [[nodiscard]] bool is_dormant() const;
+
+  // Bring a host skipped by update() up to the current day, no-op otherwise
+  void catch_up();
+
   [[nodiscard]] Population* get_population() const { return population_; }
   void set_population(Population* population) { population_ = population; }
 
@@ -201,7 +214,11 @@ public:
     liver_parasite_type_ = liver_parasite_type;
   }
 
-  ClonalParasitePopulation* add_new_parasite_to_blood(Genotype* parasite_type) const;
+  ClonalParasitePopulation* add_new_parasite_to_blood(Genotype* parasite_type);
+
+  // End of the liver stage: the liver parasite enters the blood at the
+  // asymptomatic density
+  void move_liver_parasite_to_blood();
 
   static double relative_infectivity(const double &log10_parasite_density);
 
@@ -243,8 +260,6 @@ public:
 
   void increase_number_of_times_bitten();
 
-  [[nodiscard]] bool has_birthday_event() const;
-
   [[nodiscard]] bool has_update_by_having_drug_event() const;
 
   [[nodiscard]] double get_age_dependent_biting_factor() const;
@@ -279,10 +294,8 @@ public:
   void schedule_receive_mda_therapy_event(Therapy* therapy, int days_delay);
   void schedule_receive_therapy_event(ClonalParasitePopulation* parasite, Therapy* therapy,
                                       int days_delay, bool is_part_of_mac_therapy = false);
-  void schedule_switch_immune_component_event(int days_delay);
 
   // Group 2: Parasite Event Scheduling
-  void schedule_move_parasite_to_blood(Genotype* genotype, int days_delay);
   void schedule_mature_gametocyte_event(ClonalParasitePopulation* parasite);
   void schedule_update_by_drug_event(ClonalParasitePopulation* parasite);
 
@@ -290,9 +303,6 @@ public:
   void schedule_move_to_target_location_next_day_event(int target_location);
   void schedule_return_to_residence_event(int length_of_trip);
 
-  // Group 4: Person Event Scheduling
-  void schedule_birthday_event(int days_to_next_birthday = -1);
-
   static int complied_dosing_days(const int &dosing_day);
   static int complied_dosing_days(const SCTherapy* therapy);
   // Helper methods for scheduling
@@ -307,6 +317,8 @@ private:
   int age_class_{0};
   int birthday_{0};
   int latest_update_time_{-1};
+  // Set when the last update() was skipped, latest_update_time_ may lag
+  bool dormant_{false};
   int moving_level_{0};
   std::vector<int> today_infections_;
   std::vector<int> today_target_locations_;
@@ -4,14 +4,14 @@
 #include <Utils/Random.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cfloat>
 #include <memory>
+#include <numeric>
 
 #include "ClinicalUpdateFunction.h"
 #include "Configuration/Config.h"
 #include "Core/Scheduler/Scheduler.h"
-#include "Events/BirthdayEvent.h"
-#include "Events/SwitchImmuneComponentEvent.h"
 #include "ImmuneSystem/ImmuneSystem.h"
 #include "ImmuneSystem/InfantImmuneComponent.h"
 #include "ImmuneSystem/NonInfantImmuneComponent.h"
@@ -19,17 +19,15 @@
 #include "Mosquito/Mosquito.h"
 #include "Parasites/Genotype.h"
 #include "Person/Person.h"
+#include "Reporters/Specialist/MovementReporter.h"
 #include "Utils/Constants.h"
 #include "Utils/Index/PersonIndex.h"
 #include "Utils/Index/PersonIndexAll.h"
 #include "Utils/Index/PersonIndexByLocationMovingLevel.h"
 #include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/Logger.h"
 
-Population::Population() {
-  person_index_list_ = std::make_unique<PersonIndexPtrList>();
-
-  all_persons_ = std::make_unique<PersonIndexAll>();
-}
+Population::Population() { all_persons_ = std::make_unique<PersonIndexAll>(); }
 
 Population::~Population() {
   // persons_.clear();
@@ -38,12 +36,6 @@ Population::~Population() {
     all_persons_->clear();
     all_persons_.reset();
   }
-
-  // release person_indexes
-  if (person_index_list_ != nullptr) {
-    person_index_list_->clear();
-    person_index_list_.reset();
-  }
 }
 
 void Population::initialize() {
@@ -76,6 +68,7 @@ void Population::initialize() {
 
     // initalize person indexes
     initialize_person_indices();
+    initialize_susceptible_compartment();
 
     // Initialize population
     auto &location_db = Model::get_config()->location_db();
@@ -118,22 +111,41 @@ void Population::initialize_person_indices() {
   const int number_of_host_states = Person::NUMBER_OF_STATE;
   const int number_of_age_classes = Model::get_config()->number_of_age_classes();
 
-  auto p_index_by_l_s_a = std::make_unique<PersonIndexByLocationStateAgeClass>(
+  person_indexes_.get<PersonIndexByLocationStateAgeClass>().Initialize(
       number_of_location, number_of_host_states, number_of_age_classes);
-  person_index_list_->push_back(std::move(p_index_by_l_s_a));
 
-  auto p_index_location_moving_level = std::make_unique<PersonIndexByLocationMovingLevel>(
+  person_indexes_.get<PersonIndexByLocationMovingLevel>().Initialize(
       number_of_location, Model::get_config()
                               ->get_movement_settings()
                               .get_circulation_info()
                               .get_number_of_moving_levels());
-  person_index_list_->push_back(std::move(p_index_location_moving_level));
+  person_indexes_initialized_ = true;
+}
+
+void Population::initialize_susceptible_compartment() {
+  susceptible_compartment_.reset();
+  const auto &demographic = Model::get_config()->get_population_demographic();
+  if (!demographic.get_aggregate_never_infected_susceptibles()) { return; }
+
+  const auto &epidemiological_parameters = Model::get_config()->get_epidemiological_parameters();
+  if (epidemiological_parameters.get_using_age_dependent_biting_level()) {
+    // The weight of a cell would depend on the exact ages of its persons
+    spdlog::warn(
+        "Aggregated susceptibles are not supported with age dependent biting, the population "
+        "is fully individual-based");
+    return;
+  }
+  const auto &biting_info = epidemiological_parameters.get_relative_biting_info();
+  susceptible_compartment_ = std::make_unique<SusceptibleCompartment>(
+      Model::get_config()->number_of_locations(), Model::get_config()->age_structure(),
+      demographic.get_number_of_biting_rate_buckets(),
+      biting_info.get_min_relative_biting_value(), biting_info.get_max_relative_biting_value());
 }
 
 void Population::add_person(std::unique_ptr<Person> person) {
   // persons_.push_back(person);
   person->set_population(this);
-  for (auto &person_index : *person_index_list_) { person_index->add(person.get()); }
+  if (person_indexes_initialized_) { person_indexes_.add(person.get()); }
 
   // Update the count at the location
   popsize_by_location_[person->get_location()]++;
@@ -146,14 +158,19 @@ void Population::remove_dead_person(Person* person) { remove_person(person); }
 void Population::remove_person(Person* person) {
   // persons_.erase(std::ranges::remove(persons_, person).begin(), persons_.end());
   popsize_by_location_[person->get_location()]--;
-  for (auto &person_index : *person_index_list_) { person_index->remove(person); }
+  if (person_indexes_initialized_) {
+    person_indexes_.remove(person);
+  } else {
+    // Person::infected_by queues the person whether or not the indices are initialized
+    person_indexes_.get<PersonIndexByLiverStage>().remove(person);
+  }
   all_persons_->remove(person);
 }
 
 void Population::notify_change(Person* person, const Person::Property &property,
                                const void* old_value, const void* new_value) {
-  for (auto &person_index : *person_index_list_) {
-    person_index->notify_change(person, property, old_value, new_value);
+  if (person_indexes_initialized_) {
+    person_indexes_.notify_change(person, property, old_value, new_value);
   }
 }
 
@@ -161,14 +178,23 @@ void Population::notify_movement(const int source, const int destination) {
   popsize_by_location_[source]--;
   assert(popsize_by_location_[source] >= 0);
   popsize_by_location_[destination]++;
+
+  if (movement_reporter_ != nullptr) { movement_reporter_->record_movement(source, destination); }
 }
 
 std::size_t Population::size(const int &location, const int &age_class) {
-  if (location == -1) { return all_persons_->size(); }
+  if (location == -1) {
+    return all_persons_->size()
+           + (susceptible_compartment_ == nullptr ? 0 : susceptible_compartment_->size());
+  }
   auto* pi_lsa = get_person_index<PersonIndexByLocationStateAgeClass>();
 
   if (pi_lsa == nullptr) { return 0; }
   std::size_t temp = 0;
+  if (susceptible_compartment_ != nullptr) {
+    temp += age_class == -1 ? susceptible_compartment_->size(location)
+                            : susceptible_compartment_->size(location, age_class);
+  }
   if (age_class == -1) {
     for (auto state = 0; state < Person::NUMBER_OF_STATE - 1; state++) {
       for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
@@ -185,19 +211,25 @@ std::size_t Population::size(const int &location, const int &age_class) {
 
 std::size_t Population::size(const int &location, const Person::HostStates &hs,
                              const int &age_class) {
-  if (location == -1) { return all_persons_->size(); }
+  if (location == -1) { return size(); }
   auto* pi_lsa = get_person_index<PersonIndexByLocationStateAgeClass>();
+  if (hs == Person::SUSCEPTIBLE && susceptible_compartment_ != nullptr) {
+    return pi_lsa->vPerson()[location][hs][age_class].size()
+           + susceptible_compartment_->size(location, age_class);
+  }
   return (pi_lsa->vPerson()[location][hs][age_class].size());
 }
 
 // new
 std::size_t Population::size_residents_only(const int &location) {
-  if (location == -1) { return all_persons_->size(); }
+  if (location == -1) { return size(); }
 
   auto* pi_lsa = get_person_index<PersonIndexByLocationStateAgeClass>();
 
   if (pi_lsa == nullptr) { return 0; }
-  auto temp = 0;
+  // Aggregated persons never leave their residence
+  std::size_t temp =
+      susceptible_compartment_ == nullptr ? 0 : susceptible_compartment_->size(location);
   for (auto state = 0; state < Person::NUMBER_OF_STATE - 1; state++) {
     for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
       for (auto i = 0; i < pi_lsa->vPerson()[location][state][ac].size(); i++) {
@@ -218,15 +250,44 @@ void Population::perform_infection_event() {
   //    std::cout << "Infection Event" << std::endl;
 
   PersonPtrVector today_infections;
+  // Per-bite draws of a location, reused across the locations
+  std::vector<int> genotype_ids;
+  std::vector<double> draws;
+
   auto tracking_index =
       Model::get_scheduler()->current_time() % Model::get_config()->number_of_tracking_days();
+  const auto* seasonal_factors = Model::get_config()->get_seasonality_settings().get_seasonal_factors(
+      Model::get_scheduler()->get_calendar_date());
+
+  // Probability that an infectious bite infects the person, the branch does
+  // not change during the day
+  const auto &transmission_settings = Model::get_config()->get_transmission_settings();
+  const auto using_variable_probability =
+      Model::get_config()
+          ->get_epidemiological_parameters()
+          .get_using_variable_probability_infectious_bites_cause_infection();
+  const auto transmission_parameter = transmission_settings.get_transmission_parameter();
+  const auto p_infection_from_an_infectious_bite =
+      transmission_settings.get_p_infection_from_an_infectious_bite();
+  const auto probability_of_infection = [&](Person* person) {
+    if (!using_variable_probability) { return p_infection_from_an_infectious_bite; }
+    if (transmission_parameter <= 0.0) { return person->p_infection_from_an_infectious_bite(); }
+    // Get the probability of infection of a naive individual
+    const double pr = transmission_parameter;
+    // Get the current immunity and calculate the baseline probability
+    const double theta = person->get_immune_system()->get_current_value();
+    // High immunity reduces likelihood of infection
+    if (theta > 0.8) { return 0.1; }
+    // Low immunity sets likelihood at the probability of infection
+    if (theta < 0.2) { return pr; }
+    return (pr * (1 - (theta - 0.2) / 0.6)) + (0.1 * ((theta - 0.2) / 0.6));
+  };
+
   for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
     const auto force_of_infection = force_of_infection_for_n_days_by_location_[tracking_index][loc];
     if (force_of_infection <= DBL_EPSILON) continue;
 
-    const auto new_beta = Model::get_config()->location_db()[loc].beta
-                          * Model::get_config()->get_seasonality_settings().get_seasonal_factor(
-                              Model::get_scheduler()->get_calendar_date(), loc);
+    const auto new_beta = Model::get_config()->location_db()[loc].beta * seasonal_factors[loc];
 
     auto poisson_means = new_beta * force_of_infection;
 
@@ -236,69 +297,40 @@ void Population::perform_infection_event() {
     // data_collector store number of bites
     Model::get_mdc()->collect_number_of_bites(loc, number_of_bites);
 
-    if (Model::get_population()->all_alive_persons_by_location_[loc].empty()) {
-      spdlog::trace("all_alive_persons_by_location location {} is empty", loc);
+    auto persons_bitten_today =
+        sample_persons_by_biting(loc, number_of_bites, sum_relative_biting_by_location_[loc]);
+    if (persons_bitten_today.empty()) {
+      MALASIM_LOG_HOT_TRACE("all_alive_persons_by_location location {} is empty", loc);
       continue;
     }
-    auto persons_bitten_today = Model::get_random()->roulette_sampling<Person>(
-        number_of_bites, individual_relative_biting_by_location_[loc],
-        all_alive_persons_by_location_[loc], false, sum_relative_biting_by_location_[loc]);
 
     for (auto* person : persons_bitten_today) {
       assert(person->get_host_state() != Person::DEAD);
       person->increase_number_of_times_bitten();
+    }
 
-      if (Model::get_mosquito()->genotypes_table[tracking_index][loc].empty()) { continue; }
-      auto genotype_id = Model::get_mosquito()->random_genotype(loc, tracking_index);
-      if (genotype_id == -1) {
-        spdlog::trace("mosquito genotypes_table[{}][{}] is empty", tracking_index, loc);
-        continue;
-      }
+    // Draw the genotype and the infection Bernoulli of every bite up front
+    const auto bites = static_cast<int>(persons_bitten_today.size());
+    if (!Model::get_mosquito()->random_genotypes(loc, tracking_index, bites, genotype_ids)) {
+      MALASIM_LOG_HOT_TRACE("mosquito genotypes_table[{}][{}] is empty", tracking_index, loc);
+      continue;
+    }
+    draws.resize(bites);
+    for (auto &draw : draws) { draw = Model::get_random()->random_flat(0.0, 1.0); }
 
-      const auto draw = Model::get_random()->random_flat(0.0, 1.0);
-      // only infect with real infectious bite
-      if (Model::get_config()
-              ->get_epidemiological_parameters()
-              .get_using_variable_probability_infectious_bites_cause_infection()) {
-        if (Model::get_config()->get_transmission_settings().get_transmission_parameter() > 0.0) {
-          // Get the probability of infection of a naive individual
-          double pr = Model::get_config()->get_transmission_settings().get_transmission_parameter();
-          // Get the current immunity and calculate the baseline probability
-          double theta = person->get_immune_system()->get_current_value();
-          double pr_inf = (pr * (1 - (theta - 0.2) / 0.6)) + (0.1 * ((theta - 0.2) / 0.6));
-          // High immunity reduces likelihood of infection
-          if (theta > 0.8) { pr_inf = 0.1; }
-          // Low immunity sets likelihood at the probability of infection
-          if (theta < 0.2) { pr_inf = pr; }
-          if (draw <= pr_inf) {
-            if (person->get_host_state() != Person::EXPOSED
-                && person->liver_parasite_type() == nullptr) {
-              person->get_today_infections().push_back(genotype_id);
-              today_infections.push_back(person);
-            }
-          }
-        } else {
-          if (draw <= person->p_infection_from_an_infectious_bite()) {
-            if (person->get_host_state() != Person::EXPOSED
-                && person->liver_parasite_type() == nullptr) {
-              person->get_today_infections().push_back(genotype_id);
-              today_infections.push_back(person);
-            }
-          }
-        }
-      } else if (draw <= Model::get_config()
-                             ->get_transmission_settings()
-                             .get_p_infection_from_an_infectious_bite()) {
-        if (person->get_host_state() != Person::EXPOSED
-            && person->liver_parasite_type() == nullptr) {
-          person->get_today_infections().push_back(genotype_id);
-          today_infections.push_back(person);
-        }
+    // only infect with real infectious bite
+    for (auto bite = 0; bite < bites; bite++) {
+      auto* person = persons_bitten_today[bite];
+      if (person->get_host_state() == Person::EXPOSED || person->liver_parasite_type() != nullptr) {
+        continue;
       }
+      if (draws[bite] > probability_of_infection(person)) { continue; }
+      person->get_today_infections().push_back(genotype_ids[bite]);
+      today_infections.push_back(person);
     }
   }
   //    std::cout << "Solve infections"<< std::endl;
-  // solve Multiple infections
+  // solve Multiple infections, the chosen parasites join the liver stage queue
   if (today_infections.empty()) return;
 
   for (auto* person : today_infections) {
@@ -313,13 +345,6 @@ void Population::perform_infection_event() {
 }
 
 void Population::generate_individual(int location, int age_class) {
-  auto person = std::make_unique<Person>();
-  person->initialize();
-
-  person->set_location(location);
-  person->set_residence_location(location);
-  person->set_host_state(Person::SUSCEPTIBLE);
-
   // Set the age of the individual, which also sets the age class. Note that we
   // are defining the types to conform to the signature of random_uniform<int>
   uint age_from = (age_class == 0) ? 0
@@ -328,43 +353,130 @@ void Population::generate_individual(int location, int age_class) {
                                          .get_initial_age_structure()[age_class - 1];
   uint age_to =
       Model::get_config()->get_population_demographic().get_initial_age_structure()[age_class];
-  person->set_age(static_cast<int>(Model::get_random()->random_uniform<int>(
-      static_cast<int>(age_from), static_cast<int>(age_to) + 1)));
 
+  const auto age = Model::get_random()->random_uniform<int>(static_cast<int>(age_from),
+                                                            static_cast<int>(age_to) + 1);
+  const auto birthday = draw_birthday(age);
+
+  if (susceptible_compartment_ != nullptr) {
+    // Everyone starts never-infected, the initial cases are promoted later
+    susceptible_compartment_->add(
+        location, susceptible_compartment_->age_class_of(age), birthday,
+        Person::draw_random_relative_biting_rate(Model::get_random(), Model::get_config()), true);
+    popsize_by_location_[location]++;
+    return;
+  }
+
+  auto person = make_individual(location, age, birthday, true);
+
+  // Get current values once to avoid repeated calls
+  const auto current_relative_biting_rate = person->get_current_relative_biting_rate();
+  const auto &moving_level_value = Model::get_config()
+                                       ->get_movement_settings()
+                                       .get_v_moving_level_value()[person->get_moving_level()];
+
+  individual_relative_biting_by_location_[location].push_back(current_relative_biting_rate);
+  individual_relative_moving_by_location_[location].push_back(moving_level_value);
+
+  sum_relative_biting_by_location_[location] += current_relative_biting_rate;
+  sum_relative_moving_by_location_[location] += moving_level_value;
+
+  all_alive_persons_by_location_[location].push_back(person.get());
+  add_person(std::move(person));
+}
+
+int Population::draw_birthday(int age) {
   auto days_to_next_birthday =
       static_cast<int>(Model::get_random()->random_uniform((Constants::DAYS_IN_YEAR))) + 1;
 
-  // this will get the birthday in simulation time
+  // this will get the birthday relative to today
   auto ymd = Model::get_scheduler()->get_ymd_after_days(days_to_next_birthday)
-             - date::years(person->get_age() + 1);
-  auto simulation_time_birthday = Model::get_scheduler()->get_days_to_ymd(ymd);
-
-  // spdlog::info(" age: {}, simulation_time_birthday: {}, days_to_next_birthday: {}", p->get_age(),
-  //              simulation_time_birthday, days_to_next_birthday);
-  person->set_birthday(simulation_time_birthday);
+             - date::years(age + 1);
+  auto days_since_birthday = Model::get_scheduler()->get_days_to_ymd(ymd);
 
-  if (simulation_time_birthday > 0) {
+  // spdlog::info(" age: {}, days_since_birthday: {}, days_to_next_birthday: {}", age,
+  //              days_since_birthday, days_to_next_birthday);
+  if (days_since_birthday > 0) {
     spdlog::error("simulation_time_birthday have to be <= 0 when initializing population");
   }
+  return Model::get_scheduler()->current_time() + days_since_birthday;
+}
+
+int Population::age_of(int birthday) {
+  // Whole years as counted by perform_birthday_event, so those born on 29
+  // February age on 1 March in the other years
+  const auto today = Model::get_scheduler()->get_calendar_date();
+  const auto born =
+      Model::get_scheduler()->get_ymd_after_days(birthday - Model::get_scheduler()->current_time());
+  auto age = static_cast<int>((today.year() - born.year()).count());
+  if (date::month_day{today.month(), today.day()} < date::month_day{born.month(), born.day()}) {
+    age--;
+  }
+  return std::max(age, 0);
+}
+
+std::vector<int> Population::ageing_birthday_cutoffs() {
+  const auto today = Model::get_scheduler()->get_calendar_date();
+  const auto &age_structure = Model::get_config()->age_structure();
+  std::vector<int> cutoffs;
+  for (auto ac = 0; ac + 1 < static_cast<int>(age_structure.size()); ac++) {
+    // Latest birthday of those old enough to leave the age class today, a 29
+    // February in a year without one falls back to the 28th
+    auto ymd = today - date::years(age_structure[ac]);
+    if (!ymd.ok()) { ymd = ymd.year() / ymd.month() / date::last; }
+    cutoffs.push_back(Model::get_scheduler()->current_time()
+                      + Model::get_scheduler()->get_days_to_ymd(ymd));
+  }
+  return cutoffs;
+}
 
-  person->schedule_birthday_event(days_to_next_birthday);
+std::unique_ptr<Person> Population::make_individual(int location, int age, int birthday,
+                                                    bool initial_population) {
+  auto person = std::make_unique<Person>();
+  person->initialize();
+
+  person->set_location(location);
+  person->set_residence_location(location);
+  person->set_host_state(Person::SUSCEPTIBLE);
+
+  person->set_age(age);
+  person->set_birthday(birthday);
+  const auto days_since_birthday = birthday - Model::get_scheduler()->current_time();
+
+  if (initial_population) {
+    // The birthday and the switch of the immune component at 6 months are
+    // handled by perform_birthday_event
+    if (days_since_birthday + Constants::DAYS_IN_YEAR / 2 >= 0) {
+      if (person->get_age() > 0) { spdlog::error("Error in calculating simulation_time_birthday"); }
+      person->get_immune_system()->set_immune_component(
+          std::make_unique<InfantImmuneComponent>());
+    } else {
+      // LOG(INFO) << "Adult: " << p->age() << " - " << simulation_time_birthday;
+      person->get_immune_system()->set_immune_component(
+          std::make_unique<NonInfantImmuneComponent>());
+    }
 
-  // set immune component at 6 months
-  if (simulation_time_birthday + Constants::DAYS_IN_YEAR / 2 >= 0) {
-    if (person->get_age() > 0) { spdlog::error("Error in calculating simulation_time_birthday"); }
+    auto immune_value = Model::get_random()->random_beta(
+        Model::get_config()->get_immune_system_parameters().alpha_immune,
+        Model::get_config()->get_immune_system_parameters().beta_immune);
+    person->get_immune_system()->immune_component()->set_latest_value(immune_value);
+    // The drawn value is the immunity at the start of the simulation, a member
+    // promoted later has been decaying since then
+    if (Model::get_scheduler()->current_time() > 0) {
+      person->set_latest_update_time(0);
+      person->get_immune_system()->update();
+    }
+  } else if (days_since_birthday + (Constants::DAYS_IN_YEAR / 2) > 0) {
+    // Never infected since birth, the immunity is what give_1_birth and
+    // perform_birthday_event leave: maternal immunity decaying since birth
+    // until six months old, none afterwards
     person->get_immune_system()->set_immune_component(std::make_unique<InfantImmuneComponent>());
-    // schedule for switch
-    person->schedule_switch_immune_component_event(simulation_time_birthday
-                                                   + (Constants::DAYS_IN_YEAR / 2));
+    person->get_immune_system()->set_latest_immune_value(1.0);
+    person->set_latest_update_time(birthday);
+    person->get_immune_system()->update();
   } else {
-    // LOG(INFO) << "Adult: " << p->age() << " - " << simulation_time_birthday;
     person->get_immune_system()->set_immune_component(std::make_unique<NonInfantImmuneComponent>());
   }
-
-  auto immune_value = Model::get_random()->random_beta(
-      Model::get_config()->get_immune_system_parameters().alpha_immune,
-      Model::get_config()->get_immune_system_parameters().beta_immune);
-  person->get_immune_system()->immune_component()->set_latest_value(immune_value);
   person->get_immune_system()->set_increase(false);
 
   person->set_innate_relative_biting_rate(
@@ -376,26 +488,85 @@ void Population::generate_individual(int location, int age_class) {
   person->set_moving_level(
       movement_settings.get_moving_level_generator().draw_random_level(Model::get_random()));
 
-  person->set_latest_update_time(0);
+  person->set_latest_update_time(Model::get_scheduler()->current_time());
 
   person->generate_prob_present_at_mda_by_age();
 
-  // spdlog::info("Population::initialize: person {} age {} location {} moving level {}",
-  //   i, p->get_age(), loc, p->get_moving_level());
+  return person;
+}
 
-  // Get current values once to avoid repeated calls
-  const auto current_relative_biting_rate = person->get_current_relative_biting_rate();
-  const auto moving_level = person->get_moving_level();
-  const auto &moving_level_value = movement_settings.get_v_moving_level_value()[moving_level];
+Person* Population::promote_susceptible(int location,
+                                        const SusceptibleCompartment::Member &member) {
+  // The age and the immunity follow from the birthday kept by the compartment
+  auto person = make_individual(location, age_of(member.birthday), member.birthday,
+                                member.initial_population);
+  person->set_innate_relative_biting_rate(member.relative_biting_rate);
+  person->update_relative_biting_rate();
 
-  individual_relative_biting_by_location_[location].push_back(current_relative_biting_rate);
-  individual_relative_moving_by_location_[location].push_back(moving_level_value);
+  auto* raw_ptr = person.get();
+  // add_person counts the person at the location again
+  popsize_by_location_[location]--;
+  add_person(std::move(person));
+  return raw_ptr;
+}
 
-  sum_relative_biting_by_location_[location] += current_relative_biting_rate;
-  sum_relative_moving_by_location_[location] += moving_level_value;
+std::vector<Person*> Population::sample_persons_by_biting(int location, int number_of_samples,
+                                                          double sum_relative_biting) {
+  if (susceptible_compartment_ == nullptr || susceptible_compartment_->size(location) == 0) {
+    if (all_alive_persons_by_location_[location].empty()) { return {}; }
+    return Model::get_random()->roulette_sampling<Person>(
+        number_of_samples, individual_relative_biting_by_location_[location],
+        all_alive_persons_by_location_[location], false, sum_relative_biting);
+  }
 
-  all_alive_persons_by_location_[location].push_back(person.get());
-  add_person(std::move(person));
+  if (sum_relative_biting < 0) {
+    sum_relative_biting = std::accumulate(individual_relative_biting_by_location_[location].begin(),
+                                          individual_relative_biting_by_location_[location].end(),
+                                          0.0);
+  }
+  const auto aggregated_weight = susceptible_compartment_->biting_weight(location);
+  const auto aggregated_share = aggregated_weight / (aggregated_weight + sum_relative_biting);
+  auto number_of_promotions = static_cast<int>(Model::get_random()->random_binomial(
+      std::min(1.0, aggregated_share), static_cast<unsigned int>(number_of_samples)));
+  if (all_alive_persons_by_location_[location].empty()) {
+    number_of_promotions = number_of_samples;
+  }
+
+  std::vector<Person*> samples;
+  if (number_of_promotions < number_of_samples) {
+    samples = Model::get_random()->roulette_sampling<Person>(
+        number_of_samples - number_of_promotions, individual_relative_biting_by_location_[location],
+        all_alive_persons_by_location_[location], false, sum_relative_biting);
+  }
+  // Repeated bites on the same aggregated person are rare enough to ignore
+  for (auto i = 0; i < number_of_promotions && susceptible_compartment_->size(location) > 0; i++) {
+    samples.push_back(promote_susceptible(
+        location, susceptible_compartment_->remove_by_biting(location, Model::get_random())));
+  }
+  return samples;
+}
+
+Person* Population::sample_susceptible(int location, int age_class) {
+  auto &persons = get_person_index<PersonIndexByLocationStateAgeClass>()
+                      ->vPerson()[location][Person::SUSCEPTIBLE][age_class];
+  const auto aggregated = susceptible_compartment_ == nullptr
+                              ? 0
+                              : susceptible_compartment_->size(location, age_class);
+  const auto total = persons.size() + static_cast<std::size_t>(aggregated);
+  if (total == 0) { return nullptr; }
+
+  const auto index = Model::get_random()->random_uniform(total);
+  if (index < persons.size()) { return persons[index]; }
+  return promote_susceptible(location, susceptible_compartment_->remove_uniform(
+                                           location, age_class, Model::get_random()));
+}
+
+double Population::aggregated_biting_share(int location) const {
+  if (susceptible_compartment_ == nullptr || susceptible_compartment_->size(location) == 0) {
+    return 0.0;
+  }
+  const auto aggregated_weight = susceptible_compartment_->biting_weight(location);
+  return aggregated_weight / (aggregated_weight + sum_relative_biting_by_location_[location]);
 }
 
 void Population::introduce_initial_cases() {
@@ -433,14 +604,12 @@ void Population::introduce_initial_cases() {
 
 void Population::introduce_parasite(const int &location, Genotype* parasite_type,
                                     const int &num_of_infections) {
-  if (all_alive_persons_by_location_[location].empty()) {
+  auto persons_bitten_today = sample_persons_by_biting(location, num_of_infections);
+  if (persons_bitten_today.empty()) {
     // spdlog::debug("introduce_parasite all_alive_persons_by_location location {} is empty",
     // location);
     return;
   }
-  auto persons_bitten_today = Model::get_random()->roulette_sampling<Person>(
-      num_of_infections, individual_relative_biting_by_location_[location],
-      all_alive_persons_by_location_[location], false);
 
   for (auto* person : persons_bitten_today) { setup_initial_infection(person, parasite_type); }
 }
@@ -451,14 +620,9 @@ void Population::setup_initial_infection(Person* person, Genotype* parasite_type
 
   auto* blood_parasite = person->add_new_parasite_to_blood(parasite_type);
 
-  const auto size = Model::get_random()->random_flat(Model::get_config()
-                                                         ->get_parasite_parameters()
-                                                         .get_parasite_density_levels()
-                                                         .get_log_parasite_density_from_liver(),
-                                                     Model::get_config()
-                                                         ->get_parasite_parameters()
-                                                         .get_parasite_density_levels()
-                                                         .get_log_parasite_density_clinical());
+  const auto &constants = Model::get_config()->get_run_constants();
+  const auto size = Model::get_random()->random_flat(constants.log_parasite_density_from_liver,
+                                                     constants.log_parasite_density_clinical);
 
   blood_parasite->set_gametocyte_level(
       Model::get_config()->get_epidemiological_parameters().get_gametocyte_level_full());
@@ -495,6 +659,14 @@ void Population::perform_birth_event() {
 }
 
 void Population::give_1_birth(const int &location) {
+  if (susceptible_compartment_ != nullptr) {
+    susceptible_compartment_->add(
+        location, 0, Model::get_scheduler()->current_time(),
+        Person::draw_random_relative_biting_rate(Model::get_random(), Model::get_config()));
+    popsize_by_location_[location]++;
+    return;
+  }
+
   auto person = std::make_unique<Person>();
   person->initialize();
   person->set_age(0);
@@ -518,12 +690,9 @@ void Population::give_1_birth(const int &location) {
       Model::get_config()->get_movement_settings().get_moving_level_generator().draw_random_level(
           Model::get_random()));
 
+  // Birthdays and the switch of the immune component are handled by
+  // perform_birthday_event
   person->set_birthday(Model::get_scheduler()->current_time());
-  const auto number_of_days_to_next_birthday = Model::get_scheduler()->get_days_to_next_year();
-  person->schedule_birthday_event(number_of_days_to_next_birthday);
-
-  // schedule for switch
-  person->schedule_switch_immune_component_event(Constants::DAYS_IN_YEAR / 2);
 
   person->generate_prob_present_at_mda_by_age();
 
@@ -532,43 +701,111 @@ void Population::give_1_birth(const int &location) {
 
 void Population::perform_death_event() {
   //    std::cout << "Death Event" << std::endl;
-  // simply change state to dead and release later
+  // natural deaths are removed per cell, persons already DEAD are released at the end
   auto* pi = get_person_index<PersonIndexByLocationStateAgeClass>();
   if (pi == nullptr) return;
 
+  const auto &daily_death_probability =
+      Model::get_config()->get_run_constants().daily_death_probability_by_age_class;
+  assert(daily_death_probability.size() == Model::get_config()->number_of_age_classes());
+
   for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
     for (auto hs = 0; hs < Person::NUMBER_OF_STATE - 1; hs++) {
       if (hs == Person::DEAD) continue;
       for (auto ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
-        const int size = static_cast<int>(pi->vPerson()[loc][hs][ac].size());
+        auto &cell = pi->vPerson()[loc][hs][ac];
+        const auto size = cell.size();
         if (size == 0) continue;
-        auto poisson_means =
-            size
-            * Model::get_config()->get_population_demographic().get_death_rate_by_age_class()[ac]
-            / static_cast<double>(Constants::DAYS_IN_YEAR);
-
-        assert(
-            Model::get_config()->get_population_demographic().get_death_rate_by_age_class().size()
-            == Model::get_config()->number_of_age_classes());
-        const auto number_of_deaths = Model::get_random()->random_poisson(poisson_means);
+        const auto number_of_deaths = Model::get_random()->random_binomial(
+            daily_death_probability[ac], static_cast<unsigned int>(size));
         if (number_of_deaths == 0) continue;
 
-        //                std::cout << numberOfDeaths << std::endl;
-        for (int i = 0; i < number_of_deaths; i++) {
-          // change state to Death;
-          const int index = static_cast<int>(Model::get_random()->random_uniform(size));
-          //                    std::cout << index << "-" << pi->vPerson()[loc][hs][ac].size() <<
-          //                    std::endl;
-          auto* person = pi->vPerson()[loc][hs][ac][index];
-          person->cancel_all_events_except(nullptr);
-          person->set_host_state(Person::DEAD);
+        // Partial Fisher-Yates: move distinct persons, selected uniformly, to
+        // the end of the cell
+        for (std::size_t i = 0; i < number_of_deaths; i++) {
+          const auto last = size - 1 - i;
+          const auto index = Model::get_random()->random_uniform(static_cast<uint64_t>(last + 1));
+          pi->swap(loc, hs, ac, index, last);
         }
+
+        // The dead leave from the end of the cell, so nobody else is moved
+        remove_dead_tail(loc, hs, ac, number_of_deaths);
       }
     }
   }
+
+  if (susceptible_compartment_ != nullptr) {
+    for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
+      popsize_by_location_[loc] -= susceptible_compartment_->perform_death_event(
+          loc, daily_death_probability, Model::get_random());
+    }
+  }
   clear_all_dead_state_individual();
 }
 
+void Population::remove_dead_tail(int location, int host_state, int age_class,
+                                  std::size_t number_of_deaths) {
+  auto &index = person_indexes_.get<PersonIndexByLocationStateAgeClass>();
+  auto &cell = index.vPerson()[location][host_state][age_class];
+  // The persons are not moved to the DEAD cell, and their events go with them
+  for (auto i = cell.size() - number_of_deaths; i < cell.size(); i++) {
+    auto* person = cell[i];
+    Model::get_mdc()->record_1_death(location, person->get_birthday(),
+                                     person->get_number_of_times_bitten(), age_class,
+                                     static_cast<int>(person->get_age()));
+    person_indexes_.remove_except<PersonIndexByLocationStateAgeClass>(person);
+    all_persons_->remove(person);
+  }
+  index.remove_last(location, host_state, age_class, number_of_deaths);
+  popsize_by_location_[location] -= static_cast<int>(number_of_deaths);
+}
+
+void Population::perform_birthday_event() {
+  if (!person_indexes_initialized_) { return; }
+  auto &index = person_indexes_.get<PersonIndexByBirthday>();
+  const auto today = Model::get_scheduler()->current_time();
+  const date::sys_days calendar_today{Model::get_scheduler()->get_calendar_date()};
+  const date::year_month_day ymd{calendar_today};
+
+  const auto age_cohort = [&index](int cohort) {
+    for (auto* person : index.vPerson(cohort)) {
+      if (person->get_host_state() == Person::DEAD) { continue; }
+      // The birthday index does not track age so the cohort is not modified
+      person->increase_age_by_1_year();
+    }
+  };
+  age_cohort(PersonIndexByBirthday::cohort_of(ymd));
+  // Without a 29 February this year, those born on that day age on 1 March
+  if (ymd.month() == date::March && ymd.day() == date::day{1} && !ymd.year().is_leap()) {
+    age_cohort(PersonIndexByBirthday::cohort_of(date::year{2000} / date::February / 29));
+  }
+
+  // Persons added since yesterday are not aged on the day they were added
+  index.place_new_persons(today, calendar_today);
+
+  const auto infant_birthday = today - (Constants::DAYS_IN_YEAR / 2);
+  const date::year_month_day infant_ymd{calendar_today
+                                        - date::days{Constants::DAYS_IN_YEAR / 2}};
+  for (auto* person : index.vPerson(PersonIndexByBirthday::cohort_of(infant_ymd))) {
+    if (person->get_birthday() != infant_birthday) { continue; }
+    if (person->get_host_state() == Person::DEAD) { continue; }
+    person->catch_up();
+    person->get_immune_system()->set_immune_component(
+        std::make_unique<NonInfantImmuneComponent>());
+  }
+}
+
+void Population::perform_move_parasite_to_blood_event() {
+  // Persons are queued by Person::infected_by whether or not the indices are
+  // initialized
+  person_indexes_.get<PersonIndexByLiverStage>().take_due(Model::get_scheduler()->current_time(),
+                                                          liver_stage_due_);
+  for (auto* person : liver_stage_due_) {
+    if (person->get_host_state() == Person::DEAD) { continue; }
+    person->move_liver_parasite_to_blood();
+  }
+}
+
 void Population::clear_all_dead_state_individual() {
   // return all Death to object pool and clear vPersonIndex[l][dead][ac] for all location and ac
   auto* pi = get_person_index<PersonIndexByLocationStateAgeClass>();
@@ -604,7 +841,11 @@ void Population::perform_circulation_event() {
 
   for (int from_location = 0; from_location < Model::get_config()->number_of_locations();
        from_location++) {
-    auto poisson_means = static_cast<double>(size(from_location))
+    // Aggregated persons stay at their residence
+    const auto number_of_travellers =
+        size(from_location)
+        - (susceptible_compartment_ == nullptr ? 0 : susceptible_compartment_->size(from_location));
+    auto poisson_means = static_cast<double>(number_of_travellers)
                          * Model::get_config()
                                ->get_movement_settings()
                                .get_circulation_info()
@@ -707,12 +948,18 @@ bool Population::has_0_case() {
 void Population::update_all_individuals() {
   // update all individuals
   auto* pi = get_person_index<PersonIndexByLocationStateAgeClass>();
+  const auto birthday_cutoffs =
+      susceptible_compartment_ == nullptr ? std::vector<int>{} : ageing_birthday_cutoffs();
   for (int loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
     for (int hs = 0; hs < Person::DEAD; hs++) {
       for (int ac = 0; ac < Model::get_config()->number_of_age_classes(); ac++) {
         for (auto* person : pi->vPerson()[loc][hs][ac]) { person->update(); }
       }
     }
+    // Aggregated persons have no state to update but their age
+    if (susceptible_compartment_ != nullptr) {
+      susceptible_compartment_->perform_ageing(loc, birthday_cutoffs);
+    }
   }
   // if (all_persons_ == nullptr) {
   //   throw std::runtime_error("PersonIndexAll not found in Population::update_all_individuals");
@@ -2,18 +2,26 @@
 #define POPULATION_H
 
 #include <cstddef>
-#include <list>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "Person/Person.h"
-
-using PersonIndexPtrList = std::list<std::unique_ptr<PersonIndex>>;
+#include "SusceptibleCompartment.h"
+#include "Utils/Index/PersonIndexAll.h"
+#include "Utils/Index/PersonIndexByBirthday.h"
+#include "Utils/Index/PersonIndexByLiverStage.h"
+#include "Utils/Index/PersonIndexByLocationMovingLevel.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+#include "Utils/Index/PersonIndexRegistry.h"
+
+// Indices kept up to date with every person added, removed or changed
+using PersonIndexes =
+    PersonIndexRegistry<PersonIndexByLocationStateAgeClass, PersonIndexByLocationMovingLevel,
+                        PersonIndexByBirthday, PersonIndexByLiverStage>;
 
 class Model;
-class PersonIndexAll;
-class PersonIndexByLocationStateAgeClass;
-class PersonIndexByLocationBitingLevel;
+class MovementReporter;
 class Population {
 public:
   Population(Population &&) = delete;
@@ -85,8 +93,32 @@ public:
 
   void perform_death_event();
 
+  // Age everyone whose birthday is today and move the infants who turn six
+  // months old today to the non-infant immune component
+  void perform_birthday_event();
+
+  // Move the liver parasites of everyone whose liver stage ends today to the
+  // blood
+  void perform_move_parasite_to_blood_event();
+
   void generate_individual(int location, int age_class);
 
+  // Sample persons in proportion to their relative biting rate, among both the
+  // individuals and the aggregated susceptibles; the aggregated persons that
+  // are sampled are promoted to individuals
+  std::vector<Person*> sample_persons_by_biting(int location, int number_of_samples,
+                                                double sum_relative_biting = -1);
+
+  // Sample a susceptible of the age class uniformly, promoting it when it is
+  // aggregated. Returns nullptr when there is no susceptible.
+  Person* sample_susceptible(int location, int age_class);
+
+  // Turn a person taken out of the aggregated compartment into an individual
+  Person* promote_susceptible(int location, const SusceptibleCompartment::Member &member);
+
+  // Share of the biting weight at the location held by aggregated persons
+  [[nodiscard]] double aggregated_biting_share(int location) const;
+
   void give_1_birth(const int &location);
 
   void clear_all_dead_state_individual();
@@ -111,9 +143,21 @@ public:
   // the destination location
   void notify_movement(int source, int destination);
 
-  PersonIndexPtrList* person_index_list() { return person_index_list_.get(); }
+  // When set, every trip passed to notify_movement is also recorded by the
+  // reporter; left as nullptr when movement is not being recorded
+  [[nodiscard]] MovementReporter* get_movement_reporter() const { return movement_reporter_; }
+  void set_movement_reporter(MovementReporter* reporter) { movement_reporter_ = reporter; }
+
+  // Never-infected susceptibles kept as counts, nullptr unless enabled with
+  // aggregate_never_infected_susceptibles
+  [[nodiscard]] SusceptibleCompartment* susceptible_compartment() const {
+    return susceptible_compartment_.get();
+  }
+
+  PersonIndexes &person_indexes() { return person_indexes_; }
   PersonIndexAll* all_persons() { return all_persons_.get(); }
 
+  // Resolved at compile time, nullptr until the indices are initialized
   template <typename T>
   T* get_person_index();
 
@@ -155,9 +199,37 @@ public:
   }
 
 private:
+  // Create a never-infected susceptible individual without adding it. Persons
+  // of the initial population get a random immunity for their past exposure,
+  // the others the immunity left since their birth.
+  std::unique_ptr<Person> make_individual(int location, int age, int birthday,
+                                          bool initial_population);
+
+  // Birthday, in simulation time, of a person of the initial population
+  static int draw_birthday(int age);
+
+  // Age today of a person born on the birthday
+  static int age_of(int birthday);
+
+  // For each age class but the last, the latest birthday of the persons old
+  // enough to leave it today
+  static std::vector<int> ageing_birthday_cutoffs();
+
+  void initialize_susceptible_compartment();
+
+  // Record the death of the last number_of_deaths persons of a cell and remove
+  // them, the cell and the population size are updated once
+  void remove_dead_tail(int location, int host_state, int age_class,
+                        std::size_t number_of_deaths);
+
   std::unique_ptr<PersonIndexAll> all_persons_{nullptr};
+  std::unique_ptr<SusceptibleCompartment> susceptible_compartment_{nullptr};
 
-  std::unique_ptr<PersonIndexPtrList> person_index_list_{nullptr};
+  PersonIndexes person_indexes_;
+  // The indices are sized by initialize_person_indices(), until then persons are not indexed
+  bool person_indexes_initialized_{false};
+  // Persons whose liver stage ends today, kept to reuse the buffer
+  PersonPtrVector liver_stage_due_;
   IntVector popsize_by_location_;
 
   std::vector<std::vector<double>> individual_foi_by_location_;
@@ -170,15 +242,17 @@ private:
   std::vector<double> current_force_of_infection_by_location_;
   std::vector<std::vector<double>> force_of_infection_for_n_days_by_location_;
   std::vector<std::vector<Person*>> all_alive_persons_by_location_;
+
+  MovementReporter* movement_reporter_{nullptr};
 };
 
 template <typename T>
 T* Population::get_person_index() {
-  for (auto &person_index_ptr : *person_index_list_) {
-    T* pi = dynamic_cast<T*>(person_index_ptr.get());
-    if (pi != nullptr) { return pi; }
+  if constexpr (std::is_same_v<T, PersonIndexAll>) {
+    return all_persons_.get();
+  } else {
+    return person_indexes_initialized_ ? &person_indexes_.template get<T>() : nullptr;
   }
-  return nullptr;
 }
 #endif  // POPULATION_H
 
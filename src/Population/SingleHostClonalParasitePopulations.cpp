@@ -128,6 +128,7 @@ void SingleHostClonalParasitePopulations::clear_cured_parasites(double cured_thr
 
 void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in_blood) const {
   if (drugs_in_blood == nullptr) { throw std::invalid_argument("Drugs in blood is nullptr"); }
+  const auto &constants = Model::get_config()->get_run_constants();
   for (const auto &blood_parasite : parasites_) {
     auto* new_genotype = blood_parasite->genotype();
 
@@ -138,7 +139,7 @@ void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in
       // for a specific time
       Genotype* candidate_genotype = new_genotype->perform_mutation_by_drug(
           Model::get_config(), Model::get_random(), drug->drug_type(),
-          Model::get_config()->get_genotype_parameters().get_mutation_probability_per_locus());
+          constants.mutation_probability_per_locus);
 
       if (candidate_genotype->get_EC50_power_n(drug->drug_type())
           > new_genotype->get_EC50_power_n(drug->drug_type())) {
@@ -171,15 +172,12 @@ void SingleHostClonalParasitePopulations::update_by_drugs(DrugsInBlood* drugs_in
       }
 
       const auto p_temp =
-          drug->get_parasite_killing_rate(blood_parasite->genotype()->genotype_id());
+          drug->get_parasite_killing_rate(blood_parasite->genotype());
       percent_parasite_remove = percent_parasite_remove + p_temp - percent_parasite_remove * p_temp;
     }
     if (percent_parasite_remove > 0) {
       blood_parasite->perform_drug_action(percent_parasite_remove,
-                                          Model::get_config()
-                                              ->get_parasite_parameters()
-                                              .get_parasite_density_levels()
-                                              .get_log_parasite_density_cured());
+                                          constants.log_parasite_density_cured);
     }
   }
 }
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "Population/ClonalParasitePopulation.h"
+#include "Utils/Arena.h"
 #include "Utils/TypeDef.h"
 
 class ClonalParasitePopulation;
@@ -14,7 +15,7 @@ class DrugsInBlood;
 class ParasiteDensityUpdateFunction;
 
 class SingleHostClonalParasitePopulations {
-  // OBJECTPOOL(SingleHostClonalParasitePopulations)
+  ARENA_ALLOCATED(SingleHostClonalParasitePopulations)
 public:
   // Disallow copy
   SingleHostClonalParasitePopulations(const SingleHostClonalParasitePopulations&) = delete;
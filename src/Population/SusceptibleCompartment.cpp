@@ -0,0 +1,221 @@
+/*
+ * SusceptibleCompartment.cpp
+ *
+ * Implement the SusceptibleCompartment class.
+ */
+#include "SusceptibleCompartment.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "Utils/Random.h"
+
+SusceptibleCompartment::SusceptibleCompartment(int number_of_locations,
+                                               std::vector<int> age_structure,
+                                               int number_of_buckets, double min_biting_rate,
+                                               double max_biting_rate)
+    : number_of_locations_(number_of_locations),
+      number_of_age_classes_(static_cast<int>(age_structure.size())),
+      number_of_buckets_(number_of_buckets),
+      min_biting_rate_(min_biting_rate),
+      age_structure_(std::move(age_structure)) {
+  if (number_of_locations_ <= 0 || number_of_age_classes_ <= 0) {
+    throw std::invalid_argument("The compartment needs at least one location and age class.");
+  }
+  if (number_of_buckets_ <= 0) {
+    throw std::invalid_argument("The number of biting rate buckets must be greater than 0.");
+  }
+  bucket_width_ = std::max(max_biting_rate - min_biting_rate, 0.0) / number_of_buckets_;
+
+  cells_.resize(static_cast<std::size_t>(number_of_locations_) * number_of_age_classes_
+                * number_of_buckets_);
+  size_by_location_age_class_.assign(
+      static_cast<std::size_t>(number_of_locations_) * number_of_age_classes_, 0);
+  size_by_location_.assign(number_of_locations_, 0);
+}
+
+int SusceptibleCompartment::bucket_of(double relative_biting_rate) const {
+  if (bucket_width_ <= 0) { return 0; }
+  const auto bucket = static_cast<int>((relative_biting_rate - min_biting_rate_) / bucket_width_);
+  return std::clamp(bucket, 0, number_of_buckets_ - 1);
+}
+
+int SusceptibleCompartment::age_class_of(int age) const {
+  auto ac = 0;
+  while (ac < number_of_age_classes_ - 1 && age >= age_structure_[ac]) { ac++; }
+  return ac;
+}
+
+void SusceptibleCompartment::insert_cohort(Cell &cell, const Cohort &cohort) {
+  // Births and ageing bring the youngest persons of the cell
+  if (cell.cohorts.empty() || cell.cohorts.back().birthday < cohort.birthday) {
+    cell.cohorts.push_back(cohort);
+    return;
+  }
+  auto it = std::lower_bound(
+      cell.cohorts.begin() + static_cast<std::ptrdiff_t>(cell.first), cell.cohorts.end(),
+      cohort.birthday, [](const Cohort &c, int birthday) { return c.birthday < birthday; });
+  for (auto same = it; same != cell.cohorts.end() && same->birthday == cohort.birthday; ++same) {
+    if (same->initial_population == cohort.initial_population) {
+      same->count += cohort.count;
+      return;
+    }
+  }
+  cell.cohorts.insert(it, cohort);
+}
+
+void SusceptibleCompartment::drop_left_cohorts(Cell &cell) {
+  // Erase in a batch once the cohorts that left are half of the storage
+  if (cell.first * 2 < cell.cohorts.size()) { return; }
+  cell.cohorts.erase(cell.cohorts.begin(),
+                     cell.cohorts.begin() + static_cast<std::ptrdiff_t>(cell.first));
+  cell.first = 0;
+}
+
+void SusceptibleCompartment::add(int location, int age_class, int birthday,
+                                 double relative_biting_rate, bool initial_population) {
+  auto &cell = cells_[index(location, age_class, bucket_of(relative_biting_rate))];
+  insert_cohort(cell, Cohort{birthday, initial_population, 1});
+  cell.count++;
+  cell.biting_sum += relative_biting_rate;
+  size_by_location_age_class_[(location * number_of_age_classes_) + age_class]++;
+  size_by_location_[location]++;
+  total_++;
+}
+
+SusceptibleCompartment::Member SusceptibleCompartment::remove_from_cell(int location,
+                                                                        int age_class,
+                                                                        int bucket,
+                                                                        int64_t position) {
+  auto &cell = cells_[index(location, age_class, bucket)];
+  auto cohort = cell.first;
+  while (position >= cell.cohorts[cohort].count) {
+    position -= cell.cohorts[cohort].count;
+    cohort++;
+  }
+  const auto birthday = cell.cohorts[cohort].birthday;
+  const auto initial_population = cell.cohorts[cohort].initial_population;
+  if (--cell.cohorts[cohort].count == 0) {
+    if (cohort == cell.first) {
+      cell.first++;
+      drop_left_cohorts(cell);
+    } else {
+      cell.cohorts.erase(cell.cohorts.begin() + static_cast<std::ptrdiff_t>(cohort));
+    }
+  }
+
+  // Persons in a cell are interchangeable, each takes the mean rate with it
+  const auto rate = cell.biting_sum / static_cast<double>(cell.count);
+  cell.count--;
+  cell.biting_sum = cell.count == 0 ? 0.0 : cell.biting_sum - rate;
+  size_by_location_age_class_[(location * number_of_age_classes_) + age_class]--;
+  size_by_location_[location]--;
+  total_--;
+  return Member{age_class, rate, birthday, initial_population};
+}
+
+double SusceptibleCompartment::biting_weight(int location) const {
+  const auto first = index(location, 0, 0);
+  const auto last = first + (static_cast<std::size_t>(number_of_age_classes_) * number_of_buckets_);
+  auto sum = 0.0;
+  for (auto i = first; i < last; i++) { sum += cells_[i].biting_sum; }
+  return sum;
+}
+
+SusceptibleCompartment::Member SusceptibleCompartment::remove_by_biting(int location,
+                                                                        utils::Random* random) {
+  if (size_by_location_[location] == 0) {
+    throw std::logic_error("No aggregated susceptible left at the location.");
+  }
+  auto target = random->random_flat(0.0, biting_weight(location));
+  auto last_non_empty = std::pair<int, int>{-1, -1};
+  for (auto ac = 0; ac < number_of_age_classes_; ac++) {
+    for (auto bucket = 0; bucket < number_of_buckets_; bucket++) {
+      const auto &cell = cells_[index(location, ac, bucket)];
+      if (cell.count == 0) { continue; }
+      if (target < cell.biting_sum) {
+        // Every person of the cell has the same weight, what is left of the
+        // target picks one of them
+        const auto position = static_cast<int64_t>(target / cell.biting_sum
+                                                   * static_cast<double>(cell.count));
+        return remove_from_cell(location, ac, bucket, std::min(position, cell.count - 1));
+      }
+      target -= cell.biting_sum;
+      last_non_empty = {ac, bucket};
+    }
+  }
+  // Rounding left the target past the last cell
+  const auto &last = cells_[index(location, last_non_empty.first, last_non_empty.second)];
+  return remove_from_cell(location, last_non_empty.first, last_non_empty.second, last.count - 1);
+}
+
+SusceptibleCompartment::Member SusceptibleCompartment::remove_uniform(int location,
+                                                                      int age_class,
+                                                                      utils::Random* random) {
+  const auto available = age_class == -1 ? size(location) : size(location, age_class);
+  if (available == 0) {
+    throw std::logic_error("No aggregated susceptible left in the age class.");
+  }
+  auto target = static_cast<int64_t>(random->random_uniform(static_cast<uint64_t>(available)));
+  const auto from = age_class == -1 ? 0 : age_class;
+  const auto to = age_class == -1 ? number_of_age_classes_ : age_class + 1;
+  for (auto ac = from; ac < to; ac++) {
+    for (auto bucket = 0; bucket < number_of_buckets_; bucket++) {
+      const auto count = cells_[index(location, ac, bucket)].count;
+      if (target < count) { return remove_from_cell(location, ac, bucket, target); }
+      target -= count;
+    }
+  }
+  throw std::logic_error("Aggregated susceptible counts are inconsistent.");
+}
+
+int SusceptibleCompartment::perform_death_event(
+    int location, const std::vector<double> &daily_death_probability_by_age_class,
+    utils::Random* random) {
+  auto deaths = 0;
+  for (auto ac = 0; ac < number_of_age_classes_; ac++) {
+    const auto count = size(location, ac);
+    if (count == 0) { continue; }
+    const auto number_of_deaths = random->random_binomial(
+        daily_death_probability_by_age_class[ac], static_cast<unsigned int>(count));
+    for (auto i = 0U; i < number_of_deaths; i++) { remove_uniform(location, ac, random); }
+    deaths += static_cast<int>(number_of_deaths);
+  }
+  return deaths;
+}
+
+void SusceptibleCompartment::perform_ageing(int location,
+                                            const std::vector<int> &birthday_cutoffs) {
+  // Youngest first so a cohort can cross several age classes of no width
+  for (auto ac = 0; ac < number_of_age_classes_ - 1; ac++) {
+    for (auto bucket = 0; bucket < number_of_buckets_; bucket++) {
+      auto &cell = cells_[index(location, ac, bucket)];
+      auto &next = cells_[index(location, ac + 1, bucket)];
+      int64_t movers = 0;
+      auto moved_biting = 0.0;
+      while (cell.first < cell.cohorts.size()
+             && cell.cohorts[cell.first].birthday <= birthday_cutoffs[ac]) {
+        const auto &cohort = cell.cohorts[cell.first];
+        const auto biting = cohort.count == cell.count - movers
+                                ? cell.biting_sum - moved_biting
+                                : cell.biting_sum * static_cast<double>(cohort.count)
+                                      / static_cast<double>(cell.count);
+        insert_cohort(next, cohort);
+        movers += cohort.count;
+        moved_biting += biting;
+        cell.first++;
+      }
+      if (movers == 0) { continue; }
+
+      cell.count -= movers;
+      cell.biting_sum = cell.count == 0 ? 0.0 : cell.biting_sum - moved_biting;
+      next.count += movers;
+      next.biting_sum += moved_biting;
+      size_by_location_age_class_[(location * number_of_age_classes_) + ac] -= movers;
+      size_by_location_age_class_[(location * number_of_age_classes_) + ac + 1] += movers;
+
+      drop_left_cohorts(cell);
+    }
+  }
+}
@@ -0,0 +1,131 @@
+/*
+ * SusceptibleCompartment.h
+ *
+ * Aggregated representation of the fully susceptible, never-infected persons
+ * of the population. Instead of a Person object, each such person is a count
+ * in a (location, age class, biting-rate bucket) cell, together with the sum
+ * of the innate relative biting rates of the persons in the cell so the
+ * biting weight of the compartment stays exact.
+ *
+ * Within a cell, persons born on the same day form a cohort, so a promoted
+ * person gets back its exact age and the immunity that goes with it, and a
+ * cohort moves to the next age class on the day it reaches the bound of its
+ * age class.
+ *
+ * Persons leave the compartment only by being promoted to a Person (when an
+ * infection, importation or MDA touches them) or by dying.
+ */
+#ifndef SUSCEPTIBLECOMPARTMENT_H
+#define SUSCEPTIBLECOMPARTMENT_H
+
+#include <cstdint>
+#include <vector>
+
+namespace utils {
+class Random;
+}
+
+class SusceptibleCompartment {
+public:
+  // Disallow copy
+  SusceptibleCompartment(const SusceptibleCompartment &) = delete;
+  SusceptibleCompartment &operator=(const SusceptibleCompartment &) = delete;
+
+  // Disallow move
+  SusceptibleCompartment(SusceptibleCompartment &&) = delete;
+  SusceptibleCompartment &operator=(SusceptibleCompartment &&) = delete;
+
+  // Biting rates in [min_biting_rate, max_biting_rate] are split into
+  // number_of_buckets buckets of equal width
+  SusceptibleCompartment(int number_of_locations, std::vector<int> age_structure,
+                         int number_of_buckets, double min_biting_rate, double max_biting_rate);
+  ~SusceptibleCompartment() = default;
+
+  // A person selected out of the compartment
+  struct Member {
+    int age_class{-1};
+    double relative_biting_rate{0.0};
+    // Day of birth, in simulation time
+    int birthday{0};
+    // Part of the initial population rather than born during the simulation
+    bool initial_population{false};
+  };
+
+  void add(int location, int age_class, int birthday, double relative_biting_rate,
+           bool initial_population = false);
+
+  // Remove one person selected in proportion to the relative biting rate
+  Member remove_by_biting(int location, utils::Random* random);
+
+  // Remove one person of the age class selected uniformly, the age class is
+  // ignored when it is -1
+  Member remove_uniform(int location, int age_class, utils::Random* random);
+
+  // Kill each person with the daily death probability of its age class,
+  // returns the number of deaths
+  int perform_death_event(int location,
+                          const std::vector<double> &daily_death_probability_by_age_class,
+                          utils::Random* random);
+
+  // Move the persons born on or before birthday_cutoffs[ac] from age class ac
+  // to the next one, there is one cutoff per age class but the last
+  void perform_ageing(int location, const std::vector<int> &birthday_cutoffs);
+
+  // Age class of a person of the given age, following Person::set_age
+  [[nodiscard]] int age_class_of(int age) const;
+
+  [[nodiscard]] int64_t size() const { return total_; }
+  [[nodiscard]] int64_t size(int location) const { return size_by_location_[location]; }
+  [[nodiscard]] int64_t size(int location, int age_class) const {
+    return size_by_location_age_class_[(location * number_of_age_classes_) + age_class];
+  }
+
+  // Sum of the relative biting rates of the persons at the location
+  [[nodiscard]] double biting_weight(int location) const;
+
+  [[nodiscard]] int get_number_of_buckets() const { return number_of_buckets_; }
+  [[nodiscard]] int bucket_of(double relative_biting_rate) const;
+
+private:
+  // Persons of a cell born on the same day
+  struct Cohort {
+    int birthday{0};
+    bool initial_population{false};
+    int64_t count{0};
+  };
+
+  struct Cell {
+    int64_t count{0};
+    double biting_sum{0.0};
+    // Ordered by birthday, the oldest first; the cohorts before first have
+    // already left the cell and are dropped in batches
+    std::vector<Cohort> cohorts;
+    std::size_t first{0};
+  };
+
+  [[nodiscard]] std::size_t index(int location, int age_class, int bucket) const {
+    return ((static_cast<std::size_t>(location) * number_of_age_classes_ + age_class)
+            * number_of_buckets_)
+           + bucket;
+  }
+
+  static void insert_cohort(Cell &cell, const Cohort &cohort);
+  static void drop_left_cohorts(Cell &cell);
+
+  // Remove the person at position within the cell, counted from the oldest
+  Member remove_from_cell(int location, int age_class, int bucket, int64_t position);
+
+  int number_of_locations_;
+  int number_of_age_classes_;
+  int number_of_buckets_;
+  double min_biting_rate_;
+  double bucket_width_;
+  std::vector<int> age_structure_;
+
+  std::vector<Cell> cells_;
+  std::vector<int64_t> size_by_location_age_class_;
+  std::vector<int64_t> size_by_location_;
+  int64_t total_{0};
+};
+
+#endif  // SUSCEPTIBLECOMPARTMENT_H
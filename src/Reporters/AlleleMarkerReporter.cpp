@@ -0,0 +1,144 @@
+/*
+ * AlleleMarkerReporter.cpp
+ *
+ * Implement the AlleleMarkerReporter class.
+ */
+#include "AlleleMarkerReporter.h"
+
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <bit>
+#include <cstdint>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Parasites/Genotype.h"
+#include "Population/ClonalParasitePopulation.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Spatial/GIS/AdminLevelManager.h"
+#include "Spatial/GIS/SpatialData.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+
+namespace {
+const std::string LOGGER_NAME = "allele_marker_reporter";
+}  // namespace
+
+void AlleleMarkerReporter::MarkerCounts::resize(std::size_t units, std::size_t markers) {
+  infected.assign(units, 0.0);
+  clones.assign(units, 0.0);
+  weighted.assign(units * markers, 0.0);
+  unweighted.assign(units * markers, 0.0);
+}
+
+void AlleleMarkerReporter::MarkerCounts::add(std::size_t unit, const MarkerCounts &other,
+                                             std::size_t other_unit, std::size_t markers) {
+  infected[unit] += other.infected[other_unit];
+  clones[unit] += other.clones[other_unit];
+  for (std::size_t marker = 0; marker < markers; marker++) {
+    weighted[(unit * markers) + marker] += other.weighted[(other_unit * markers) + marker];
+    unweighted[(unit * markers) + marker] += other.unweighted[(other_unit * markers) + marker];
+  }
+}
+
+void AlleleMarkerReporter::count_by_location(MarkerCounts &counts, std::size_t markers) {
+  const auto locations = static_cast<std::size_t>(Model::get_config()->number_of_locations());
+  counts.resize(locations, markers);
+
+  auto* index = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
+  for (std::size_t loc = 0; loc < locations; loc++) {
+    auto* weighted = &counts.weighted[loc * markers];
+    auto* unweighted = &counts.unweighted[loc * markers];
+    // Susceptible and dead individuals carry no parasites
+    for (auto hs = static_cast<int>(Person::EXPOSED); hs < Person::DEAD; hs++) {
+      for (const auto &age_class : index->vPerson()[loc][hs]) {
+        for (auto* person : age_class) {
+          const auto* parasites = person->get_all_clonal_parasite_populations();
+          if (parasites->empty()) { continue; }
+          const auto weight = 1.0 / static_cast<double>(parasites->size());
+          counts.infected[loc] += 1;
+          counts.clones[loc] += static_cast<double>(parasites->size());
+          for (const auto &parasite : *parasites) {
+            for (auto mask = parasite->genotype()->allele_marker_mask; mask != 0;
+                 mask &= mask - 1) {
+              const auto marker = std::countr_zero(mask);
+              weighted[marker] += weight;
+              unweighted[marker] += 1;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void AlleleMarkerReporter::initialize(int job_number, const std::string &path) {
+  const auto &markers = Model::get_config()->get_genotype_parameters().get_allele_markers();
+  if (markers.empty()) {
+    spdlog::warn("AlleleMarkerReporter: no allele_markers in genotype_parameters, nothing to report");
+  }
+  for (const auto &marker : markers) { labels_.push_back(marker.get_label()); }
+
+  auto filename =
+      fmt::format("{}allele_marker_frequency_{}.{}", path, job_number, Tsv::extension);
+  auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(filename, true);
+  auto logger = std::make_shared<spdlog::logger>(LOGGER_NAME, sink);
+  sink->set_pattern("%v");
+  logger->set_level(spdlog::level::info);
+  spdlog::register_logger(logger);
+
+  ss << "dayselapsed" << Tsv::sep << "level" << Tsv::sep << "unit" << Tsv::sep << "marker"
+     << Tsv::sep << "infected" << Tsv::sep << "clones" << Tsv::sep << "weighted" << Tsv::sep
+     << "unweighted";
+  logger->info(ss.str());
+  ss.str("");
+}
+
+void AlleleMarkerReporter::monthly_report() {
+  const auto markers = labels_.size();
+  if (markers == 0) { return; }
+
+  count_by_location(by_location_, markers);
+  write_level("cell", by_location_);
+
+  // Admin units are sums of their locations, no further pass over the population
+  auto* admin_manager = Model::get_spatial_data()->get_admin_level_manager();
+  if (admin_manager == nullptr) { return; }
+  const auto &level_names = admin_manager->get_level_names();
+  by_admin_level_.resize(level_names.size());
+  for (std::size_t level_id = 0; level_id < level_names.size(); level_id++) {
+    const auto* boundary = admin_manager->get_boundary(level_names[level_id]);
+    auto &counts = by_admin_level_[level_id];
+    counts.resize(boundary->max_unit_id + 1, markers);
+    for (std::size_t loc = 0; loc < boundary->location_to_unit.size(); loc++) {
+      const auto unit = boundary->location_to_unit[loc];
+      if (unit < 0) { continue; }
+      counts.add(unit, by_location_, loc, markers);
+    }
+    write_level(level_names[level_id], counts);
+  }
+}
+
+void AlleleMarkerReporter::write_level(const std::string &level, const MarkerCounts &counts) {
+  const auto markers = labels_.size();
+  const auto day = Model::get_scheduler()->current_time();
+  for (std::size_t unit = 0; unit < counts.infected.size(); unit++) {
+    if (counts.infected[unit] == 0) { continue; }
+    for (std::size_t marker = 0; marker < markers; marker++) {
+      ss << day << Tsv::sep << level << Tsv::sep << unit << Tsv::sep << labels_[marker] << Tsv::sep
+         << counts.infected[unit] << Tsv::sep << counts.clones[unit] << Tsv::sep
+         << counts.weighted[(unit * markers) + marker] / counts.infected[unit] << Tsv::sep
+         << counts.unweighted[(unit * markers) + marker] / counts.clones[unit] << Tsv::end_line;
+    }
+  }
+  if (ss.tellp() > 0) {
+    // The logger adds the final line break
+    auto rows = ss.str();
+    rows.pop_back();
+    spdlog::get(LOGGER_NAME)->info(rows);
+  }
+  ss.str("");
+}
@@ -0,0 +1,62 @@
+/*
+ * AlleleMarkerReporter.h
+ *
+ * Report the frequency of the allele markers listed under
+ * genotype_parameters.allele_markers for each location (cell) and each unit
+ * of every administrative level. Every genotype carries a bitmask of its
+ * markers, computed once when the genotype is created, so a report is a
+ * single pass over the population using only bit operations.
+ *
+ * Two frequencies are reported for each marker:
+ * - weighted: mean over infected individuals of the fraction of their clones
+ *   that carry the marker
+ * - unweighted: fraction of all clones that carry the marker
+ */
+#ifndef ALLELEMARKERREPORTER_H
+#define ALLELEMARKERREPORTER_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Reporters/Reporter.h"
+
+class AlleleMarkerReporter : public Reporter {
+public:
+  AlleleMarkerReporter() = default;
+  ~AlleleMarkerReporter() override = default;
+
+  // Basic declarations
+  void before_run() override {}
+  void after_run() override {}
+  void begin_time_step() override {}
+
+  // Overrides
+  void initialize(int job_number, const std::string &path) override;
+  void monthly_report() override;
+
+  // Per unit tallies, the marker values are indexed [unit * number of markers + marker]
+  struct MarkerCounts {
+    std::vector<double> infected;
+    std::vector<double> clones;
+    std::vector<double> weighted;
+    std::vector<double> unweighted;
+
+    void resize(std::size_t units, std::size_t markers);
+    void add(std::size_t unit, const MarkerCounts &other, std::size_t other_unit,
+             std::size_t markers);
+  };
+
+  // Count the markers of every individual by location
+  static void count_by_location(MarkerCounts &counts, std::size_t markers);
+
+private:
+  void write_level(const std::string &level, const MarkerCounts &counts);
+
+  std::vector<std::string> labels_;
+  MarkerCounts by_location_;
+  std::vector<MarkerCounts> by_admin_level_;
+  std::stringstream ss;
+};
+
+#endif  // ALLELEMARKERREPORTER_H
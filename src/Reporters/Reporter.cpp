@@ -1,4 +1,5 @@
 #include "Reporter.h"
+#include "AlleleMarkerReporter.h"
 // #include "ConsoleReporter.h"
 #include "ConsoleReporter.h"
 #include "MMCReporter.h"
@@ -12,6 +13,7 @@
 #include "Configuration/Config.h"
 #include "Specialist/AgeBandReporter.h"
 #include "Specialist/CellularReporter.h"
+#include "Specialist/MovementReporter.h"
 #include "Specialist/PopulationReporter.h"
 #include "Specialist/SeasonalImmunity.h"
 
@@ -22,10 +24,12 @@ std::map<std::string, Reporter::ReportType> Reporter::ReportTypeMap{
     {"TACT",            TACT_REPORTER},
     {"NovelDrug",       NOVEL_DRUG_REPOTER},
     {"ValidationReporter",       VALIDATION_REPORTER},
+    {"AlleleMarkerReporter", ALLELE_MARKER_REPORTER},
     {"PopulationReporter", POPULATION_REPORTER},
     {"CellularReporter", CELLULAR_REPORTER},
     {"SeasonalImmunity", SEASONAL_IMMUNITY},
     {"AgeBand", AGE_BAND_REPORTER},
+    {"MovementReporter", MOVEMENT_REPORTER},
     {"SQLiteMonthlyReporter", SQLITE_MONTHLY_REPORTER},
     {"SQLiteValidationReporter", SQLITE_VALIDATION_REPORTER},
 #ifdef ENABLE_TRAVEL_TACKING
@@ -52,6 +56,10 @@ std::unique_ptr<Reporter> Reporter::MakeReport(ReportType report_type) {
     return std::make_unique<NovelDrugReporter>();
   case VALIDATION_REPORTER:
     return std::make_unique<ValidationReporter>();
+  case ALLELE_MARKER_REPORTER:
+    return std::make_unique<AlleleMarkerReporter>();
+  case MOVEMENT_REPORTER:
+    return std::make_unique<MovementReporter>();
   case POPULATION_REPORTER:
     return std::make_unique<PopulationReporter>();
   case CELLULAR_REPORTER:
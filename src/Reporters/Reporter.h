@@ -46,6 +46,7 @@ public:
     TACT_REPORTER,
     NOVEL_DRUG_REPOTER,
     VALIDATION_REPORTER,
+    ALLELE_MARKER_REPORTER,
 
     // Specialist reporters for specific experiments
     MOVEMENT_REPORTER,
@@ -0,0 +1,177 @@
+/*
+ * MovementReporter.cpp
+ *
+ * Implement the MovementReporter class.
+ */
+#include "MovementReporter.h"
+
+#include <sqlite3.h>
+
+#include <filesystem>
+#include <map>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Population/Population.h"
+#include "Simulation/Model.h"
+#include "Spatial/GIS/SpatialData.h"
+#include "Utils/Cli.h"
+#include "Utils/Helpers/SQLiteDatabase.h"
+
+MovementReporter::~MovementReporter() {
+  if (Model::get_population() != nullptr
+      && Model::get_population()->get_movement_reporter() == this) {
+    Model::get_population()->set_movement_reporter(nullptr);
+  }
+  sqlite3_finalize(insert_od_stmt_);
+  sqlite3_finalize(insert_trip_stmt_);
+}
+
+void MovementReporter::initialize(int job_number, const std::string &path) {
+  if (utils::Cli::get_instance().get_record_individual_movement()) {
+    level_ = Level::INDIVIDUAL;
+  } else if (utils::Cli::get_instance().get_record_district_movement()) {
+    level_ = Level::DISTRICT;
+  } else {
+    level_ = Level::CELL;
+  }
+
+  // Build the district lookup once so the flush does not go through the
+  // admin level manager for every origin-destination pair
+  if (Model::get_spatial_data()->has_admin_level("district")) {
+    const auto number_of_locations = static_cast<int>(Model::get_config()->number_of_locations());
+    district_lookup_.reserve(number_of_locations);
+    for (auto loc = 0; loc < number_of_locations; loc++) {
+      district_lookup_.push_back(Model::get_spatial_data()->get_admin_unit("district", loc));
+    }
+  } else if (level_ == Level::DISTRICT) {
+    spdlog::warn("No district raster loaded, movement will be recorded at the cell level.");
+    level_ = Level::CELL;
+  }
+
+  auto db_path = fmt::format("{}movement_{}.db", path, job_number);
+  if (std::filesystem::exists(db_path) && std::remove(db_path.c_str()) != 0) {
+    spdlog::error("Error deleting old movement database file {}.", db_path);
+  }
+  db_ = std::make_unique<SQLiteDatabase>(db_path);
+
+  const std::string create_od_table = R""""(
+    CREATE TABLE IF NOT EXISTS movement (
+        days_elapsed INTEGER NOT NULL,
+        source INTEGER NOT NULL,
+        destination INTEGER NOT NULL,
+        count INTEGER NOT NULL,
+        PRIMARY KEY (days_elapsed, source, destination)
+    ) WITHOUT ROWID;
+  )"""";
+
+  const std::string create_trip_table = R""""(
+    CREATE TABLE IF NOT EXISTS trip (
+        days_elapsed INTEGER NOT NULL,
+        source INTEGER NOT NULL,
+        destination INTEGER NOT NULL
+    );
+  )"""";
+
+  const std::string create_info_table = R""""(
+    CREATE TABLE IF NOT EXISTS movement_info (
+        level TEXT NOT NULL
+    );
+  )"""";
+
+  db_->execute(create_od_table);
+  db_->execute(create_trip_table);
+  db_->execute(create_info_table);
+
+  const char* level_names[] = {"cell", "district", "individual"};
+  db_->execute(fmt::format("INSERT INTO movement_info (level) VALUES ('{}');",
+                           level_names[static_cast<int>(level_)]));
+
+  insert_od_stmt_ = db_->prepare(
+      "INSERT INTO movement (days_elapsed, source, destination, count) VALUES (?, ?, ?, ?);");
+  insert_trip_stmt_ =
+      db_->prepare("INSERT INTO trip (days_elapsed, source, destination) VALUES (?, ?, ?);");
+
+  // Hook into the population, from here on every trip is recorded
+  Model::get_population()->set_movement_reporter(this);
+
+  spdlog::info("MovementReporter initialized, recording {} movement to {}",
+               level_names[static_cast<int>(level_)], db_path);
+}
+
+void MovementReporter::record_movement(int source, int destination) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (level_ == Level::INDIVIDUAL) {
+    trips_.push_back({Model::get_scheduler()->current_time(), source, destination});
+    return;
+  }
+  od_counts_[make_key(source, destination)]++;
+}
+
+void MovementReporter::monthly_report() { flush(); }
+
+void MovementReporter::after_run() { flush(); }
+
+void MovementReporter::flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (od_counts_.empty() && trips_.empty()) { return; }
+
+  const auto days_elapsed = Model::get_scheduler()->current_time();
+
+  TransactionGuard tx(db_.get());
+  switch (level_) {
+    case Level::CELL:
+      write_cells(days_elapsed);
+      break;
+    case Level::DISTRICT:
+      write_districts(days_elapsed);
+      break;
+    case Level::INDIVIDUAL:
+      write_individual_trips();
+      break;
+  }
+  tx.commit();
+
+  // clear() keeps the buckets so the next month does not rehash
+  od_counts_.clear();
+  trips_.clear();
+}
+
+void MovementReporter::write_cells(int days_elapsed) {
+  for (const auto &[key, count] : od_counts_) {
+    sqlite3_bind_int(insert_od_stmt_, 1, days_elapsed);
+    sqlite3_bind_int(insert_od_stmt_, 2, source_of(key));
+    sqlite3_bind_int(insert_od_stmt_, 3, destination_of(key));
+    sqlite3_bind_int64(insert_od_stmt_, 4, count);
+    sqlite3_step(insert_od_stmt_);
+    sqlite3_reset(insert_od_stmt_);
+  }
+}
+
+void MovementReporter::write_districts(int days_elapsed) {
+  // Collapse the cell matrix onto the districts, ordered for stable output
+  std::map<uint64_t, uint64_t> district_counts;
+  for (const auto &[key, count] : od_counts_) {
+    district_counts[make_key(district_lookup_[source_of(key)],
+                             district_lookup_[destination_of(key)])] += count;
+  }
+
+  for (const auto &[key, count] : district_counts) {
+    sqlite3_bind_int(insert_od_stmt_, 1, days_elapsed);
+    sqlite3_bind_int(insert_od_stmt_, 2, source_of(key));
+    sqlite3_bind_int(insert_od_stmt_, 3, destination_of(key));
+    sqlite3_bind_int64(insert_od_stmt_, 4, static_cast<sqlite3_int64>(count));
+    sqlite3_step(insert_od_stmt_);
+    sqlite3_reset(insert_od_stmt_);
+  }
+}
+
+void MovementReporter::write_individual_trips() {
+  for (const auto &trip : trips_) {
+    sqlite3_bind_int(insert_trip_stmt_, 1, trip.day);
+    sqlite3_bind_int(insert_trip_stmt_, 2, trip.source);
+    sqlite3_bind_int(insert_trip_stmt_, 3, trip.destination);
+    sqlite3_step(insert_trip_stmt_);
+    sqlite3_reset(insert_trip_stmt_);
+  }
+}
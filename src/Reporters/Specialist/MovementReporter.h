@@ -0,0 +1,95 @@
+/*
+ * MovementReporter.h
+ *
+ * Define the MovementReporter class which records the trips taken by the
+ * population as sparse origin-destination matrices. Trips are accumulated in
+ * memory as they happen (see Population::notify_movement) and flushed to an
+ * SQLite database once a month.
+ *
+ * The level of detail is selected on the command line:
+ *   --mc  cell-to-cell counts
+ *   --md  district-to-district counts
+ *   --im  every individual trip with the day it took place
+ */
+#ifndef MOVEMENTREPORTER_H
+#define MOVEMENTREPORTER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Reporters/Reporter.h"
+
+class SQLiteDatabase;
+struct sqlite3_stmt;
+
+class MovementReporter : public Reporter {
+public:
+  // Disallow copy
+  MovementReporter(const MovementReporter &) = delete;
+  MovementReporter &operator=(const MovementReporter &) = delete;
+
+  // Disallow move
+  MovementReporter(MovementReporter &&) = delete;
+  MovementReporter &operator=(MovementReporter &&) = delete;
+
+  enum class Level : uint8_t { CELL = 0, DISTRICT, INDIVIDUAL };
+
+  MovementReporter() = default;
+  ~MovementReporter() override;
+
+  void initialize(int job_number, const std::string &path) override;
+  void before_run() override {}
+  void after_run() override;
+  void begin_time_step() override {}
+  void monthly_report() override;
+
+  // Record a single trip from source to destination, safe to call from
+  // multiple threads
+  void record_movement(int source, int destination);
+
+  [[nodiscard]] Level get_level() const { return level_; }
+  void set_level(Level level) { level_ = level; }
+
+  // Origin-destination counts accumulated since the last flush, keyed by
+  // make_key(source, destination)
+  [[nodiscard]] const std::unordered_map<uint64_t, uint32_t> &get_od_counts() const {
+    return od_counts_;
+  }
+
+  static uint64_t make_key(int source, int destination) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(source)) << 32)
+           | static_cast<uint32_t>(destination);
+  }
+  static int source_of(uint64_t key) { return static_cast<int>(key >> 32); }
+  static int destination_of(uint64_t key) { return static_cast<int>(key & 0xFFFFFFFFULL); }
+
+private:
+  struct Trip {
+    int day;
+    int source;
+    int destination;
+  };
+
+  void flush();
+  void write_cells(int days_elapsed);
+  void write_districts(int days_elapsed);
+  void write_individual_trips();
+
+  Level level_{Level::CELL};
+
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, uint32_t> od_counts_;
+  std::vector<Trip> trips_;
+
+  // Mapping of the locations to their districts, empty if no district raster
+  std::vector<int> district_lookup_;
+
+  std::unique_ptr<SQLiteDatabase> db_;
+  sqlite3_stmt* insert_od_stmt_{nullptr};
+  sqlite3_stmt* insert_trip_stmt_{nullptr};
+};
+
+#endif
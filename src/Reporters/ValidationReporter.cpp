@@ -45,6 +45,17 @@ void ValidationReporter::initialize(int job_number, const std::string &path) {
     fs::remove(monthly_mutation_path);
     fs::remove(mosquito_res_count_path);
   }
+  const auto record_event_samples =
+      Model::get_config()->get_mosquito_parameters().get_record_recombination_events()
+      && Model::get_config()->get_model_settings().get_event_sample_capacity() > 0;
+  if (record_event_samples) {
+    monthly_mutation_sample_path =
+        fmt::format("{}/validation_monthly_mutation_sample_{}.txt", path, job_number);
+    mosquito_res_sample_path =
+        fmt::format("{}/validation_mosquito_res_sample_{}.txt", path, job_number);
+    fs::remove(monthly_mutation_sample_path);
+    fs::remove(mosquito_res_sample_path);
+  }
 
   // Create separate loggers for each report type
   monthly_data_logger = spdlog::basic_logger_mt("validation_monthly_data", monthly_data_path);
@@ -58,6 +69,12 @@ void ValidationReporter::initialize(int job_number, const std::string &path) {
     mosquito_res_count_logger =
         spdlog::basic_logger_mt("validation_mosquito_res_count", mosquito_res_count_path);
   }
+  if (record_event_samples) {
+    monthly_mutation_sample_logger = spdlog::basic_logger_mt("validation_monthly_mutation_sample",
+                                                             monthly_mutation_sample_path);
+    mosquito_res_sample_logger =
+        spdlog::basic_logger_mt("validation_mosquito_res_sample", mosquito_res_sample_path);
+  }
 
   // Set log pattern to only include the raw message (removes timestamps and log levels)
   monthly_data_logger->set_pattern("%v");
@@ -68,6 +85,10 @@ void ValidationReporter::initialize(int job_number, const std::string &path) {
     monthly_mutation_logger->set_pattern("%v");
     mosquito_res_count_logger->set_pattern("%v");
   }
+  if (record_event_samples) {
+    monthly_mutation_sample_logger->set_pattern("%v");
+    mosquito_res_sample_logger->set_pattern("%v");
+  }
 
   // Set up a default console logger
   auto console_logger = spdlog::stdout_color_mt("console");
@@ -83,6 +104,10 @@ void ValidationReporter::initialize(int job_number, const std::string &path) {
     monthly_mutation_logger->flush_on(spdlog::level::info);
     mosquito_res_count_logger->flush_on(spdlog::level::info);
   }
+  if (record_event_samples) {
+    monthly_mutation_sample_logger->flush_on(spdlog::level::info);
+    mosquito_res_sample_logger->flush_on(spdlog::level::info);
+  }
 }
 
 void ValidationReporter::before_run() {}
@@ -344,44 +369,48 @@ void ValidationReporter::monthly_report() {
 
   ss.str("");
 
+  // The trackers hold the events of this month, the MDC clears them after the reports
   if (Model::get_config()->get_mosquito_parameters().get_record_recombination_events()){
-    int sum = 0;
-    for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
-      sum += static_cast<int>(Model::get_mdc()->mutation_tracker[loc].size());
-      for (auto &yearly_data : Model::get_mdc()->mutation_tracker[loc]) {
-        ss << std::get<0>(yearly_data) << sep;
-        ss << std::get<1>(yearly_data) << sep;
-        ss << std::get<2>(yearly_data) << sep;
-        ss << std::get<3>(yearly_data) << sep;
-        ss << std::get<4>(yearly_data) << sep;
-        ss << std::get<5>(yearly_data) << '\n';
+    // One row per (location, month, drug, from genotype, to genotype) and its count
+    const auto &mutation_tracker = Model::get_mdc()->mutation_tracker;
+    if (!mutation_tracker.empty()) {
+      for (const auto &[key, count] : mutation_tracker.sorted_counts()) {
+        for (const auto value : key) { ss << value << sep; }
+        ss << count << '\n';
       }
-    }
-    if (sum > 0) {
       monthly_mutation_logger->info(ss.str());
-      for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
-        Model::get_mdc()->mutation_tracker[loc].clear();
-      }
     }
 
     ss.str("");
-    sum = 0;
-    for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
-      sum += static_cast<int>(
-          Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].size());
-      for (auto &genotype_tracked :
-           Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc]) {
-        ss << std::get<0>(genotype_tracked) << sep;
-        ss << std::get<1>(genotype_tracked) << sep;
-        ss << std::get<2>(genotype_tracked) << sep;
-        ss << std::get<3>(genotype_tracked) << '\n';
-           }
-    }
-    if (sum > 0) {
+    // One row per (location, month, parent genotypes, recombined genotype) and its count
+    const auto &recombination_tracker =
+        Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker;
+    if (!recombination_tracker.empty()) {
+      for (const auto &[key, count] : recombination_tracker.sorted_counts()) {
+        for (const auto value : key) { ss << value << sep; }
+        ss << count << '\n';
+      }
       mosquito_res_count_logger->info(ss.str());
-      for (auto loc = 0; loc < Model::get_config()->number_of_locations(); loc++) {
-        Model::get_mdc()->mosquito_recombined_resistant_genotype_tracker[loc].clear();
+    }
+
+    // One row per sampled event: the day it occurred followed by its key
+    if (monthly_mutation_sample_logger != nullptr && !mutation_tracker.samples().empty()) {
+      ss.str("");
+      for (const auto &sample : mutation_tracker.samples()) {
+        ss << sample.day;
+        for (const auto value : sample.key) { ss << sep << value; }
+        ss << '\n';
+      }
+      monthly_mutation_sample_logger->info(ss.str());
+    }
+    if (mosquito_res_sample_logger != nullptr && !recombination_tracker.samples().empty()) {
+      ss.str("");
+      for (const auto &sample : recombination_tracker.samples()) {
+        ss << sample.day;
+        for (const auto value : sample.key) { ss << sep << value; }
+        ss << '\n';
       }
+      mosquito_res_sample_logger->info(ss.str());
     }
   }
 }
@@ -23,9 +23,14 @@ public:
   std::shared_ptr<spdlog::logger> gene_freq_logger;
   std::shared_ptr<spdlog::logger> monthly_mutation_logger;
   std::shared_ptr<spdlog::logger> mosquito_res_count_logger;
+  // Raw events sampled by the trackers, only with a model_settings.event_sample_capacity
+  std::shared_ptr<spdlog::logger> monthly_mutation_sample_logger;
+  std::shared_ptr<spdlog::logger> mosquito_res_sample_logger;
 
   std::string monthly_mutation_path = "";
   std::string mosquito_res_count_path = "";
+  std::string monthly_mutation_sample_path = "";
+  std::string mosquito_res_sample_path = "";
 
 public:
   ValidationReporter();
@@ -4,16 +4,23 @@
 #include <Population/Population.h>
 #include <Utils/Random.h>
 
+#include <cxxabi.h>
+#include <cstdlib>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 
 #include "Configuration/Config.h"
+#include "Core/Scheduler/EventTelemetry.h"
 #include "MDC/ModelDataCollector.h"
 #include "Mosquito/Mosquito.h"
 #include "Reporters/Reporter.h"
+#include "ReplicateFanOut.h"
+#include "Spatial/GIS/AscFile.h"
 #include "Treatment/LinearTCM.h"
 #include "Treatment/SteadyTCM.h"
 #include "Utils/Cli.h"
+#include "Utils/Profiler.h"
 
 bool Model::initialize() {
   config_ = std::make_unique<Config>();
@@ -40,6 +47,7 @@ bool Model::initialize() {
   }
 
   // if input path is not empty, load configuration file
+  AscFileManager::set_cache_directory(utils::Cli::get_instance().get_raster_cache_path());
   spdlog::info("Loading configuration file: " + utils::Cli::get_instance().get_input_path());
   if (config_->load(utils::Cli::get_instance().get_input_path())) {
     if (config_->get_model_settings().get_initial_seed_number() <= 0) {
@@ -52,6 +60,24 @@ bool Model::initialize() {
       utils::Cli::get_instance().set_output_path("./");
     }
 
+    if (utils::Cli::get_instance().get_profile()) {
+#ifdef ENABLE_PROFILER
+      utils::Profiler::get_instance().set_enabled(true);
+      utils::Profiler::get_instance().set_trace_path(
+          utils::Cli::get_instance().get_profile_trace_path());
+      spdlog::info("Profiler enabled.");
+#else
+      spdlog::warn("Profiling requested but the build was configured without ENABLE_PROFILER.");
+#endif
+    }
+
+    if (utils::Cli::get_instance().get_event_telemetry()) {
+      EventTelemetry::get_instance().set_enabled(true);
+      EventTelemetry::get_instance().set_metrics_path(
+          utils::Cli::get_instance().get_event_metrics_path());
+      spdlog::info("Event telemetry enabled.");
+    }
+
     spdlog::info("Model initialized with seed: " + std::to_string(random_->get_seed()));
     // add reporter here
     if (utils::Cli::get_instance().get_reporter().empty()) {
@@ -67,12 +93,15 @@ bool Model::initialize() {
     add_reporter(Reporter::MakeReport(Reporter::TRAVEL_TRACKING_REPORTER));
 #endif
 
-    // initialize reporters
-    for (auto &reporter : reporters_) {
-      reporter->initialize(utils::Cli::get_instance().get_job_number(),
-                           utils::Cli::get_instance().get_output_path());
+    // With a fan-out every replicate initializes the reporters with its own job number
+    const auto defer_reporters = utils::Cli::get_instance().get_fan_out() > 0;
+    if (!defer_reporters) {
+      for (auto &reporter : reporters_) {
+        reporter->initialize(utils::Cli::get_instance().get_job_number(),
+                             utils::Cli::get_instance().get_output_path());
+      }
+      spdlog::info("Model initialized reporters.");
     }
-    spdlog::info("Model initialized reporters.");
 
     scheduler_->initialize(config_->get_simulation_timeframe().get_starting_date(),
                            config_->get_simulation_timeframe().get_ending_date());
@@ -114,8 +143,10 @@ bool Model::initialize() {
     if (utils::Cli::get_instance().get_record_movement()) {
       // Generate a movement reporter
       auto reporter = Reporter::MakeReport(Reporter::ReportType::MOVEMENT_REPORTER);
-      reporter->initialize(utils::Cli::get_instance().get_job_number(),
-                           utils::Cli::get_instance().get_output_path());
+      if (!defer_reporters) {
+        reporter->initialize(utils::Cli::get_instance().get_job_number(),
+                             utils::Cli::get_instance().get_output_path());
+      }
       add_reporter(std::move(reporter));
     }
     is_initialized_ = true;
@@ -154,8 +185,57 @@ void Model::run() {
   if (!is_initialized_) {
     throw std::runtime_error("Model is not initialized. Call Initialize() first.");
   }
+  if (utils::Cli::get_instance().get_fan_out() > 0) {
+    fan_out_replicates();
+  } else {
+    before_run();
+    scheduler_->run();
+    after_run();
+  }
+
+  utils::Profiler::get_instance().report();
+  utils::Profiler::get_instance().write_trace();
+
+  EventTelemetry::get_instance().report();
+  // Close the metrics file
+  EventTelemetry::get_instance().set_metrics_path("");
+}
+
+void Model::fan_out_replicates() {
+  const auto &cli = utils::Cli::get_instance();
+  const auto fork_day = cli.get_fan_out_day() >= 0
+                            ? cli.get_fan_out_day()
+                            : config_->get_simulation_timeframe().get_start_of_comparison_period();
+
+  // The reporters are opened after the fork, nothing is reported during the burn-in
+  auto reporters = std::move(reporters_);
+  reporters_.clear();
+  spdlog::info("Simulating the burn-in up to day {}", fork_day);
+  scheduler_->run_until(fork_day);
+
+  EventTelemetry::get_instance().flush_metrics();
+  const ReplicateFanOut fan_out(cli.get_fan_out());
+  const auto replicate = fan_out.fork_replicates();
+  if (replicate == ReplicateFanOut::PARENT) {
+    spdlog::info("All {} replicates finished.", cli.get_fan_out());
+    return;
+  }
+
+  // The burn-in used the initial seed, each replicate continues on its own stream
+  random_->set_seed(ReplicateFanOut::seed(random_->get_seed(), replicate));
+  const auto job_number = fan_out.job_number(cli.get_job_number(), replicate);
+  spdlog::info("Replicate {} continues from day {} as job {} with seed {}", replicate,
+               scheduler_->current_time(), job_number, random_->get_seed());
+
+  // The trace and metrics files are shared with the other replicates, only the parent keeps them
+  utils::Profiler::get_instance().set_trace_path("");
+  EventTelemetry::get_instance().set_metrics_path("");
+
+  reporters_ = std::move(reporters);
+  for (auto &reporter : reporters_) { reporter->initialize(job_number, cli.get_output_path()); }
+
   before_run();
-  scheduler_->run();
+  scheduler_->run_until(std::numeric_limits<int>::max());
   after_run();
 }
 
@@ -187,31 +267,55 @@ void Model::end_time_step() {
 }
 
 void Model::daily_update() {
-  population_->update_all_individuals();
-  // for safety remove all dead by calling perform_death_event
-  population_->perform_death_event();
-  population_->perform_birth_event();
+  {
+    MALASIM_PROFILE_SCOPE("Population::update_all_individuals");
+    population_->update_all_individuals();
+  }
+  {
+    // for safety remove all dead by calling perform_death_event
+    MALASIM_PROFILE_SCOPE("Population::perform_death_event");
+    population_->perform_death_event();
+  }
+  {
+    MALASIM_PROFILE_SCOPE("Population::perform_birth_event");
+    population_->perform_birth_event();
+  }
 
   // update current foi should be call after perform death, birth event
   // in order to obtain the right all alive individuals,
   // infection event will use pre-calculated individual relative biting rate to
   // infect new infections circulation event will use pre-calculated individual
   // relative moving rate to migrate individual to new location
-  population_->update_current_foi();
+  {
+    MALASIM_PROFILE_SCOPE("Population::update_current_foi");
+    population_->update_current_foi();
+  }
 
-  population_->perform_infection_event();
-  population_->perform_circulation_event();
+  {
+    MALASIM_PROFILE_SCOPE("Population::perform_infection_event");
+    population_->perform_infection_event();
+  }
+  {
+    MALASIM_PROFILE_SCOPE("Population::perform_circulation_event");
+    population_->perform_circulation_event();
+  }
 
   // infect new mosquito cohort in prmc must be run after population perform
   // infection event and update current foi because the prmc at the tracking
   // index will be overridden with new cohort to use N days later and infection
   // event used the prmc at the tracking index for the today infection
-  auto tracking_index = scheduler_->current_time() % config_->number_of_tracking_days();
-  mosquito_->infect_new_cohort_in_PRMC(config_.get(), random_.get(), population_.get(),
-                                       tracking_index);
+  {
+    MALASIM_PROFILE_SCOPE("Mosquito::infect_new_cohort_in_PRMC");
+    auto tracking_index = scheduler_->current_time() % config_->number_of_tracking_days();
+    mosquito_->infect_new_cohort_in_PRMC(config_.get(), random_.get(), population_.get(),
+                                         tracking_index);
+  }
 
   // this function must be called after mosquito infect new cohort in prmc
-  population_->persist_current_force_of_infection_to_use_n_days_later();
+  {
+    MALASIM_PROFILE_SCOPE("Population::persist_current_force_of_infection");
+    population_->persist_current_force_of_infection_to_use_n_days_later();
+  }
 }
 
 void Model::monthly_update() {
@@ -232,7 +336,19 @@ void Model::yearly_update() { mdc_->yearly_update(); }
 void Model::monthly_report() {
   mdc_->perform_population_statistic();
 
-  for (auto &reporter : reporters_) { reporter->monthly_report(); }
+  for (auto &reporter : reporters_) {
+    MALASIM_PROFILE_SCOPE_DYNAMIC(profile_stage_name(reporter.get()));
+    reporter->monthly_report();
+  }
+}
+
+std::string Model::profile_stage_name(Reporter* reporter) {
+  const char* mangled = typeid(*reporter).name();
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+  std::string name = status == 0 ? demangled : mangled;
+  std::free(demangled);
+  return name + "::monthly_report";
 }
 
 void Model::report_begin_of_time_step() {
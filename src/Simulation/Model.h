@@ -72,6 +72,9 @@ private:
 public:
   void before_run();
   void run();
+  // Simulate the burn-in, then fork the replicates requested with --fan-out. Each replicate
+  // finishes the run, the parent returns once they all exited
+  void fan_out_replicates();
   void after_run();
   void begin_time_step();
   void end_time_step();
@@ -167,6 +170,8 @@ public:
   void build_initial_treatment_coverage();
   void monthly_report();
   void report_begin_of_time_step();
+  // Stage name used by the profiler for the given reporter's monthly report
+  static std::string profile_stage_name(Reporter* reporter);
   void add_reporter(std::unique_ptr<Reporter> reporter);
 
   std::vector<std::unique_ptr<Reporter>>& get_reporters();
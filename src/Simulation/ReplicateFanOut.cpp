@@ -0,0 +1,91 @@
+/*
+ * ReplicateFanOut.cpp
+ *
+ * Implement the ReplicateFanOut class.
+ */
+#include "ReplicateFanOut.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Utils/Logger.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define REPLICATE_FAN_OUT_FORK
+#endif
+
+ReplicateFanOut::ReplicateFanOut(int number_of_replicates)
+    : number_of_replicates_(number_of_replicates) {
+  if (number_of_replicates_ < 1) {
+    throw std::invalid_argument("The replicate fan-out needs at least one replicate.");
+  }
+}
+
+uint64_t ReplicateFanOut::seed(uint64_t initial_seed, int replicate) {
+  // splitmix64 of the initial seed advanced by replicate + 1 steps
+  auto z = initial_seed + (static_cast<uint64_t>(replicate) + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31U);
+}
+
+int ReplicateFanOut::fork_replicates() const {
+#ifndef REPLICATE_FAN_OUT_FORK
+  spdlog::warn("Forking replicates is not supported on this platform, running one replicate.");
+  return 0;
+#else
+  // The async logger thread does not survive a fork, stop it and start one per process
+  const auto log_level = spdlog::get_level();
+  Logger::shutdown();
+  // Buffered output would otherwise be written again by every replicate
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  std::vector<pid_t> pids;
+  for (auto replicate = 0; replicate < number_of_replicates_; replicate++) {
+    const auto pid = ::fork();
+    if (pid == 0) {
+      Logger::initialize(log_level);
+      return replicate;
+    }
+    if (pid < 0) {
+      const auto error = errno;
+      Logger::initialize(log_level);
+      // Do not leave the replicates forked so far running on their own
+      for (const auto child : pids) { ::kill(child, SIGTERM); }
+      for (const auto child : pids) {
+        while (::waitpid(child, nullptr, 0) < 0 && errno == EINTR) {}
+      }
+      throw std::runtime_error(std::string("Cannot fork replicate: ") + std::strerror(error));
+    }
+    pids.push_back(pid);
+  }
+  Logger::initialize(log_level);
+  spdlog::info("Forked {} replicates, waiting for them to finish.", pids.size());
+
+  auto failed = 0;
+  for (std::size_t replicate = 0; replicate < pids.size(); replicate++) {
+    auto status = 0;
+    while (::waitpid(pids[replicate], &status, 0) < 0 && errno == EINTR) {}
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      spdlog::error("Replicate {} (pid {}) did not exit cleanly.", replicate, pids[replicate]);
+      failed++;
+    }
+  }
+  if (failed > 0) {
+    throw std::runtime_error(fmt::format("{} of {} replicates failed.", failed, pids.size()));
+  }
+  return PARENT;
+#endif
+}
@@ -0,0 +1,42 @@
+/*
+ * ReplicateFanOut.h
+ *
+ * Fork a number of replicate processes from a model that has simulated a
+ * shared burn-in. Every child starts from a copy-on-write image of the parent,
+ * so the burn-in is simulated once and the pages of the population that a
+ * replicate does not write to stay shared between the replicates.
+ */
+#ifndef REPLICATEFANOUT_H
+#define REPLICATEFANOUT_H
+
+#include <cstdint>
+
+class ReplicateFanOut {
+public:
+  // Returned by fork_replicates() in the calling process
+  static constexpr int PARENT = -1;
+
+  explicit ReplicateFanOut(int number_of_replicates);
+
+  // Fork the replicates. Each child gets the index of its replicate in
+  // [0, number_of_replicates), the caller gets PARENT once every child has
+  // exited. Throws if a replicate could not be forked or did not exit cleanly.
+  [[nodiscard]] int fork_replicates() const;
+
+  [[nodiscard]] int number_of_replicates() const { return number_of_replicates_; }
+
+  // Job number the replicate reports as. The replicates of consecutive jobs
+  // get disjoint ranges so a batch of fanned-out jobs never shares an output.
+  [[nodiscard]] int job_number(int job, int replicate) const {
+    return job * number_of_replicates_ + replicate;
+  }
+
+  // Seed the replicate continues with. The (seed, replicate) pair is mixed
+  // with splitmix64 so the replicates of different seeds do not share a stream.
+  [[nodiscard]] static uint64_t seed(uint64_t initial_seed, int replicate);
+
+private:
+  int number_of_replicates_;
+};
+
+#endif  // REPLICATEFANOUT_H
@@ -8,9 +8,107 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <random>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ASC_CACHE_MMAP
+#endif
+
+namespace {
+constexpr std::array<char, 8> CACHE_MAGIC{'M', 'S', 'A', 'S', 'C', '0', '0', '1'};
+
+// Layout of the binary cache, the values follow the header as float32
+struct CacheHeader {
+  std::array<char, 8> magic;
+  uint64_t source_size;
+  int64_t source_mtime;
+  int32_t nrows;
+  int32_t ncols;
+  double xllcenter;
+  double yllcenter;
+  double xllcorner;
+  double yllcorner;
+  double cellsize;
+  double nodata_value;
+};
+static_assert(std::is_trivially_copyable_v<CacheHeader>);
+static_assert(sizeof(CacheHeader) % alignof(float) == 0);
+
+// Size and modification time of the file, false if they are not available
+bool get_source_stamp(const std::string &file_name, uint64_t &size, int64_t &mtime) {
+  std::error_code ec;
+  size = std::filesystem::file_size(file_name, ec);
+  if (ec) { return false; }
+  const auto time = std::filesystem::last_write_time(file_name, ec);
+  if (ec) { return false; }
+  mtime = static_cast<int64_t>(time.time_since_epoch().count());
+  return true;
+}
+
+bool is_valid_header(const CacheHeader &header, uint64_t source_size, int64_t source_mtime,
+                     uint64_t cache_size) {
+  return header.magic == CACHE_MAGIC && header.source_size == source_size
+         && header.source_mtime == source_mtime && header.nrows > 0 && header.ncols > 0
+         && cache_size
+                == sizeof(CacheHeader)
+                       + (static_cast<uint64_t>(header.nrows) * header.ncols * sizeof(float));
+}
+
+void copy_header(const CacheHeader &header, AscFile* file) {
+  file->nrows = header.nrows;
+  file->ncols = header.ncols;
+  file->xllcenter = header.xllcenter;
+  file->yllcenter = header.yllcenter;
+  file->xllcorner = header.xllcorner;
+  file->yllcorner = header.yllcorner;
+  file->cellsize = header.cellsize;
+  file->nodata_value = header.nodata_value;
+}
+}  // namespace
+
+AscData::AscData(const AscData &other) { *this = other; }
+
+AscData &AscData::operator=(const AscData &other) {
+  if (this == &other) { return *this; }
+  // Copies always own their values
+  owned_.assign(other.values_, other.values_ + (other.nrows_ * other.ncols_));
+  mapping_.reset();
+  values_ = owned_.data();
+  nrows_ = other.nrows_;
+  ncols_ = other.ncols_;
+  return *this;
+}
+
+void AscData::assign(int nrows, int ncols, float value) {
+  mapping_.reset();
+  nrows_ = static_cast<std::size_t>(std::max(nrows, 0));
+  ncols_ = static_cast<std::size_t>(std::max(ncols, 0));
+  owned_.assign(nrows_ * ncols_, value);
+  values_ = owned_.data();
+}
+
+void AscData::adopt(std::shared_ptr<void> mapping, float* values, int nrows, int ncols) {
+  owned_.clear();
+  owned_.shrink_to_fit();
+  mapping_ = std::move(mapping);
+  values_ = values;
+  nrows_ = static_cast<std::size_t>(nrows);
+  ncols_ = static_cast<std::size_t>(ncols);
+}
 
 // Check that the contents fo the ASC file are correct. Returns TRUE if any
 // errors are found, which are enumerated in the string provided.
@@ -39,13 +137,21 @@ std::string AscFileManager::check_asc_file(const AscFile* file) {
 // Read the indicated file from disk, caller is responsible for checking if
 // data is integer or floating point.
 std::unique_ptr<AscFile> AscFileManager::read(const std::string &file_name) {
+  if (auto cached = read_cache(file_name)) { return cached; }
+
+  auto results = parse(file_name);
+  write_cache(results.get(), file_name);
+  return results;
+}
+
+std::unique_ptr<AscFile> AscFileManager::parse(const std::string &file_name) {
   // Treat the struct as POD
   auto results = std::make_unique<AscFile>();
 
   // Open the file and verify it
   std::string field;
   std::string value;
-  std::ifstream in(file_name);
+  std::ifstream in(file_name, std::ios::binary);
 
   if (!in.good()) { throw std::runtime_error("Error opening ASC file: " + file_name); }
   if (in.peek() == std::ifstream::traits_type::eof()) {
@@ -83,27 +189,154 @@ std::unique_ptr<AscFile> AscFileManager::read(const std::string &file_name) {
   if (!errors.empty()) { throw std::runtime_error(errors); }
 
   // Allocate the memory and read the remainder of the actual raster data
-  // Allocate the memory using vectors
-  results->data.resize(results->nrows);
-  for (auto &row : results->data) { row.resize(results->ncols); }
-
-  // Remainder of the file is the actual raster data
-  for (auto ndx = 0; ndx < results->nrows; ndx++) {
-    for (auto ndy = 0; ndy < results->ncols; ndy++) {
-      if (in.eof()) {
+  results->data.assign(results->nrows, results->ncols);
+
+  // Remainder of the file is the actual raster data, read it as one block and
+  // convert the values in place rather than extracting them one by one
+  const auto start = in.tellg();
+  in.seekg(0, std::ios::end);
+  std::string buffer(static_cast<std::size_t>(in.tellg() - start), '\0');
+  in.seekg(start);
+  in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  in.close();
+
+  const char* cursor = buffer.c_str();
+  for (auto &cell : results->data.values()) {
+    char* end = nullptr;
+    cell = std::strtof(cursor, &end);
+    if (end == cursor) {
+      while (std::isspace(static_cast<unsigned char>(*cursor)) != 0) { cursor++; }
+      if (*cursor == '\0') {
         throw std::runtime_error("EOF encountered while reading data from: " + file_name);
       }
-      in >> value;
-      results->data[ndx][ndy] = std::stof(value);
+      throw std::runtime_error("Invalid value encountered while reading data from: " + file_name);
     }
+    cursor = end;
   }
-  // Clean-up and return
-  in.close();
   return results;
 }
 
+std::string AscFileManager::get_cache_path(const std::string &file_name) {
+  if (cache_directory_.empty()) { return ""; }
+  std::error_code ec;
+  auto source = std::filesystem::absolute(file_name, ec);
+  if (ec) { source = file_name; }
+  source = source.lexically_normal();
+  return (std::filesystem::path(cache_directory_)
+          / fmt::format("{}.{:016x}{}", source.filename().string(),
+                        std::hash<std::string>{}(source.string()), CACHE_EXTENSION))
+      .string();
+}
+
+std::unique_ptr<AscFile> AscFileManager::read_cache(const std::string &file_name) {
+  const auto cache_name = get_cache_path(file_name);
+  if (cache_name.empty()) { return nullptr; }
+
+  uint64_t source_size = 0;
+  int64_t source_mtime = 0;
+  if (!get_source_stamp(file_name, source_size, source_mtime)) { return nullptr; }
+
+  auto results = std::make_unique<AscFile>();
+#ifdef ASC_CACHE_MMAP
+  const auto fd = ::open(cache_name.c_str(), O_RDONLY);
+  if (fd < 0) { return nullptr; }
+  struct stat info {};
+  if (::fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(CacheHeader)) {
+    ::close(fd);
+    return nullptr;
+  }
+  const auto length = static_cast<std::size_t>(info.st_size);
+  // Private mapping, writes to the raster stay in memory
+  auto* address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (address == MAP_FAILED) { return nullptr; }
+  std::shared_ptr<void> mapping(address, [length](void* ptr) { ::munmap(ptr, length); });
+
+  CacheHeader header{};
+  std::memcpy(&header, address, sizeof(CacheHeader));
+  if (!is_valid_header(header, source_size, source_mtime, length)) { return nullptr; }
+
+  copy_header(header, results.get());
+  auto* values = reinterpret_cast<float*>(static_cast<char*>(address) + sizeof(CacheHeader));
+  results->data.adopt(std::move(mapping), values, header.nrows, header.ncols);
+#else
+  std::ifstream in(cache_name, std::ios::binary);
+  if (!in.good()) { return nullptr; }
+  CacheHeader header{};
+  in.read(reinterpret_cast<char*>(&header), sizeof(CacheHeader));
+  std::error_code ec;
+  const auto length = std::filesystem::file_size(cache_name, ec);
+  if (!in.good() || ec || !is_valid_header(header, source_size, source_mtime, length)) {
+    return nullptr;
+  }
+
+  copy_header(header, results.get());
+  results->data.assign(header.nrows, header.ncols);
+  const auto values = results->data.values();
+  in.read(reinterpret_cast<char*>(values.data()),
+          static_cast<std::streamsize>(values.size_bytes()));
+  if (!in.good()) { return nullptr; }
+#endif
+  spdlog::debug("Loaded {} from the binary cache", file_name);
+  return results;
+}
+
+void AscFileManager::write_cache(const AscFile* file, const std::string &file_name) {
+  const auto values = file->data.values();
+  const auto cache_name = get_cache_path(file_name);
+  if (cache_name.empty() || values.size() < CACHE_MIN_CELLS) { return; }
+
+  CacheHeader header{};
+  header.magic = CACHE_MAGIC;
+  if (!get_source_stamp(file_name, header.source_size, header.source_mtime)) { return; }
+  header.nrows = file->nrows;
+  header.ncols = file->ncols;
+  header.xllcenter = file->xllcenter;
+  header.yllcenter = file->yllcenter;
+  header.xllcorner = file->xllcorner;
+  header.yllcorner = file->yllcorner;
+  header.cellsize = file->cellsize;
+  header.nodata_value = file->nodata_value;
+
+  std::error_code ec;
+  std::filesystem::create_directories(cache_directory_, ec);
+  if (ec) {
+    spdlog::warn("Unable to create the raster cache directory {}: {}", cache_directory_,
+                 ec.message());
+    return;
+  }
+
+  // Write to a unique temporary file first so concurrent runs never read a
+  // partially written cache
+  const auto temporary_name = cache_name + "." + std::to_string(std::random_device{}());
+  {
+    std::ofstream out(temporary_name, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(values.size_bytes()));
+    if (!out.good()) {
+      spdlog::warn("Unable to write the binary cache of {} to {}", file_name, cache_name);
+      out.close();
+      std::filesystem::remove(temporary_name, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(temporary_name, cache_name, ec);
+  if (ec) {
+    spdlog::warn("Unable to write the binary cache of {} to {}: {}", file_name, cache_name,
+                 ec.message());
+    std::filesystem::remove(temporary_name, ec);
+  }
+}
+
 // Write the contents of the AscFile to disk.
 void AscFileManager::write(AscFile* file, const std::string &file_name) {
+  // The cache would be stale once the file is rewritten
+  if (const auto cache_name = get_cache_path(file_name); !cache_name.empty()) {
+    std::error_code ec;
+    std::filesystem::remove(cache_name, ec);
+  }
+
   // Open the file for writing
   std::ofstream out(file_name);
 
@@ -9,9 +9,51 @@
 #ifndef ASCFILE_H
 #define ASCFILE_H
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
+
+// Raster values stored row-major in one contiguous block and indexed as
+// data[row][col]. The block is either owned or mapped from a binary cache
+// file, in which case the mapping is released with the data.
+class AscData {
+public:
+  AscData() = default;
+  AscData(const AscData &other);
+  AscData &operator=(const AscData &other);
+  AscData(AscData &&) noexcept = default;
+  AscData &operator=(AscData &&) noexcept = default;
+  ~AscData() = default;
+
+  // Allocate nrows x ncols values, all set to value
+  void assign(int nrows, int ncols, float value = 0);
+
+  // Use values owned by the mapping, which is kept alive with the data
+  void adopt(std::shared_ptr<void> mapping, float* values, int nrows, int ncols);
+
+  float* operator[](std::size_t row) { return values_ + (row * ncols_); }
+  const float* operator[](std::size_t row) const { return values_ + (row * ncols_); }
+
+  // Number of rows
+  [[nodiscard]] std::size_t size() const { return nrows_; }
+  [[nodiscard]] bool empty() const { return nrows_ == 0 || ncols_ == 0; }
+
+  // All values, row after row
+  [[nodiscard]] std::span<float> values() { return {values_, nrows_ * ncols_}; }
+  [[nodiscard]] std::span<const float> values() const { return {values_, nrows_ * ncols_}; }
+
+  [[nodiscard]] bool is_mapped() const { return mapping_ != nullptr; }
+
+private:
+  std::vector<float> owned_;
+  std::shared_ptr<void> mapping_;
+  float* values_{nullptr};
+  std::size_t nrows_{0};
+  std::size_t ncols_{0};
+};
+
 // The ASC file either as read, or to be written. Note that since the
 // specification does not provide a header indicating if the data is floating
 // point or integer, the data is presumed to be floating point.
@@ -48,9 +90,14 @@ struct AscFile {
   double nodata_value = 0;
 
   // The data stored in the file
-  std::vector<std::vector<float>> data;
+  AscData data;
 };
 
+// Parsing the text of a large raster dominates the startup, so when a cache
+// directory is set the raster is also saved there in binary after the first
+// parse. The cache holds the header and the values as one float32 block, and
+// is only used while the size and modification time of the ASC file match the
+// ones recorded in it.
 class AscFileManager {
 private:
   static const int HEADER_WIDTH = 14;
@@ -58,12 +105,31 @@ private:
   // Static class, no need to instantiate.
   AscFileManager() = default;
 
+  static std::unique_ptr<AscFile> parse(const std::string &file_name);
+  static std::unique_ptr<AscFile> read_cache(const std::string &file_name);
+  static void write_cache(const AscFile* file, const std::string &file_name);
+
+  inline static std::string cache_directory_;
+
 public:
+  inline static const std::string CACHE_EXTENSION = ".cache";
+
+  // Rasters with fewer cells parse quickly enough to not be cached
+  static constexpr std::size_t CACHE_MIN_CELLS = 1 << 16;
+
   // Returns an empty string if the file is valid, otherwise returns a string
   // describing the errors.
   static std::string check_asc_file(const AscFile* file);
   static std::unique_ptr<AscFile> read(const std::string &file_name);
   static void write(AscFile* file, const std::string &file_name);
+
+  // Caching is disabled while the directory is empty, which is the default
+  [[nodiscard]] static const std::string &get_cache_directory() { return cache_directory_; }
+  static void set_cache_directory(const std::string &value) { cache_directory_ = value; }
+
+  // Cache of the raster within the cache directory, named after the file and
+  // a hash of its absolute path. Empty when caching is disabled.
+  [[nodiscard]] static std::string get_cache_path(const std::string &file_name);
 };
 
 #endif
@@ -0,0 +1,55 @@
+/*
+ * CumulativeDistribution.h
+ *
+ * Cumulative table of the weights of a discrete distribution, used by the MFT
+ * strategies to select a therapy (or a nested strategy) from a single uniform
+ * draw. The weights are accumulated in order, so a lookup returns exactly the
+ * entry a linear scan of the weights would.
+ *
+ * The table is not refreshed on lookup: the owner rebuilds it wherever it
+ * changes the weights, so a draw only costs the binary search.
+ */
+#ifndef CUMULATIVEDISTRIBUTION_H
+#define CUMULATIVEDISTRIBUTION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+class CumulativeDistribution {
+public:
+  // Build the table from the weights, the owner calls it whenever they change
+  template <typename T>
+  void build(const std::vector<T> &weights) {
+    cumulative_.resize(weights.size());
+    double sum = 0;
+    monotonic_ = true;
+    for (std::size_t i = 0; i < weights.size(); i++) {
+      sum += weights[i];
+      cumulative_[i] = sum;
+      if (weights[i] < 0) { monotonic_ = false; }
+    }
+  }
+
+  // Index of the first entry whose cumulative weight is at least p, or size()
+  // when p exceeds the total weight
+  [[nodiscard]] std::size_t select(double p) const {
+    if (monotonic_) {
+      return static_cast<std::size_t>(
+          std::lower_bound(cumulative_.begin(), cumulative_.end(), p) - cumulative_.begin());
+    }
+    // Negative weights break the ordering, fall back to the linear scan
+    for (std::size_t i = 0; i < cumulative_.size(); i++) {
+      if (p <= cumulative_[i]) { return i; }
+    }
+    return cumulative_.size();
+  }
+
+  [[nodiscard]] std::size_t size() const { return cumulative_.size(); }
+
+private:
+  std::vector<double> cumulative_;
+  bool monotonic_{true};
+};
+
+#endif  // CUMULATIVEDISTRIBUTION_H
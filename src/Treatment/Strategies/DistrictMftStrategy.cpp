@@ -19,7 +19,8 @@ DistrictMftStrategy::DistrictMftStrategy() : IStrategy("DistrictMFT", StrategyTy
   // Size the map to accommodate either 0-based or 1-based district IDs
   // Pre-populate map with nullptr entries for all possible district IDs
   auto vector_size = Model::get_spatial_data()->get_boundary("district")->max_unit_id + 1;
-  for (int i = 0; i < vector_size; i++) { district_strategies[i] = nullptr; }
+  district_strategies.resize(vector_size);
+  district_level_id = Model::get_spatial_data()->get_admin_level_id("district");
 }
 
 void DistrictMftStrategy::add_therapy(Therapy* therapy) {
@@ -40,22 +41,21 @@ void DistrictMftStrategy::set_district_strategy(int district,
         fmt::format("District {} already has an MFT strategy assigned", district));
   }
 
-  // Move the unique_ptr to our map
+  // Move the unique_ptr to our vector
+  strategy->cumulative.build(strategy->percentages);
   district_strategies[district] = std::move(strategy);
 }
 
 Therapy* DistrictMftStrategy::get_therapy(Person* person) {
   // Resolve the MFT for this district
-  auto district = Model::get_spatial_data()->get_admin_unit("district", person->get_location());
+  auto district =
+      Model::get_spatial_data()->get_admin_unit(district_level_id, person->get_location());
   auto* mft = district_strategies[district].get();
 
   // Select the therapy to give the individual
   auto pr = Model::get_random()->random_flat(0.0, 1.0);
-  auto sum = 0.0;
-  for (auto ndx = 0; ndx < mft->percentages.size(); ndx++) {
-    sum += mft->percentages[ndx];
-    if (pr <= sum) { return Model::get_therapy_db()[mft->therapies[ndx]].get(); }
-  }
+  auto ndx = mft->cumulative.select(pr);
+  if (ndx < mft->cumulative.size()) { return Model::get_therapy_db()[mft->therapies[ndx]].get(); }
 
   // Since we should ways return above, throw an error if we get here
   throw std::runtime_error("Scanned for therapy without finding a match: " + this->name
@@ -7,6 +7,7 @@
 #define POMS_DISTRICTMFTSTRATEGY_H
 
 #include <memory>  // Add this for unique_ptr
+#include "CumulativeDistribution.h"
 #include "IStrategy.h"
 
 class DistrictMftStrategy : public IStrategy {
@@ -20,10 +21,14 @@ public:
   struct MftStrategy {
     std::vector<int> therapies;
     std::vector<float> percentages;
+    // Built from the percentages when the MFT is assigned to a district
+    CumulativeDistribution cumulative;
   };
 
 private:
-  std::map<int, std::unique_ptr<MftStrategy>> district_strategies;
+  // Indexed by district ID
+  std::vector<std::unique_ptr<MftStrategy>> district_strategies;
+  int district_level_id{-1};
 
 public:
   DistrictMftStrategy();
@@ -25,17 +25,19 @@ Therapy *MFTMultiLocationStrategy::get_therapy(Person *person) {
   const auto p = Model::get_random()->random_flat(0.0, 1.0);
   const auto loc = person->get_location();
 
-  double sum = 0;
-  for (auto i = 0; i < distribution[loc].size(); i++) {
-    sum += distribution[loc][i];
-    if (p <= sum) {
-      return therapy_list[i];
-    }
-  }
-
+  const auto &cumulative = cumulative_distribution_[loc];
+  const auto index = cumulative.select(p);
+  if (index < cumulative.size()) { return therapy_list[index]; }
   return therapy_list[therapy_list.size() - 1];
 }
 
+void MFTMultiLocationStrategy::rebuild_cumulative_distribution() {
+  cumulative_distribution_.resize(distribution.size());
+  for (std::size_t loc = 0; loc < distribution.size(); loc++) {
+    cumulative_distribution_[loc].build(distribution[loc]);
+  }
+}
+
 std::string MFTMultiLocationStrategy::to_string() const {
   std::stringstream sstm;
   sstm << IStrategy::id << "-" << IStrategy::name << "-";
@@ -60,6 +62,7 @@ void MFTMultiLocationStrategy::update_end_of_time_step() {
 
 void MFTMultiLocationStrategy::adjust_started_time_point(const int &current_time) {
   starting_time = current_time;
+  rebuild_cumulative_distribution();
 }
 
 void MFTMultiLocationStrategy::monthly_update() {
@@ -90,4 +93,5 @@ void MFTMultiLocationStrategy::monthly_update() {
       }
     }
   }
+  rebuild_cumulative_distribution();
 }
@@ -1,6 +1,7 @@
 #ifndef POMS_MFTDIFFERENTDISTRIBUTIONBYLOCATIONSTRATEGY_H
 #define POMS_MFTDIFFERENTDISTRIBUTIONBYLOCATIONSTRATEGY_H
 
+#include "CumulativeDistribution.h"
 #include "IStrategy.h"
 #include "Utils/TypeDef.h"
 
@@ -37,6 +38,12 @@ class MFTMultiLocationStrategy : public IStrategy {
 
   void monthly_update() override;
 
+  // Rebuild the selection tables, must be called after changing distribution
+  void rebuild_cumulative_distribution();
+
+ private:
+  // Cumulative distribution of each location
+  std::vector<CumulativeDistribution> cumulative_distribution_;
 };
 
 #endif //POMS_MFTDIFFERENTDISTRIBUTIONBYLOCATIONSTRATEGY_H
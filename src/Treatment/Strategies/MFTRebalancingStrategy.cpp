@@ -41,6 +41,7 @@ void MFTRebalancingStrategy::update_end_of_time_step() {
     for (auto i = 0; i < distribution.size(); i++) {
       distribution[i] = next_distribution[i];
     }
+    rebuild_cumulative_distribution();
     next_update_time = Model::get_scheduler()->current_time() + update_duration_after_rebalancing;
     std::cout << Model::get_scheduler()->get_current_date_string() << ": MFT Rebalancing adjust distribution: "
               << to_string();
@@ -75,4 +76,5 @@ void MFTRebalancingStrategy::update_end_of_time_step() {
 void MFTRebalancingStrategy::adjust_started_time_point(const int &current_time) {
   next_update_time = Model::get_scheduler()->current_time() + update_duration_after_rebalancing;
   latest_adjust_distribution_time = -1;
+  MFTStrategy::adjust_started_time_point(current_time);
 }
@@ -14,17 +14,16 @@ void MFTStrategy::add_therapy(Therapy *therapy) {
 }
 
 Therapy *MFTStrategy::get_therapy(Person *person) {
+  return select_therapy(Model::get_random()->random_flat(0.0, 1.0));
+}
 
-  const auto p = Model::get_random()->random_flat(0.0, 1.0);
-
-  double sum = 0;
-  for (auto i = 0; i < distribution.size(); i++) {
-    sum += distribution[i];
-    if (p <= sum) {
-      return therapy_list[i];
-    }
-  }
+void MFTStrategy::rebuild_cumulative_distribution() {
+  cumulative_distribution_.build(distribution);
+}
 
+Therapy *MFTStrategy::select_therapy(double p) const {
+  const auto index = cumulative_distribution_.select(p);
+  if (index < cumulative_distribution_.size()) { return therapy_list[index]; }
   return therapy_list[therapy_list.size() - 1];
 }
 
@@ -45,7 +44,9 @@ std::string MFTStrategy::to_string() const {
   return sstm.str();
 }
 
-void MFTStrategy::adjust_started_time_point(const int &current_time) {}
+void MFTStrategy::adjust_started_time_point(const int &current_time) {
+  rebuild_cumulative_distribution();
+}
 
 void MFTStrategy::monthly_update() {
   //do nothing here
@@ -1,6 +1,7 @@
 #ifndef MFTSTRATEGY_H
 #define MFTSTRATEGY_H
 
+#include "CumulativeDistribution.h"
 #include "IStrategy.h"
 #include <vector>
 
@@ -37,6 +38,15 @@ class MFTStrategy : public IStrategy {
   void adjust_started_time_point(const int &current_time) override;
 
   void monthly_update() override;
+
+  // Rebuild the selection table, must be called after changing distribution
+  void rebuild_cumulative_distribution();
+
+ protected:
+  // Therapy for the uniform draw p, the cumulative distribution must be up to date
+  Therapy *select_therapy(double p) const;
+
+  CumulativeDistribution cumulative_distribution_;
 };
 
 #endif /* MFTSTRATEGY_H */
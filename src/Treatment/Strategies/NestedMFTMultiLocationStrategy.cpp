@@ -25,14 +25,17 @@ Therapy* NestedMFTMultiLocationStrategy::get_therapy(Person* person) {
   const auto loc = person->get_location();
   const auto p = Model::get_random()->random_flat(0.0, 1.0);
 
-  double sum = 0;
-  for (auto i = 0; i < distribution[loc].size(); i++) {
-    sum += distribution[loc][i];
-    if (p <= sum) {
-      return strategy_list[i]->get_therapy(person);
-    }
+  const auto &cumulative = cumulative_distribution_[loc];
+  const auto index = cumulative.select(p);
+  return strategy_list[index < cumulative.size() ? index : strategy_list.size() - 1]->get_therapy(
+      person);
+}
+
+void NestedMFTMultiLocationStrategy::rebuild_cumulative_distribution() {
+  cumulative_distribution_.resize(distribution.size());
+  for (std::size_t loc = 0; loc < distribution.size(); loc++) {
+    cumulative_distribution_[loc].build(distribution[loc]);
   }
-  return strategy_list[strategy_list.size() - 1]->get_therapy(person);
 }
 
 std::string NestedMFTMultiLocationStrategy::to_string() const {
@@ -97,10 +100,12 @@ void NestedMFTMultiLocationStrategy::adjust_distribution(const int& time) {
       }
     }
   }
+  rebuild_cumulative_distribution();
 }
 
 void NestedMFTMultiLocationStrategy::adjust_started_time_point(const int& current_time) {
   starting_time = current_time;
+  rebuild_cumulative_distribution();
   // update each strategy in the nest
   for (auto* strategy : strategy_list) {
     strategy->adjust_started_time_point(current_time);
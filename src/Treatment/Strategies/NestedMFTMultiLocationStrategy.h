@@ -1,6 +1,7 @@
 #ifndef POMS_NESTEDSWITCHINGDIFFERENTDISTRIBUTIONBYLOCATION_H
 #define POMS_NESTEDSWITCHINGDIFFERENTDISTRIBUTIONBYLOCATION_H
 
+#include "CumulativeDistribution.h"
 #include "IStrategy.h"
 #include "Utils/TypeDef.h"
 
@@ -45,6 +46,12 @@ class NestedMFTMultiLocationStrategy : public IStrategy {
 
   void monthly_update() override;
 
+  // Rebuild the selection tables, must be called after changing distribution
+  void rebuild_cumulative_distribution();
+
+ private:
+  // Cumulative distribution of each location
+  std::vector<CumulativeDistribution> cumulative_distribution_;
 };
 
 #endif //POMS_NESTEDSWITCHINGDIFFERENTDISTRIBUTIONBYLOCATION_H
@@ -13,15 +13,16 @@ void NestedMFTStrategy::add_therapy(Therapy* therapy) { }
 
 Therapy* NestedMFTStrategy::get_therapy(Person* person) {
   const auto p = Model::get_random()->random_flat(0.0, 1.0);
+  return strategy_list[select_strategy(p)]->get_therapy(person);
+}
 
-  double sum = 0;
-  for (auto i = 0; i < distribution.size(); i++) {
-    sum += distribution[i];
-    if (p <= sum) {
-      return strategy_list[i]->get_therapy(person);
-    }
-  }
-  return strategy_list[strategy_list.size() - 1]->get_therapy(person);
+std::size_t NestedMFTStrategy::select_strategy(double p) {
+  const auto index = cumulative_distribution_.select(p);
+  return index < cumulative_distribution_.size() ? index : strategy_list.size() - 1;
+}
+
+void NestedMFTStrategy::rebuild_cumulative_distribution() {
+  cumulative_distribution_.build(distribution);
 }
 
 std::string NestedMFTStrategy::to_string() const {
@@ -40,6 +41,7 @@ void NestedMFTStrategy::adjust_started_time_point(const int& current_time) {
     strategy->adjust_started_time_point(current_time);
   }
   starting_time = current_time;
+  rebuild_cumulative_distribution();
 }
 
 void NestedMFTStrategy::update_end_of_time_step() {
@@ -72,4 +74,5 @@ void NestedMFTStrategy::adjust_distribution(const int& time) {
       }
     }
   }
+  rebuild_cumulative_distribution();
 }
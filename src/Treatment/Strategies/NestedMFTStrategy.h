@@ -1,6 +1,7 @@
 #ifndef NESTEDMFTSTRATEGY_H
 #define NESTEDMFTSTRATEGY_H
 
+#include "CumulativeDistribution.h"
 #include "IStrategy.h"
 
 class NestedMFTStrategy : public IStrategy {
@@ -29,6 +30,9 @@ class NestedMFTStrategy : public IStrategy {
 
   Therapy *get_therapy(Person *person) override;
 
+  // Index of the strategy in strategy_list for the uniform draw p
+  std::size_t select_strategy(double p);
+
   std::string to_string() const override;
 
   void adjust_started_time_point(const int &current_time) override;
@@ -38,6 +42,12 @@ class NestedMFTStrategy : public IStrategy {
   void monthly_update() override;
 
   void adjust_distribution(const int &time);
+
+  // Rebuild the selection table, must be called after changing distribution
+  void rebuild_cumulative_distribution();
+
+ private:
+  CumulativeDistribution cumulative_distribution_;
 };
 
 #endif // NESTEDMFTSTRATEGY_H
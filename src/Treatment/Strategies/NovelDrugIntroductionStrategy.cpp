@@ -56,6 +56,7 @@ void NovelDrugIntroductionStrategy::monthly_update() {
 
       new_public_stategy->peak_after = replacement_duration;
       new_public_stategy->starting_time = Model::get_scheduler()->current_time();
+      new_public_stategy->rebuild_cumulative_distribution();
 
       strategy_list[0] = new_public_stategy.get();
       new_public_stategy->id = static_cast<int>(Model::get_strategy_db().size());
@@ -111,6 +111,7 @@ std::unique_ptr<IStrategy> StrategyBuilder::build_mft_strategy(const YAML::Node
   }
   
   add_therapies(ns, result.get());
+  result->rebuild_cumulative_distribution();
   return result;
 }
 
@@ -130,6 +131,7 @@ std::unique_ptr<IStrategy> StrategyBuilder::build_nested_switching_strategy(
     result->add_strategy(Model::get_strategy_db()[ns["strategy_ids"][i].as<int>()].get());
   }
 
+  result->rebuild_cumulative_distribution();
   return result;
 }
 
@@ -148,6 +150,7 @@ std::unique_ptr<IStrategy> StrategyBuilder::build_mft_rebalancing_strategy(const
   result->delay_until_actual_trigger = ns["delay_until_actual_trigger"].as<int>();
   result->latest_adjust_distribution_time = 0;
 
+  result->rebuild_cumulative_distribution();
   return result;
 }
 
@@ -195,6 +198,7 @@ std::unique_ptr<IStrategy> StrategyBuilder::build_mft_multi_location_strategy(
 
   add_therapies(ns, result.get());
   result->peak_after = ns["peak_after"].as<int>();
+  result->rebuild_cumulative_distribution();
   return result;
 }
 
@@ -246,6 +250,7 @@ StrategyBuilder::build_nested_mft_different_distribution_by_location_strategy(
   }
 
   result->peak_after = ns["peak_after"].as<int>();
+  result->rebuild_cumulative_distribution();
   //    std::cout << result->to_string() << std::endl;
 
   return result;
@@ -273,6 +278,7 @@ std::unique_ptr<IStrategy> StrategyBuilder::build_novel_drug_introduction_strate
   result->replacement_fraction = ns["replacement_fraction"].as<double>();
   result->replacement_duration = ns["replacement_duration"].as<int>();
 
+  result->rebuild_cumulative_distribution();
   return result;
 }
 
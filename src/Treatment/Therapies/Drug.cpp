@@ -8,7 +8,6 @@
 #include "Population/Person/Person.h"
 #include "Simulation/Model.h"
 #include "Treatment/Therapies/DrugType.h"
-#include "Utils/Helpers/NumberHelpers.h"
 #include "Utils/Random.h"
 
 Drug::Drug(DrugType* drug_type)
@@ -52,12 +51,10 @@ double Drug::get_current_drug_concentration(int current_time) {
     //        return starting_value_ + Model::get_random()->random_uniform<double>(-0.1, 0.1);
     return starting_value_;
   } else {
-    const auto temp = NumberHelpers::is_equal(drug_type_->drug_half_life(), 0.0)
-                          ? -100
-                          : -(days - dosing_days_) * log(2)
-                                / drug_type_->drug_half_life();  //-ai*t = - t* ln2 / tstar
-    if (exp(temp) <= (10.0 / 100.0)) { return 0; }
-    return starting_value_ * exp(temp);
+    // Past the cut off the decay factor is 0
+    const auto decay = drug_type_->get_decay_factor(days - dosing_days_);
+    if (decay <= (10.0 / 100.0)) { return 0; }
+    return starting_value_ * decay;
   }
 }
 
@@ -94,6 +91,15 @@ void Drug::set_number_of_dosing_days(int dosingDays) {
 }
 
 double Drug::get_parasite_killing_rate(const int &genotype_id) const {
-  return drug_type_->get_parasite_killing_rate_by_concentration(
-      last_update_value_, Model::get_genotype_db()->at(genotype_id)->get_EC50_power_n(drug_type_));
+  return get_parasite_killing_rate(Model::get_genotype_db()->at(genotype_id));
+}
+
+double Drug::get_parasite_killing_rate(Genotype* genotype) const {
+  // The concentration changes once a day but is used for every clone
+  if (last_update_value_ != concentration_of_power_n_) {
+    concentration_of_power_n_ = last_update_value_;
+    concentration_power_n_ = pow(last_update_value_, drug_type_->n());
+  }
+  return drug_type_->get_parasite_killing_rate_by_concentration_power_n(
+      concentration_power_n_, genotype->get_EC50_power_n(drug_type_));
 }
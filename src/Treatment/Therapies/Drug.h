@@ -1,8 +1,12 @@
 #ifndef DRUG_H
 #define    DRUG_H
 
+#include <limits>
+
 #include "Population/DrugsInBlood.h"
 
+class Genotype;
+
 class Drug {
     // OBJECTPOOL(Drug)
 
@@ -23,6 +27,9 @@ private:
     double starting_value_;
     DrugType *drug_type_;
     DrugsInBlood *person_drugs_;
+    // last_update_value_^n for the value it was computed from
+    mutable double concentration_of_power_n_{std::numeric_limits<double>::quiet_NaN()};
+    mutable double concentration_power_n_{0.0};
 
 public:
     [[nodiscard]] int dosing_days() const {
@@ -90,6 +97,8 @@ public:
   void set_number_of_dosing_days(int dosingDays);
 
   double get_parasite_killing_rate(const int &genotype_id) const;
+
+  double get_parasite_killing_rate(Genotype* genotype) const;
 };
 
 #endif    /* DRUG_H */
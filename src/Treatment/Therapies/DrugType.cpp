@@ -4,6 +4,7 @@
 
 #include "Parasites/Genotype.h"
 #include "Simulation/Model.h"
+#include "Utils/Helpers/NumberHelpers.h"
 
 #ifndef LOG2_10
 #define LOG2_10 3.32192809489
@@ -21,15 +22,7 @@ DrugType::~DrugType() = default;
 
 double DrugType::get_parasite_killing_rate_by_concentration(
     const double &concentration, const double &EC50_power_n) {
-  const auto con_power_n = pow(concentration, n_);
-  // std::cout << "c: " << concentration << " n: " << n_ << " p_max: " <<
-  // maximum_parasite_killing_rate_ << " EC50_power_n: " << EC50_power_n << "
-  // con_power_n: " << con_power_n << std::endl;
-  const auto killing_perday = maximum_parasite_killing_rate_
-                              * (con_power_n / (con_power_n + EC50_power_n));
-  // std::cout<< "c: " << concentration << " n: " << n_ << " ppr: "<<
-  // killing_perday << std::endl;
-  return killing_perday;
+  return get_parasite_killing_rate_by_concentration_power_n(pow(concentration, n_), EC50_power_n);
 }
 
 double DrugType::n() { return n_; }
@@ -39,6 +32,18 @@ void DrugType::set_n(const double &n) {
   //    set_EC50_power_n(pow(EC50_, n_));
 }
 
+void DrugType::build_decay_table() {
+  decay_table_.clear();
+  if (drug_half_life_ <= 0 || NumberHelpers::is_equal(drug_half_life_, 0.0)) { return; }
+  // The day the dosing ends keeps the starting concentration
+  decay_table_.push_back(1.0);
+  for (auto days = 1;; days++) {
+    const auto decay = exp(-days * log(2) / drug_half_life_);  //-ai*t = - t* ln2 / tstar
+    if (decay <= (10.0 / 100.0)) { break; }
+    decay_table_.push_back(decay);
+  }
+}
+
 int DrugType::get_total_duration_of_drug_activity(
     const int &dosing_days) const {
   // CutOffPercent is 10
@@ -31,7 +31,18 @@ public:
   void set_name(std::string name) { name_ = name; }
 
   double drug_half_life() const { return drug_half_life_; }
-  void set_drug_half_life(double drug_half_life) { drug_half_life_ = drug_half_life; }
+  void set_drug_half_life(double drug_half_life) {
+    drug_half_life_ = drug_half_life;
+    build_decay_table();
+  }
+
+  // Fraction of the starting concentration left the given number of days
+  // after the last dose, 0 once it falls to the 10% cut off
+  [[nodiscard]] double get_decay_factor(int days_after_dosing) const {
+    return days_after_dosing >= 0 && days_after_dosing < static_cast<int>(decay_table_.size())
+               ? decay_table_[days_after_dosing]
+               : 0.0;
+  }
 
   double maximum_parasite_killing_rate() const { return maximum_parasite_killing_rate_; }
   void set_maximum_parasite_killing_rate(double maximum_parasite_killing_rate) { maximum_parasite_killing_rate_ = maximum_parasite_killing_rate; }
@@ -69,6 +80,13 @@ public:
 
   virtual double get_parasite_killing_rate_by_concentration(const double &concentration, const double &EC50_power_n);
 
+  // Same as above when concentration^n is already known
+  [[nodiscard]] double get_parasite_killing_rate_by_concentration_power_n(
+      double concentration_power_n, double EC50_power_n) const {
+    return maximum_parasite_killing_rate_
+           * (concentration_power_n / (concentration_power_n + EC50_power_n));
+  }
+
   virtual double n();
 
   virtual void set_n(const double &n);
@@ -78,8 +96,13 @@ public:
   void populate_resistant_aa_locations();
 
 private:
+  void build_decay_table();
+
   double n_;
   //    double EC50_;
+
+  // Decay factor by the number of days since the end of dosing
+  std::vector<double> decay_table_;
 };
 
 #endif /* DRUGTYPE_H */
@@ -0,0 +1,110 @@
+/*
+ * Arena.cpp
+ *
+ * Implement the Arena class.
+ */
+#include "Arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define ARENA_MMAP
+#endif
+
+namespace {
+// Regions are aligned to the transparent huge page size so the kernel can
+// back them with huge pages from the first byte
+constexpr std::size_t HUGE_PAGE_SIZE = std::size_t{2} << 20;
+
+void* map_region(std::size_t size) {
+#ifdef ARENA_MMAP
+  // Over-map by a huge page and trim both ends to get an aligned region
+  const auto mapped_size = size + HUGE_PAGE_SIZE;
+  auto* address = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (address == MAP_FAILED) { throw std::bad_alloc(); }
+
+  const auto start = reinterpret_cast<std::uintptr_t>(address);
+  const auto aligned = (start + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+  const auto head = aligned - start;
+  const auto tail = mapped_size - head - size;
+  if (head > 0) { ::munmap(address, head); }
+  if (tail > 0) { ::munmap(reinterpret_cast<void*>(aligned + size), tail); }
+
+  auto* region = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+  // Only advice, the region is usable either way
+  ::madvise(region, size, MADV_HUGEPAGE);
+#endif
+  return region;
+#else
+  return ::operator new(size, std::align_val_t{HUGE_PAGE_SIZE});
+#endif
+}
+
+void unmap_region(void* region, std::size_t size) {
+#ifdef ARENA_MMAP
+  ::munmap(region, size);
+#else
+  (void)size;
+  ::operator delete(region, std::align_val_t{HUGE_PAGE_SIZE});
+#endif
+}
+}  // namespace
+
+namespace utils {
+
+Arena::Arena(std::size_t slot_size, std::size_t slot_alignment) {
+  if (slot_size == 0 || slot_alignment == 0
+      || (slot_alignment & (slot_alignment - 1)) != 0) {
+    throw std::invalid_argument("Arena slots need a positive size and a power of two alignment.");
+  }
+  // A free slot holds the next pointer of the free list
+  const auto alignment = std::max(slot_alignment, alignof(FreeSlot));
+  slot_size_ = std::max(slot_size, sizeof(FreeSlot));
+  slot_size_ = (slot_size_ + alignment - 1) & ~(alignment - 1);
+  if (slot_size_ > MAX_REGION_SIZE) {
+    throw std::invalid_argument("Arena slot size exceeds the region size.");
+  }
+}
+
+Arena::~Arena() {
+  for (const auto &[region, size] : regions_) { unmap_region(region, size); }
+}
+
+void* Arena::allocate() {
+  if (free_list_ != nullptr) {
+    auto* slot = free_list_;
+    free_list_ = slot->next;
+    live_slots_++;
+    return slot;
+  }
+  if (static_cast<std::size_t>(end_ - cursor_) < slot_size_) { add_region(); }
+  auto* slot = cursor_;
+  cursor_ += slot_size_;
+  live_slots_++;
+  return slot;
+}
+
+void Arena::deallocate(void* slot) noexcept {
+  if (slot == nullptr) { return; }
+  live_slots_--;
+  auto* free_slot = static_cast<FreeSlot*>(slot);
+  free_slot->next = free_list_;
+  free_list_ = free_slot;
+}
+
+void Arena::add_region() {
+  const auto size = next_region_size_;
+  auto* region = map_region(size);
+  regions_.emplace_back(region, size);
+  reserved_bytes_ += size;
+  cursor_ = static_cast<char*>(region);
+  end_ = cursor_ + size;
+  next_region_size_ = std::min(next_region_size_ * 2, MAX_REGION_SIZE);
+}
+
+}  // namespace utils
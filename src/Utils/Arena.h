@@ -0,0 +1,108 @@
+/*
+ * Arena.h
+ *
+ * Fixed-size slot allocator for the population-scale objects (persons and
+ * their immune systems, drugs in blood and parasite populations). Slots are
+ * carved out of large anonymous memory mappings, advised to be backed by
+ * transparent huge pages where the platform supports it, so objects created
+ * together stay close in memory and the TLB covers many more of them. Freed
+ * slots are kept on an intrusive free list and reused before the mapping
+ * grows; memory is only returned to the system when the arena is destroyed.
+ *
+ * Pages are touched for the first time when a slot is handed out, so the
+ * memory is placed on the NUMA node of the thread that creates the objects.
+ * The arena is not thread-safe, like the rest of the model.
+ *
+ * A class opts in with ARENA_ALLOCATED(ClassName) in its declaration, which
+ * routes its operator new/delete to a per-class arena. Derived classes of a
+ * different size (e.g. test mocks) fall back to the global allocator.
+ */
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace utils {
+
+class Arena {
+public:
+  // Disallow copy
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+
+  // Disallow move
+  Arena(Arena &&) = delete;
+  Arena &operator=(Arena &&) = delete;
+
+  Arena(std::size_t slot_size, std::size_t slot_alignment);
+  ~Arena();
+
+  // Size of the first mapping, the following ones double up to the maximum
+  static constexpr std::size_t INITIAL_REGION_SIZE = std::size_t{2} << 20;
+  static constexpr std::size_t MAX_REGION_SIZE = std::size_t{256} << 20;
+
+  void* allocate();
+  void deallocate(void* slot) noexcept;
+
+  [[nodiscard]] std::size_t slot_size() const { return slot_size_; }
+
+  // Number of slots handed out and not yet returned
+  [[nodiscard]] std::size_t live_slots() const { return live_slots_; }
+
+  // Bytes mapped so far
+  [[nodiscard]] std::size_t reserved_bytes() const { return reserved_bytes_; }
+
+private:
+  struct FreeSlot {
+    FreeSlot* next;
+  };
+
+  void add_region();
+
+  std::size_t slot_size_;
+  FreeSlot* free_list_{nullptr};
+  // Untouched part of the newest region
+  char* cursor_{nullptr};
+  char* end_{nullptr};
+  std::vector<std::pair<void*, std::size_t>> regions_;
+  std::size_t next_region_size_{INITIAL_REGION_SIZE};
+  std::size_t live_slots_{0};
+  std::size_t reserved_bytes_{0};
+};
+
+}  // namespace utils
+
+// Allocate the instances of the class from its own arena. The arena lives
+// until the process exits so objects destroyed during static destruction
+// can still be released. Place it first in the class body: it ends with
+// private:, the default access of a class, so the members that follow keep
+// the access they had without it.
+#define ARENA_ALLOCATED(class_name)                                                     \
+public:                                                                                 \
+  static utils::Arena &arena() {                                                        \
+    static auto* instance = new utils::Arena(sizeof(class_name), alignof(class_name));  \
+    return *instance;                                                                   \
+  }                                                                                     \
+  static void* operator new(std::size_t size) {                                         \
+    static_assert(alignof(class_name) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);             \
+    if (size != sizeof(class_name)) { return ::operator new(size); }                    \
+    return arena().allocate();                                                          \
+  }                                                                                     \
+  static void operator delete(void* ptr, std::size_t size) noexcept {                   \
+    if (ptr == nullptr) { return; }                                                     \
+    if (size != sizeof(class_name)) {                                                   \
+      ::operator delete(ptr);                                                           \
+      return;                                                                           \
+    }                                                                                   \
+    arena().deallocate(ptr);                                                            \
+  }                                                                                     \
+  /* Keep placement new usable, e.g. by object pools */                                 \
+  static void* operator new(std::size_t, void* ptr) noexcept { return ptr; }            \
+  static void operator delete(void*, void*) noexcept {}                                 \
+                                                                                        \
+private:
+
+#endif  // ARENA_H
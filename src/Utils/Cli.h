@@ -20,6 +20,13 @@ public:
     bool record_cell_movement{false};
     bool record_district_movement{false};
     bool record_movement{false};
+    bool profile{false};
+    std::string profile_trace_path;
+    bool event_telemetry{false};
+    std::string event_metrics_path;
+    int fan_out{0};
+    int fan_out_day{-1};
+    std::string raster_cache_path;
   };
   struct DxGAppInput {
     std::string input_file{ "input.yml" };
@@ -43,6 +50,8 @@ public:
     int population_size{ 10000 };
     bool is_print_immunity_level{ false };
     bool is_old_format{ false };
+    // Worker processes sharing the genotype x therapy grid, 0 runs it serially
+    int jobs{ 0 };
   };
 
 
@@ -110,6 +119,19 @@ public:
     return cli_input_.record_district_movement;
   }
   [[nodiscard]] bool get_record_movement() const { return cli_input_.record_movement; }
+  [[nodiscard]] bool get_profile() const { return cli_input_.profile; }
+  [[nodiscard]] std::string get_profile_trace_path() const {
+    return cli_input_.profile_trace_path;
+  }
+  [[nodiscard]] bool get_event_telemetry() const { return cli_input_.event_telemetry; }
+  [[nodiscard]] std::string get_event_metrics_path() const {
+    return cli_input_.event_metrics_path;
+  }
+  [[nodiscard]] int get_fan_out() const { return cli_input_.fan_out; }
+  [[nodiscard]] int get_fan_out_day() const { return cli_input_.fan_out_day; }
+  [[nodiscard]] std::string get_raster_cache_path() const {
+    return cli_input_.raster_cache_path;
+  }
   [[nodiscard]] DxGAppInput get_dxg_app_input() {
     return dxg_input_;
   }
@@ -141,6 +163,36 @@ public:
                    "Record the movement between districts.");
 
     app.add_option("--replicate", input.replicate, "Replicate number. Default: 1");
+
+    app.add_flag("--profile", input.profile,
+                 "Report the cumulative time spent in each stage of the daily loop "
+                 "(requires a build with ENABLE_PROFILER).");
+
+    app.add_option("--profile-trace", input.profile_trace_path,
+                   "Write a per-day profiler trace to the given file, as CSV if the name ends "
+                   "with .csv and as Chrome trace JSON otherwise. Implies --profile.");
+
+    app.add_flag("--event-telemetry", input.event_telemetry,
+                 "Count scheduled, executed, cancelled and stale events per event type and log "
+                 "the pending event queue size.");
+
+    app.add_option("--event-metrics", input.event_metrics_path,
+                   "Write the daily event counters to the given CSV file. Implies "
+                   "--event-telemetry.");
+
+    app.add_option("--fan-out", input.fan_out,
+                   "Simulate the burn-in once, then fork this many replicates that continue "
+                   "independently. Replicate i is reseeded from i and reports as job number "
+                   "job * fan-out + i. Default: 0 (single run)")
+        ->check(CLI::NonNegativeNumber);
+
+    app.add_option("--fan-out-day", input.fan_out_day,
+                   "Day of the simulation at which the replicates are forked. Default: the start "
+                   "of the comparison period.");
+
+    app.add_option("--raster-cache", input.raster_cache_path,
+                   "Directory where large ASC rasters are cached in binary after their first "
+                   "parse. Default: no cache.");
   }
 
   static void create_dxg_cli_options(CLI::App &app, DxGAppInput &input) {
@@ -171,6 +223,10 @@ public:
 
       app.add_flag("--pil", input.is_print_immunity_level, "Print immunity level");
       app.add_flag("--old_format", input.is_old_format, "Print output in old format");
+      app.add_option("-j,--jobs", input.jobs,
+                     "Number of worker processes evaluating the genotype x therapy grid, each "
+                     "cell is seeded from its index. Default: 0 (serial)")
+          ->check(CLI::NonNegativeNumber);
   }
 
 
@@ -191,6 +247,10 @@ public:
 
     if (input.record_movement) { spdlog::info("Movement data will be recorded."); }
 
+    if (!input.profile_trace_path.empty()) { input.profile = true; }
+
+    if (!input.event_metrics_path.empty()) { input.event_telemetry = true; }
+
     switch (input.verbosity) {
       case 0: {
         spdlog::set_level(spdlog::level::info);
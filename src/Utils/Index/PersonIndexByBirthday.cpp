@@ -0,0 +1,54 @@
+#include "PersonIndexByBirthday.h"
+
+#include <cassert>
+
+PersonIndexByBirthday::PersonIndexByBirthday() : vPerson_(NUMBER_OF_COHORTS + 1) {}
+
+int PersonIndexByBirthday::cohort_of(const date::year_month_day &ymd) {
+  // Count the days in a leap year so 29 February has a cohort of its own
+  constexpr auto leap_year = date::year{2000};
+  return static_cast<int>((date::sys_days{leap_year / ymd.month() / ymd.day()}
+                           - date::sys_days{leap_year / date::January / 1})
+                              .count());
+}
+
+void PersonIndexByBirthday::add(Person* person) { add(person, NEW_PERSONS); }
+
+void PersonIndexByBirthday::add(Person* person, int cohort) {
+  vPerson_[cohort].push_back(person);
+  person->PersonIndexByBirthdayHandler::set_index(vPerson_[cohort].size() - 1);
+  person->PersonIndexByBirthdayHandler::set_birthday_cohort(cohort);
+}
+
+void PersonIndexByBirthday::remove(Person* person) {
+  auto &cohort = vPerson_[person->PersonIndexByBirthdayHandler::get_birthday_cohort()];
+  const auto index = person->PersonIndexByBirthdayHandler::get_index();
+  assert(index < cohort.size() && cohort[index] == person);
+
+  cohort.back()->PersonIndexByBirthdayHandler::set_index(index);
+  cohort[index] = cohort.back();
+  cohort.pop_back();
+
+  person->PersonIndexByBirthdayHandler::set_index(-1);
+  person->PersonIndexByBirthdayHandler::set_birthday_cohort(-1);
+}
+
+std::size_t PersonIndexByBirthday::size() const {
+  std::size_t result = 0;
+  for (const auto &cohort : vPerson_) { result += cohort.size(); }
+  return result;
+}
+
+void PersonIndexByBirthday::update() {
+  for (auto &cohort : vPerson_) { PersonPtrVector(cohort).swap(cohort); }
+}
+
+void PersonIndexByBirthday::place_new_persons(int today, const date::sys_days &calendar_today) {
+  PersonPtrVector new_persons;
+  new_persons.swap(vPerson_[NEW_PERSONS]);
+  for (auto* person : new_persons) {
+    const date::year_month_day birthday{calendar_today
+                                        + date::days{person->get_birthday() - today}};
+    add(person, cohort_of(birthday));
+  }
+}
@@ -0,0 +1,60 @@
+/*
+ * PersonIndexByBirthday.h
+ *
+ * Group the persons by the day of the year (month and day) of their birthday
+ * so the population can age everyone whose birthday is today in a single pass
+ * instead of each person carrying a BirthdayEvent.
+ *
+ * Persons added to the index are kept aside until the next call to
+ * place_new_persons(), so nobody is aged on the day they enter the population.
+ */
+#ifndef PERSONINDEXBYBIRTHDAY_H
+#define PERSONINDEXBYBIRTHDAY_H
+
+#include <date/date.h>
+
+#include "PersonIndex.h"
+#include "Utils/TypeDef.h"
+
+class PersonIndexByBirthday final : public PersonIndex {
+public:
+  // One cohort per day of a leap year, 29 February is cohort 59
+  static constexpr int NUMBER_OF_COHORTS = 366;
+  // Persons added since the last call to place_new_persons()
+  static constexpr int NEW_PERSONS = NUMBER_OF_COHORTS;
+
+  PersonIndexByBirthday(const PersonIndexByBirthday &) = delete;
+  void operator=(const PersonIndexByBirthday &) = delete;
+
+  PersonIndexByBirthday();
+  ~PersonIndexByBirthday() override = default;
+
+  static int cohort_of(const date::year_month_day &ymd);
+
+  [[nodiscard]] PersonPtrVector &vPerson(int cohort) { return vPerson_[cohort]; }
+
+  void add(Person* person) override;
+
+  void remove(Person* person) override;
+
+  [[nodiscard]] std::size_t size() const override;
+
+  void update() override;
+
+  void notify_change(Person* person, const Person::Property &property, const void* old_value,
+                     const void* new_value) override {}
+
+  // The birthday never changes once a person is in the population
+  static constexpr bool tracks(const Person::Property & /*property*/) { return false; }
+
+  // Move the persons added since the last call into the cohort of their
+  // birthday, today is the current simulation time and its calendar date
+  void place_new_persons(int today, const date::sys_days &calendar_today);
+
+private:
+  void add(Person* person, int cohort);
+
+  std::vector<PersonPtrVector> vPerson_;
+};
+
+#endif  // PERSONINDEXBYBIRTHDAY_H
@@ -0,0 +1,27 @@
+/*
+ * PersonIndexByBirthdayHandler.h
+ *
+ * Position of a person in PersonIndexByBirthday: the birthday cohort and the
+ * index within that cohort.
+ */
+#ifndef PERSONINDEXBYBIRTHDAYHANDLER_H
+#define PERSONINDEXBYBIRTHDAYHANDLER_H
+
+#include "Utils/Index/Indexer.h"
+
+class PersonIndexByBirthdayHandler : public utils::Indexer {
+public:
+  PersonIndexByBirthdayHandler(const PersonIndexByBirthdayHandler &) = delete;
+  void operator=(const PersonIndexByBirthdayHandler &) = delete;
+
+  PersonIndexByBirthdayHandler() = default;
+  ~PersonIndexByBirthdayHandler() override = default;
+
+  [[nodiscard]] int get_birthday_cohort() const { return birthday_cohort_; }
+  void set_birthday_cohort(int value) { birthday_cohort_ = value; }
+
+private:
+  int birthday_cohort_{-1};
+};
+
+#endif  // PERSONINDEXBYBIRTHDAYHANDLER_H
@@ -0,0 +1,56 @@
+#include "PersonIndexByLiverStage.h"
+
+#include <cassert>
+#include <stdexcept>
+
+PersonIndexByLiverStage::PersonIndexByLiverStage() : vPerson_(LIVER_STAGE_DAYS + 1) {}
+
+void PersonIndexByLiverStage::queue(Person* person, int today, int end_time) {
+  if (end_time < today || end_time - today > LIVER_STAGE_DAYS) {
+    throw std::invalid_argument("The liver stage must end within LIVER_STAGE_DAYS of today.");
+  }
+  if (person->PersonIndexByLiverStageHandler::get_liver_stage_end_time() != -1) {
+    throw std::logic_error("The person is already in the liver stage.");
+  }
+  auto &day = vPerson_[end_time % vPerson_.size()];
+  day.push_back(person);
+  person->PersonIndexByLiverStageHandler::set_index(day.size() - 1);
+  person->PersonIndexByLiverStageHandler::set_liver_stage_end_time(end_time);
+}
+
+void PersonIndexByLiverStage::remove(Person* person) {
+  const auto end_time = person->PersonIndexByLiverStageHandler::get_liver_stage_end_time();
+  if (end_time == -1) { return; }
+
+  auto &day = vPerson_[end_time % vPerson_.size()];
+  const auto index = person->PersonIndexByLiverStageHandler::get_index();
+  assert(index < day.size() && day[index] == person);
+
+  day.back()->PersonIndexByLiverStageHandler::set_index(index);
+  day[index] = day.back();
+  day.pop_back();
+
+  person->PersonIndexByLiverStageHandler::set_index(-1);
+  person->PersonIndexByLiverStageHandler::set_liver_stage_end_time(-1);
+}
+
+std::size_t PersonIndexByLiverStage::size() const {
+  std::size_t result = 0;
+  for (const auto &day : vPerson_) { result += day.size(); }
+  return result;
+}
+
+void PersonIndexByLiverStage::update() {
+  for (auto &day : vPerson_) { PersonPtrVector(day).swap(day); }
+}
+
+void PersonIndexByLiverStage::take_due(int today, PersonPtrVector &due) {
+  // The day gets the emptied buffer back so neither side reallocates
+  due.clear();
+  due.swap(vPerson_[today % vPerson_.size()]);
+  for (auto* person : due) {
+    assert(person->PersonIndexByLiverStageHandler::get_liver_stage_end_time() == today);
+    person->PersonIndexByLiverStageHandler::set_index(-1);
+    person->PersonIndexByLiverStageHandler::set_liver_stage_end_time(-1);
+  }
+}
@@ -0,0 +1,55 @@
+/*
+ * PersonIndexByLiverStage.h
+ *
+ * Queue the persons with a parasite in the liver by the day the parasite moves
+ * to the blood, so the population moves all of them in a single pass instead
+ * of each infection carrying its own event.
+ *
+ * The queues form a ring with one slot per day of the liver stage. Persons are
+ * only queued through queue(), removing a person from the population also
+ * drops the pending liver stage.
+ */
+#ifndef PERSONINDEXBYLIVERSTAGE_H
+#define PERSONINDEXBYLIVERSTAGE_H
+
+#include "PersonIndex.h"
+#include "Utils/TypeDef.h"
+
+class PersonIndexByLiverStage final : public PersonIndex {
+public:
+  // Days from the infectious bite to the parasite reaching the blood
+  static constexpr int LIVER_STAGE_DAYS = 7;
+
+  PersonIndexByLiverStage(const PersonIndexByLiverStage &) = delete;
+  void operator=(const PersonIndexByLiverStage &) = delete;
+
+  PersonIndexByLiverStage();
+  ~PersonIndexByLiverStage() override = default;
+
+  // Persons enter the index when they are infected, not when they are added
+  void add(Person* /*person*/) override {}
+
+  void remove(Person* person) override;
+
+  [[nodiscard]] std::size_t size() const override;
+
+  void update() override;
+
+  void notify_change(Person* person, const Person::Property &property, const void* old_value,
+                     const void* new_value) override {}
+
+  static constexpr bool tracks(const Person::Property & /*property*/) { return false; }
+
+  // Queue the person to move the liver parasite to the blood at end_time,
+  // which must be within LIVER_STAGE_DAYS of today so that the slot of the
+  // ring is not shared with another day
+  void queue(Person* person, int today, int end_time);
+
+  // Move the persons queued for today out of the index into due
+  void take_due(int today, PersonPtrVector &due);
+
+private:
+  std::vector<PersonPtrVector> vPerson_;
+};
+
+#endif  // PERSONINDEXBYLIVERSTAGE_H
@@ -0,0 +1,28 @@
+/*
+ * PersonIndexByLiverStageHandler.h
+ *
+ * Position of a person in PersonIndexByLiverStage: the day the liver parasite
+ * moves to the blood and the index within the queue of that day.
+ */
+#ifndef PERSONINDEXBYLIVERSTAGEHANDLER_H
+#define PERSONINDEXBYLIVERSTAGEHANDLER_H
+
+#include "Utils/Index/Indexer.h"
+
+class PersonIndexByLiverStageHandler : public utils::Indexer {
+public:
+  PersonIndexByLiverStageHandler(const PersonIndexByLiverStageHandler &) = delete;
+  void operator=(const PersonIndexByLiverStageHandler &) = delete;
+
+  PersonIndexByLiverStageHandler() = default;
+  ~PersonIndexByLiverStageHandler() override = default;
+
+  // -1 when the person is not queued
+  [[nodiscard]] int get_liver_stage_end_time() const { return liver_stage_end_time_; }
+  void set_liver_stage_end_time(int value) { liver_stage_end_time_ = value; }
+
+private:
+  int liver_stage_end_time_{-1};
+};
+
+#endif  // PERSONINDEXBYLIVERSTAGEHANDLER_H
@@ -5,7 +5,7 @@
 #include "Population/Person/Person.h"
 #include "PersonIndex.h"
 
-class PersonIndexByLocationMovingLevel : public PersonIndex {
+class PersonIndexByLocationMovingLevel final : public PersonIndex {
 public:
   //disable copy and assign
   PersonIndexByLocationMovingLevel(const PersonIndexByLocationMovingLevel &) = delete;
@@ -39,6 +39,11 @@ private:
 
   virtual void notify_change(Person *p, const Person::Property &property, const void *oldValue, const void *newValue);
 
+  // Properties that move a person between the cells of this index
+  static constexpr bool tracks(const Person::Property &property) {
+    return property == Person::LOCATION || property == Person::MOVING_LEVEL;
+  }
+
  private:
   void remove_without_set_index(Person *p);
 
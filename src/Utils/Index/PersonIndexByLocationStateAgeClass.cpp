@@ -78,6 +78,23 @@ PersonIndexByLocationStateAgeClass::notify_change(Person *p, const Person::Prope
 
 }
 
+void PersonIndexByLocationStateAgeClass::swap(const int &location, const int &host_state,
+                                              const int &age_class, const std::size_t &i,
+                                              const std::size_t &j) {
+  if (i == j) return;
+  auto &cell = vPerson_[location][host_state][age_class];
+  std::swap(cell[i], cell[j]);
+  cell[i]->PersonIndexByLocationStateAgeClassHandler::set_index(i);
+  cell[j]->PersonIndexByLocationStateAgeClassHandler::set_index(j);
+}
+
+void PersonIndexByLocationStateAgeClass::remove_last(const int &location, const int &host_state,
+                                                     const int &age_class,
+                                                     const std::size_t &count) {
+  auto &cell = vPerson_[location][host_state][age_class];
+  cell.resize(cell.size() - count);
+}
+
 void PersonIndexByLocationStateAgeClass::change_property(Person *p, const int &location,
                                                          const Person::HostStates &host_state, const int &age_class) {
   //remove from old position
@@ -5,7 +5,7 @@
 #include "Population/Person/Person.h"
 #include "PersonIndex.h"
 
-class PersonIndexByLocationStateAgeClass : public PersonIndex {
+class PersonIndexByLocationStateAgeClass final : public PersonIndex {
 public:
   //disable copy and assign
   PersonIndexByLocationStateAgeClass(const PersonIndexByLocationStateAgeClass &) = delete;
@@ -41,6 +41,20 @@ private:
 
   virtual void notify_change(Person *p, const Person::Property &property, const void *oldValue, const void *newValue);
 
+  // Properties that move a person between the cells of this index
+  static constexpr bool tracks(const Person::Property &property) {
+    return property == Person::LOCATION || property == Person::HOST_STATE
+           || property == Person::AGE_CLASS;
+  }
+
+  // Swap the persons at positions i and j of a cell, keeping their indices in sync
+  void swap(const int &location, const int &host_state, const int &age_class, const std::size_t &i,
+            const std::size_t &j);
+
+  // Drop the last count persons of a cell at once, their indices are not reset
+  void remove_last(const int &location, const int &host_state, const int &age_class,
+                   const std::size_t &count);
+
  private:
   void remove_without_set_index(Person *p);
 
@@ -0,0 +1,65 @@
+/*
+ * PersonIndexRegistry.h
+ *
+ * Hold the person indices of a population as direct members of a tuple, so an
+ * index is found by its type at compile time and every call on it is made on
+ * the concrete (final) class. A property change is only forwarded to the
+ * indices whose static tracks() returns true for that property.
+ */
+#ifndef PERSONINDEXREGISTRY_H
+#define PERSONINDEXREGISTRY_H
+
+#include <tuple>
+#include <type_traits>
+
+#include "Population/Person/Person.h"
+
+template <typename... Indices>
+class PersonIndexRegistry {
+public:
+  PersonIndexRegistry(const PersonIndexRegistry &) = delete;
+  PersonIndexRegistry &operator=(const PersonIndexRegistry &) = delete;
+  PersonIndexRegistry(PersonIndexRegistry &&) = delete;
+  PersonIndexRegistry &operator=(PersonIndexRegistry &&) = delete;
+
+  PersonIndexRegistry() = default;
+  ~PersonIndexRegistry() = default;
+
+  template <typename T>
+  static constexpr bool contains = (std::is_same_v<T, Indices> || ...);
+
+  template <typename T>
+  T &get() {
+    static_assert(contains<T>, "The person index is not part of the registry");
+    return std::get<T>(indices_);
+  }
+
+  template <typename T>
+  const T &get() const {
+    static_assert(contains<T>, "The person index is not part of the registry");
+    return std::get<T>(indices_);
+  }
+
+  void add(Person* person) { (std::get<Indices>(indices_).add(person), ...); }
+
+  void remove(Person* person) { (std::get<Indices>(indices_).remove(person), ...); }
+
+  // Remove the person from every index but Except, which the caller updates itself
+  template <typename Except>
+  void remove_except(Person* person) {
+    ((std::is_same_v<Except, Indices> ? void() : std::get<Indices>(indices_).remove(person)), ...);
+  }
+
+  void notify_change(Person* person, const Person::Property &property, const void* old_value,
+                     const void* new_value) {
+    ((Indices::tracks(property)
+          ? std::get<Indices>(indices_).notify_change(person, property, old_value, new_value)
+          : void()),
+     ...);
+  }
+
+private:
+  std::tuple<Indices...> indices_;
+};
+
+#endif  // PERSONINDEXREGISTRY_H
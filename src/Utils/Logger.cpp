@@ -1,20 +1,33 @@
 #include "Logger.h"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
 
-void Logger::initialize(spdlog::level::level_enum log_level) {
+void Logger::initialize(spdlog::level::level_enum log_level, std::size_t queue_size) {
   try {
-    // Default logger
+    // Default logger, a single worker thread keeps the messages in order
+    spdlog::init_thread_pool(queue_size, 1);
     auto default_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-    auto default_logger = std::make_shared<spdlog::logger>("default_logger", default_sink);
+    auto default_logger = std::make_shared<spdlog::async_logger>(
+        "default_logger", default_sink, spdlog::thread_pool(),
+        spdlog::async_overflow_policy::block);
     spdlog::set_default_logger(default_logger);
     spdlog::set_level(log_level);
     spdlog::set_pattern("[%Y-%m-%d %H:%M:%S] [%l] %v");
+    // The worker flushes the sink right after writing a warning or an error
+    spdlog::flush_on(spdlog::level::warn);
+    // Fatal errors call exit() from deep inside the model, drain the queue there too
+    static std::once_flag shutdown_at_exit;
+    std::call_once(shutdown_at_exit, [] { std::atexit(&Logger::shutdown); });
     spdlog::info("Default logger initialized.");
 
   } catch (const spdlog::spdlog_ex &ex) {
     std::cerr << "Logger initialization failed: " << ex.what() << '\n';
   }
 }
+
+void Logger::shutdown() { spdlog::shutdown(); }
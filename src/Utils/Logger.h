@@ -3,16 +3,29 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstddef>
+
 class Logger {
 public:
+  // Default number of messages the async queue holds before overflowing
+  static constexpr std::size_t DEFAULT_QUEUE_SIZE = 8192;
+
   // Retrieves the singleton instance of Logger
   static Logger &instance() {
     static Logger instance;
     return instance;
   }
 
-  // Initializes the loggers with a specified log level
-  static void initialize(spdlog::level::level_enum log_level = spdlog::level::info);
+  // Initializes the loggers with a specified log level. Messages are formatted
+  // and written by a background thread; when the bounded queue is full the
+  // caller waits for room so no message is lost. The first call registers
+  // shutdown() with atexit so exit() also drains the queue.
+  static void initialize(spdlog::level::level_enum log_level = spdlog::level::info,
+                         std::size_t queue_size = DEFAULT_QUEUE_SIZE);
+
+  // Flush the queued messages and stop the background thread, called before
+  // returning from main and again at exit
+  static void shutdown();
 
   Logger(Logger &&) = delete;
   Logger &operator=(Logger &&) = delete;
@@ -28,4 +41,28 @@ private:
   ~Logger() = default;
 };
 
+// Logging from per-person and per-location loops of the daily loop goes
+// through MALASIM_LOG_HOT, which compiles to nothing in release builds unless
+// ENABLE_HOT_LOGGING is defined. When compiled in, the level is checked before
+// the arguments are evaluated or formatted.
+#if defined(ENABLE_HOT_LOGGING) || !defined(NDEBUG)
+#define MALASIM_LOG_HOT(level, ...)                        \
+  do {                                                     \
+    if (spdlog::should_log(level)) {                       \
+      spdlog::log(level, __VA_ARGS__);                     \
+    }                                                      \
+  } while (false)
+#else
+// The discarded branch keeps the call type-checked without generating code
+#define MALASIM_LOG_HOT(level, ...)                        \
+  do {                                                     \
+    if constexpr (false) {                                 \
+      spdlog::log(level, __VA_ARGS__);                     \
+    }                                                      \
+  } while (false)
+#endif
+
+#define MALASIM_LOG_HOT_TRACE(...) MALASIM_LOG_HOT(spdlog::level::trace, __VA_ARGS__)
+#define MALASIM_LOG_HOT_DEBUG(...) MALASIM_LOG_HOT(spdlog::level::debug, __VA_ARGS__)
+
 #endif  // LOGGER_H
@@ -0,0 +1,115 @@
+#include "Profiler.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+namespace utils {
+
+int Profiler::register_stage(std::string_view name) {
+  auto key = std::string(name);
+  if (auto it = stage_ids_.find(key); it != stage_ids_.end()) { return it->second; }
+
+  const auto id = static_cast<int>(stages_.size());
+  stages_.push_back(Stage{key});
+  stage_ids_.emplace(std::move(key), id);
+  return id;
+}
+
+void Profiler::record(int stage_id, Clock::time_point start, Clock::time_point end) {
+  const auto duration_ns =
+      static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  auto &stage = stages_[stage_id];
+  stage.total_ns += duration_ns;
+  stage.max_ns = std::max(stage.max_ns, duration_ns);
+  stage.calls++;
+
+  if (tracing_) {
+    const auto start_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch_).count());
+    trace_.push_back(TraceEntry{stage_id, current_day_, start_ns, duration_ns});
+  }
+}
+
+void Profiler::set_trace_path(const std::string &path) {
+  trace_path_ = path;
+  tracing_ = !path.empty();
+}
+
+void Profiler::report() const {
+  if (!enabled_ || stages_.empty()) { return; }
+
+  std::vector<int> order(stages_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, [this](int lhs, int rhs) {
+    return stages_[lhs].total_ns > stages_[rhs].total_ns;
+  });
+
+  spdlog::info("Profiler summary (cumulative wall time per stage):");
+  spdlog::info("{:<48} {:>12} {:>10} {:>12} {:>12}", "stage", "total (ms)", "calls", "mean (us)",
+               "max (us)");
+  for (const auto id : order) {
+    const auto &stage = stages_[id];
+    if (stage.calls == 0) { continue; }
+    spdlog::info("{:<48} {:>12.2f} {:>10} {:>12.2f} {:>12.2f}", stage.name,
+                 static_cast<double>(stage.total_ns) / 1e6, stage.calls,
+                 static_cast<double>(stage.total_ns) / 1e3 / static_cast<double>(stage.calls),
+                 static_cast<double>(stage.max_ns) / 1e3);
+  }
+}
+
+void Profiler::write_trace() const {
+  if (!tracing_) { return; }
+
+  std::ofstream out(trace_path_);
+  if (!out.is_open()) {
+    spdlog::error("Profiler: unable to open trace file {}", trace_path_);
+    return;
+  }
+
+  if (trace_path_.ends_with(".csv")) {
+    write_csv_trace(out);
+  } else {
+    write_chrome_trace(out);
+  }
+  spdlog::info("Profiler: wrote {} trace entries to {}", trace_.size(), trace_path_);
+}
+
+void Profiler::write_chrome_trace(std::ostream &out) const {
+  // Complete ("X") events, timestamps and durations are in microseconds
+  out << "{\"traceEvents\":[\n";
+  for (std::size_t i = 0; i < trace_.size(); i++) {
+    const auto &entry = trace_[i];
+    out << fmt::format(
+        R"({{"name":"{}","ph":"X","pid":0,"tid":0,"ts":{:.3f},"dur":{:.3f},"args":{{"day":{}}}}})",
+        stages_[entry.stage_id].name, static_cast<double>(entry.start_ns) / 1e3,
+        static_cast<double>(entry.duration_ns) / 1e3, entry.day);
+    out << (i + 1 < trace_.size() ? ",\n" : "\n");
+  }
+  out << "],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Profiler::write_csv_trace(std::ostream &out) const {
+  out << "day,stage,start_ns,duration_ns\n";
+  for (const auto &entry : trace_) {
+    out << fmt::format("{},{},{},{}\n", entry.day, stages_[entry.stage_id].name, entry.start_ns,
+                       entry.duration_ns);
+  }
+}
+
+void Profiler::reset() {
+  // Stage ids are cached in function-local statics, so keep the registrations
+  for (auto &stage : stages_) {
+    stage.total_ns = 0;
+    stage.max_ns = 0;
+    stage.calls = 0;
+  }
+  trace_.clear();
+  current_day_ = 0;
+  epoch_ = Clock::now();
+}
+
+}  // namespace utils
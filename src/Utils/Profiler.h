@@ -0,0 +1,149 @@
+/*
+ * Profiler.h
+ *
+ * Low-overhead phase profiler for the daily simulation loop. Stages are
+ * registered once by name and timed with a ScopedTimer; the profiler keeps the
+ * cumulative wall time, call count and longest call for every stage and can
+ * optionally keep a per-day trace that is written as a Chrome trace (JSON,
+ * viewable in chrome://tracing or Perfetto) or as CSV.
+ *
+ * Instrumentation points use the MALASIM_PROFILE_SCOPE macros which compile to
+ * nothing unless the build is configured with -DENABLE_PROFILER=ON. When
+ * compiled in, collection is still off until enabled from the command line
+ * (--profile / --profile-trace).
+ */
+#ifndef UTILS_PROFILER_H
+#define UTILS_PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace utils {
+
+class Profiler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Stage {
+    std::string name;
+    uint64_t total_ns{0};
+    uint64_t max_ns{0};
+    uint64_t calls{0};
+  };
+
+  struct TraceEntry {
+    int stage_id;
+    int day;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+  };
+
+  Profiler(const Profiler &) = delete;
+  Profiler &operator=(const Profiler &) = delete;
+  Profiler(Profiler &&) = delete;
+  Profiler &operator=(Profiler &&) = delete;
+
+  static Profiler &get_instance() {
+    static Profiler instance;
+    return instance;
+  }
+
+  // Return the id of the stage with the given name, registering it if needed
+  int register_stage(std::string_view name);
+
+  void record(int stage_id, Clock::time_point start, Clock::time_point end);
+
+  [[nodiscard]] bool is_enabled() const { return enabled_; }
+  void set_enabled(bool value) { enabled_ = value; }
+
+  // Keep a per-call trace; the file extension selects CSV (.csv) or Chrome
+  // trace JSON (anything else)
+  [[nodiscard]] const std::string &get_trace_path() const { return trace_path_; }
+  void set_trace_path(const std::string &path);
+
+  // Simulation day attached to the trace entries recorded from now on
+  void set_current_day(int day) { current_day_ = day; }
+
+  [[nodiscard]] const std::vector<Stage> &get_stages() const { return stages_; }
+  [[nodiscard]] const std::vector<TraceEntry> &get_trace() const { return trace_; }
+
+  // Log the per-stage summary, sorted by cumulative time
+  void report() const;
+
+  // Write the trace to get_trace_path(), if tracing is enabled
+  void write_trace() const;
+
+  // Zero all timings and drop the trace, registered stages are kept
+  void reset();
+
+private:
+  Profiler() : epoch_(Clock::now()) {}
+  ~Profiler() = default;
+
+  void write_chrome_trace(std::ostream &out) const;
+  void write_csv_trace(std::ostream &out) const;
+
+  bool enabled_{false};
+  bool tracing_{false};
+  int current_day_{0};
+  Clock::time_point epoch_;
+  std::string trace_path_;
+  std::vector<Stage> stages_;
+  std::unordered_map<std::string, int> stage_ids_;
+  std::vector<TraceEntry> trace_;
+};
+
+// RAII timer for one stage; does not read the clock when the profiler is off
+class ScopedTimer {
+public:
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+  ScopedTimer(ScopedTimer &&) = delete;
+  ScopedTimer &operator=(ScopedTimer &&) = delete;
+
+  explicit ScopedTimer(int stage_id)
+      : stage_id_(stage_id), active_(Profiler::get_instance().is_enabled()) {
+    if (active_) { start_ = Profiler::Clock::now(); }
+  }
+
+  ~ScopedTimer() {
+    if (active_) { Profiler::get_instance().record(stage_id_, start_, Profiler::Clock::now()); }
+  }
+
+private:
+  int stage_id_;
+  bool active_;
+  Profiler::Clock::time_point start_;
+};
+
+}  // namespace utils
+
+#define MALASIM_PROFILE_CONCAT_INNER(a, b) a##b
+#define MALASIM_PROFILE_CONCAT(a, b) MALASIM_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef ENABLE_PROFILER
+// Time the enclosing scope under a fixed stage name
+#define MALASIM_PROFILE_SCOPE(name)                                               \
+  static const int MALASIM_PROFILE_CONCAT(malasim_profile_id_, __LINE__) =        \
+      utils::Profiler::get_instance().register_stage(name);                       \
+  const utils::ScopedTimer MALASIM_PROFILE_CONCAT(malasim_profile_timer_, __LINE__)( \
+      MALASIM_PROFILE_CONCAT(malasim_profile_id_, __LINE__))
+
+// Time the enclosing scope under a name computed at runtime, the stage is
+// looked up on every call so keep this out of per-person loops
+#define MALASIM_PROFILE_SCOPE_DYNAMIC(name)                                       \
+  const utils::ScopedTimer MALASIM_PROFILE_CONCAT(malasim_profile_timer_, __LINE__)( \
+      utils::Profiler::get_instance().register_stage(name))
+
+#define MALASIM_PROFILE_SET_DAY(day) utils::Profiler::get_instance().set_current_day(day)
+#else
+#define MALASIM_PROFILE_SCOPE(name) ((void)0)
+#define MALASIM_PROFILE_SCOPE_DYNAMIC(name) ((void)0)
+#define MALASIM_PROFILE_SET_DAY(day) ((void)0)
+#endif
+
+#endif  // UTILS_PROFILER_H
@@ -12,6 +12,7 @@ int main(int argc, char** argv) {
     utils::Cli::get_instance().parse(argc, argv);
   } catch (...) {
     spdlog::error("Argument parsing failed. Exiting.");
+    Logger::shutdown();
     return 1;
   }
   if (Model::get_instance()->initialize()) {
@@ -20,6 +21,6 @@ int main(int argc, char** argv) {
   } else {
     spdlog::get("default_logger")->error("Model initialization failed.");
   }
-  spdlog::drop_all();
+  Logger::shutdown();
   return 0;
 }
@@ -0,0 +1,219 @@
+/*
+ * ScenarioGenerator.cpp
+ *
+ * Implement the ScenarioGenerator class.
+ */
+#include "ScenarioGenerator.h"
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+#include "Spatial/GIS/AscFile.h"
+
+namespace {
+// Peak of the population weight at an urban center, relative to rural cells
+constexpr double URBAN_PEAK = 20.0;
+constexpr double CAPITAL_PEAK = 60.0;
+
+// Travel speed used to turn the distance to the district center into minutes
+constexpr double MINUTES_PER_KM = 3.0;
+
+constexpr double NODATA_VALUE = -9999;
+}  // namespace
+
+ScenarioGenerator::ScenarioGenerator(ScenarioSettings settings) : settings_(std::move(settings)) {
+  if (settings_.rows <= 0 || settings_.cols <= 0) {
+    throw std::invalid_argument("The grid must have at least one row and one column.");
+  }
+  if (settings_.number_of_districts <= 0
+      || settings_.number_of_districts > settings_.rows * settings_.cols) {
+    throw std::invalid_argument(fmt::format("Number of districts must be between 1 and {}.",
+                                            settings_.rows * settings_.cols));
+  }
+  if (settings_.number_of_ecozones <= 0 || settings_.number_of_ecozones > settings_.rows) {
+    throw std::invalid_argument(
+        fmt::format("Number of ecozones must be between 1 and {}.", settings_.rows));
+  }
+
+  // Tile the grid with blocks that are as square as the grid allows, the last
+  // district takes the remaining blocks when they do not divide evenly
+  district_rows_ = std::clamp(
+      static_cast<int>(std::lround(std::sqrt(static_cast<double>(settings_.number_of_districts)
+                                             * settings_.rows / settings_.cols))),
+      1, settings_.rows);
+  district_cols_ = std::min(settings_.cols, (settings_.number_of_districts + district_rows_ - 1)
+                                                / district_rows_);
+  while (district_rows_ * district_cols_ < settings_.number_of_districts) { district_rows_++; }
+}
+
+ScenarioGenerator::~ScenarioGenerator() = default;
+
+int ScenarioGenerator::district_of(int row, int col) const {
+  const auto block_row = row * district_rows_ / settings_.rows;
+  const auto block_col = col * district_cols_ / settings_.cols;
+  return std::min(block_row * district_cols_ + block_col, settings_.number_of_districts - 1) + 1;
+}
+
+std::unique_ptr<AscFile> ScenarioGenerator::make_raster() const {
+  auto raster = std::make_unique<AscFile>();
+  raster->nrows = settings_.rows;
+  raster->ncols = settings_.cols;
+  raster->xllcorner = 0;
+  raster->yllcorner = 0;
+  // Rasters are projected in meters
+  raster->cellsize = settings_.cell_size * 1000;
+  raster->nodata_value = NODATA_VALUE;
+  raster->data.assign(settings_.rows, settings_.cols);
+  return raster;
+}
+
+void ScenarioGenerator::generate_rasters() {
+  population_ = make_raster();
+  district_ = make_raster();
+  beta_ = make_raster();
+  travel_ = make_raster();
+  treatment_ = make_raster();
+  ecozone_ = make_raster();
+
+  std::mt19937_64 rng(settings_.seed);
+  std::lognormal_distribution<double> population_noise(0.0, 0.3);
+  std::lognormal_distribution<double> beta_noise(0.0, 0.2);
+  std::normal_distribution<double> treatment_noise(0.0, 0.05);
+  std::uniform_real_distribution<double> travel_noise(0.0, 10.0);
+
+  const auto block_height = static_cast<double>(settings_.rows) / district_rows_;
+  const auto block_width = static_cast<double>(settings_.cols) / district_cols_;
+  const auto sigma = std::max(1.0, 0.15 * std::min(block_height, block_width));
+  const auto zones = settings_.number_of_ecozones;
+
+  std::vector<std::vector<double>> weights(settings_.rows, std::vector<double>(settings_.cols));
+  auto total_weight = 0.0;
+  for (auto row = 0; row < settings_.rows; row++) {
+    for (auto col = 0; col < settings_.cols; col++) {
+      const auto district = district_of(row, col);
+
+      // Distance, in cells, to the center of the block the cell lies in
+      const auto block_row = row * district_rows_ / settings_.rows;
+      const auto block_col = col * district_cols_ / settings_.cols;
+      const auto d_row = row + 0.5 - (block_row + 0.5) * block_height;
+      const auto d_col = col + 0.5 - (block_col + 0.5) * block_width;
+      const auto distance = std::sqrt(d_row * d_row + d_col * d_col);
+      const auto urbanness = std::exp(-distance * distance / (2 * sigma * sigma));
+
+      const auto peak = (district == 1) ? CAPITAL_PEAK : URBAN_PEAK;
+      weights[row][col] = (1.0 + peak * urbanness) * population_noise(rng);
+      total_weight += weights[row][col];
+
+      const auto zone = std::min(zones - 1, row * zones / settings_.rows);
+      // Transmission drops from the first to the last ecozone
+      const auto zone_factor =
+          zones > 1 ? 1.0 + 0.4 * (0.5 - static_cast<double>(zone) / (zones - 1)) : 1.0;
+
+      district_->data[row][col] = static_cast<float>(district);
+      ecozone_->data[row][col] = static_cast<float>(zone);
+      beta_->data[row][col] =
+          static_cast<float>(settings_.mean_beta * zone_factor * beta_noise(rng));
+      travel_->data[row][col] = static_cast<float>(
+          distance * settings_.cell_size * MINUTES_PER_KM + travel_noise(rng));
+      treatment_->data[row][col] = static_cast<float>(std::clamp(
+          settings_.mean_treatment + 0.2 * (urbanness - 0.5) + treatment_noise(rng), 0.05, 0.95));
+    }
+  }
+
+  // Scale the weights to the requested population, every cell is populated
+  const auto total_population =
+      settings_.persons_per_cell * settings_.rows * static_cast<double>(settings_.cols);
+  for (auto row = 0; row < settings_.rows; row++) {
+    for (auto col = 0; col < settings_.cols; col++) {
+      population_->data[row][col] = static_cast<float>(
+          std::max(1.0, std::round(weights[row][col] / total_weight * total_population)));
+    }
+  }
+}
+
+std::string ScenarioGenerator::raster_path(const std::string &name) const {
+  return std::filesystem::absolute(std::filesystem::path(settings_.output_directory)
+                                   / (name + ".asc"))
+      .string();
+}
+
+void ScenarioGenerator::write_input(const std::string &path) const {
+  auto input = YAML::LoadFile(settings_.template_input);
+
+  input["simulation_timeframe"]["starting_date"] = "2000/1/1";
+  input["simulation_timeframe"]["start_of_comparison_period"] = "2000/1/1";
+  input["simulation_timeframe"]["ending_date"] = fmt::format("{}/1/1", 2000 + settings_.years);
+
+  input["spatial_settings"]["mode"] = "grid_based";
+  auto grid = input["spatial_settings"]["grid_based"];
+  grid["population_raster"] = raster_path("population");
+  grid["p_treatment_under_5_raster"] = raster_path("treatment");
+  grid["p_treatment_over_5_raster"] = raster_path("treatment");
+  grid["beta_raster"] = raster_path("beta");
+  grid["ecoclimatic_raster"] = raster_path("ecozone");
+  grid["travel_raster"] = raster_path("travel");
+  grid["cell_size"] = settings_.cell_size;
+
+  auto boundary = YAML::Node(YAML::NodeType::Map);
+  boundary["name"] = "district";
+  boundary["raster"] = raster_path("district");
+  auto boundaries = YAML::Node(YAML::NodeType::Sequence);
+  boundaries.push_back(boundary);
+  grid["administrative_boundaries"] = boundaries;
+
+  // District 1 holds the densest urban center
+  input["movement_settings"]["spatial_model"]["BurkinaFaso"]["capital"] = 1;
+
+  // One seasonal curve per ecozone, with the peak shifting by zone
+  auto seasonality = input["seasonality_settings"];
+  seasonality["mode"] = "equation";
+  auto equation = seasonality["equation"];
+  equation["raster"] = true;
+  auto base = YAML::Node(YAML::NodeType::Sequence);
+  auto a = YAML::Node(YAML::NodeType::Sequence);
+  auto b = YAML::Node(YAML::NodeType::Sequence);
+  auto phi = YAML::Node(YAML::NodeType::Sequence);
+  for (auto zone = 0; zone < settings_.number_of_ecozones; zone++) {
+    base.push_back(0.4);
+    a.push_back(0.6);
+    b.push_back(2.5);
+    phi.push_back(146 + 15 * zone);
+  }
+  equation["base"] = base;
+  equation["a"] = a;
+  equation["b"] = b;
+  equation["phi"] = phi;
+
+  std::ofstream out(path);
+  if (!out.is_open()) { throw std::runtime_error("Unable to write the input file: " + path); }
+  out << input << "\n";
+}
+
+std::string ScenarioGenerator::generate() {
+  std::filesystem::create_directories(settings_.output_directory);
+
+  spdlog::info("Generating a {}x{} grid with {} districts and {} ecozones", settings_.rows,
+               settings_.cols, settings_.number_of_districts, settings_.number_of_ecozones);
+  generate_rasters();
+
+  AscFileManager::write(population_.get(), raster_path("population"));
+  AscFileManager::write(district_.get(), raster_path("district"));
+  AscFileManager::write(beta_.get(), raster_path("beta"));
+  AscFileManager::write(travel_.get(), raster_path("travel"));
+  AscFileManager::write(treatment_.get(), raster_path("treatment"));
+  AscFileManager::write(ecozone_.get(), raster_path("ecozone"));
+
+  auto input_path =
+      (std::filesystem::path(settings_.output_directory) / "input.yml").string();
+  write_input(input_path);
+  spdlog::info("Scenario written to {}", input_path);
+  return input_path;
+}
@@ -0,0 +1,103 @@
+/*
+ * ScenarioGenerator.h
+ *
+ * Generate a synthetic grid-based scenario for scaling studies: an input.yml
+ * derived from a template input together with consistent population, beta,
+ * district, travel, treatment and ecozone ASC rasters.
+ *
+ * The grid is tiled into rectangular districts, each with an urban center at
+ * its middle. Population is concentrated around the centers (the center of
+ * district 1 is the capital and the densest), travel time grows with the
+ * distance to the district center, treatment coverage is higher in urban
+ * cells, and the ecozones are latitude bands that scale the transmission.
+ * All values are drawn from a seeded generator so a scenario can be
+ * regenerated exactly.
+ */
+#ifndef SCENARIOGENERATOR_H
+#define SCENARIOGENERATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+struct AscFile;
+
+struct ScenarioSettings {
+  // Size of the grid, in cells
+  int rows{100};
+  int cols{100};
+
+  // Mean number of persons per cell
+  double persons_per_cell{1000};
+
+  int number_of_districts{10};
+  int number_of_ecozones{2};
+
+  // Size of a cell, in kilometers
+  double cell_size{5};
+
+  // Mean transmission intensity and treatment coverage
+  double mean_beta{0.05};
+  double mean_treatment{0.6};
+
+  // Length of the simulation, starting 2000/1/1
+  int years{10};
+
+  uint64_t seed{42};
+
+  // Input used for every setting that is not generated
+  std::string template_input{"input.yml"};
+  std::string output_directory{"scenario"};
+};
+
+class ScenarioGenerator {
+public:
+  // Disallow copy
+  ScenarioGenerator(const ScenarioGenerator &) = delete;
+  ScenarioGenerator &operator=(const ScenarioGenerator &) = delete;
+
+  // Disallow move
+  ScenarioGenerator(ScenarioGenerator &&) = delete;
+  ScenarioGenerator &operator=(ScenarioGenerator &&) = delete;
+
+  explicit ScenarioGenerator(ScenarioSettings settings);
+  ~ScenarioGenerator();
+
+  // Generate the rasters and write them, with the input file, to the output
+  // directory. Returns the path of the input file.
+  std::string generate();
+
+  [[nodiscard]] const ScenarioSettings &get_settings() const { return settings_; }
+
+  // District (1-based) of the given cell
+  [[nodiscard]] int district_of(int row, int col) const;
+
+  // Generated rasters, empty until generate() is called
+  [[nodiscard]] const AscFile* get_population() const { return population_.get(); }
+  [[nodiscard]] const AscFile* get_district() const { return district_.get(); }
+  [[nodiscard]] const AscFile* get_beta() const { return beta_.get(); }
+  [[nodiscard]] const AscFile* get_travel() const { return travel_.get(); }
+  [[nodiscard]] const AscFile* get_treatment() const { return treatment_.get(); }
+  [[nodiscard]] const AscFile* get_ecozone() const { return ecozone_.get(); }
+
+private:
+  void generate_rasters();
+  void write_input(const std::string &path) const;
+  [[nodiscard]] std::unique_ptr<AscFile> make_raster() const;
+  [[nodiscard]] std::string raster_path(const std::string &name) const;
+
+  ScenarioSettings settings_;
+
+  // Districts are laid out as a grid of district_rows_ x district_cols_ blocks
+  int district_rows_{1};
+  int district_cols_{1};
+
+  std::unique_ptr<AscFile> population_;
+  std::unique_ptr<AscFile> district_;
+  std::unique_ptr<AscFile> beta_;
+  std::unique_ptr<AscFile> travel_;
+  std::unique_ptr<AscFile> treatment_;
+  std::unique_ptr<AscFile> ecozone_;
+};
+
+#endif
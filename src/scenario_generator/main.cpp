@@ -0,0 +1,43 @@
+#include <CLI/CLI.hpp>
+#include <exception>
+
+#include "ScenarioGenerator.h"
+#include "Utils/Logger.h"
+#include "spdlog/spdlog.h"
+
+int main(int argc, char** argv) {
+  Logger::initialize(spdlog::level::info);
+
+  ScenarioSettings settings;
+  CLI::App app{"Generate a synthetic grid-based scenario for scaling studies"};
+  app.add_option("-t,--template", settings.template_input,
+                 "Input file used for every setting that is not generated.")
+      ->check(CLI::ExistingFile);
+  app.add_option("-o,--output", settings.output_directory,
+                 "Directory to write the input file and rasters to. Default: `scenario`.");
+  app.add_option("--rows", settings.rows, "Number of rows in the grid. Default: 100");
+  app.add_option("--cols", settings.cols, "Number of columns in the grid. Default: 100");
+  app.add_option("-d,--density", settings.persons_per_cell,
+                 "Mean number of persons per cell. Default: 1000");
+  app.add_option("--districts", settings.number_of_districts, "Number of districts. Default: 10");
+  app.add_option("--ecozones", settings.number_of_ecozones, "Number of ecozones. Default: 2");
+  app.add_option("--cell-size", settings.cell_size, "Cell size in kilometers. Default: 5");
+  app.add_option("--beta", settings.mean_beta, "Mean transmission intensity. Default: 0.05");
+  app.add_option("--treatment", settings.mean_treatment,
+                 "Mean treatment coverage. Default: 0.6");
+  app.add_option("--years", settings.years, "Number of years to simulate. Default: 10");
+  app.add_option("--seed", settings.seed, "Seed for the generated values. Default: 42");
+
+  CLI11_PARSE(app, argc, argv);
+
+  try {
+    ScenarioGenerator generator(settings);
+    generator.generate();
+  } catch (const std::exception &e) {
+    spdlog::error("Scenario generation failed: {}", e.what());
+    Logger::shutdown();
+    return 1;
+  }
+  Logger::shutdown();
+  return 0;
+}
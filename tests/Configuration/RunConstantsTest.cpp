@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include "Configuration/Config.h"
+#include "Utils/Constants.h"
+
+TEST(RunConstantsTest, SettersRefreshTheRunConstants) {
+  Config config;
+
+  ParasiteParameters::ParasiteDensityLevels density_levels;
+  density_levels.set_log_parasite_density_cured(-4.7);
+  density_levels.set_log_parasite_density_from_liver(-2.0);
+  density_levels.set_log_parasite_density_asymptomatic(3.0);
+  density_levels.set_log_parasite_density_detectable_pfpr(1.69);
+  ParasiteParameters parasite_parameters;
+  parasite_parameters.set_parasite_density_levels(density_levels);
+  config.set_parasite_parameters(parasite_parameters);
+
+  PopulationDemographic demographic;
+  demographic.set_age_structure({5, 100});
+  demographic.set_death_rate_by_age_class({0.0365, 730.0});
+  config.set_population_demographic(demographic);
+
+  const auto &constants = config.get_run_constants();
+  EXPECT_DOUBLE_EQ(constants.log_parasite_density_cured, -4.7);
+  EXPECT_DOUBLE_EQ(constants.log_parasite_density_from_liver, -2.0);
+  EXPECT_DOUBLE_EQ(constants.log_parasite_density_asymptomatic, 3.0);
+  EXPECT_DOUBLE_EQ(constants.log_parasite_density_detectable_pfpr, 1.69);
+
+  // Daily probabilities, capped at 1
+  ASSERT_EQ(constants.daily_death_probability_by_age_class.size(), 2);
+  EXPECT_DOUBLE_EQ(constants.daily_death_probability_by_age_class[0],
+                   0.0365 / Constants::DAYS_IN_YEAR);
+  EXPECT_DOUBLE_EQ(constants.daily_death_probability_by_age_class[1], 1.0);
+}
+
+TEST(RunConstantsTest, MutationProbabilityChangesNeedARefresh) {
+  Config config;
+  config.get_genotype_parameters().set_mutation_probability_per_locus(0.001);
+  config.refresh_run_constants();
+  EXPECT_DOUBLE_EQ(config.get_run_constants().mutation_probability_per_locus, 0.001);
+
+  config.get_genotype_parameters().set_mutation_probability_per_locus(0.0);
+  EXPECT_DOUBLE_EQ(config.get_run_constants().mutation_probability_per_locus, 0.001);
+  config.refresh_run_constants();
+  EXPECT_DOUBLE_EQ(config.get_run_constants().mutation_probability_per_locus, 0.0);
+}
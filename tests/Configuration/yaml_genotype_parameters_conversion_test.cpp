@@ -217,6 +217,70 @@ TEST_F(GenotypeParametersTest, DecodeGenotypeParameters) {
     EXPECT_EQ(decoded_parameters.get_pf_genotype_info().chromosome_infos[13].get_genes()[0].get_aa_positions().size(), 0);
 }
 
+TEST_F(GenotypeParametersTest, DecodeAlleleMarkers) {
+    YAML::Node node = YAML::Load(R"(
+- gene: Pfkelch13
+  position: 580
+  amino_acid: Y
+- name: double_copy_plasmepsin
+  gene: Pfplasmepsin
+  copy_number: 2
+)");
+    auto markers = node.as<std::vector<GenotypeParameters::AlleleMarker>>();
+    ASSERT_EQ(markers.size(), 2);
+    EXPECT_EQ(markers[0].get_position(), 580);
+    EXPECT_EQ(markers[0].get_copy_number(), 0);
+    EXPECT_EQ(markers[0].get_label(), "Pfkelch13:580Y");
+    EXPECT_EQ(markers[1].get_copy_number(), 2);
+    EXPECT_EQ(markers[1].get_label(), "double_copy_plasmepsin");
+
+    // Markers are optional and round trip through encode
+    EXPECT_FALSE(YAML::convert<GenotypeParameters>::encode(genotype_parameters)["allele_markers"]);
+    genotype_parameters.set_allele_markers(markers);
+    auto encoded = YAML::convert<GenotypeParameters>::encode(genotype_parameters);
+    auto decoded = encoded["allele_markers"].as<std::vector<GenotypeParameters::AlleleMarker>>();
+    ASSERT_EQ(decoded.size(), 2);
+    EXPECT_EQ(decoded[0].get_amino_acid(), "Y");
+    EXPECT_EQ(decoded[1].get_gene(), "Pfplasmepsin");
+    EXPECT_EQ(decoded[1].get_copy_number(), 2);
+
+    GenotypeParameters::AlleleMarker marker;
+    EXPECT_THROW(YAML::convert<GenotypeParameters::AlleleMarker>::decode(
+                     YAML::Load("{gene: Pfkelch13, position: 580}"), marker),
+                 std::runtime_error);
+    EXPECT_THROW(YAML::convert<GenotypeParameters::AlleleMarker>::decode(
+                     YAML::Load("{gene: Pfkelch13, position: 580, amino_acid: YY}"), marker),
+                 std::runtime_error);
+}
+
+TEST_F(GenotypeParametersTest, DecodeRejectsAlleleMarkersNotInTheGenotypeInfo) {
+    YAML::Node node = YAML::LoadFile("../../sample_inputs/input.yml")["genotype_parameters"];
+    node["allele_markers"] = YAML::Load(R"(
+- gene: Pfkelch13
+  position: 580
+  amino_acid: Y
+- gene: Pfplasmepsin
+  copy_number: 2
+)");
+    EXPECT_EQ(node.as<GenotypeParameters>().get_allele_markers().size(), 2);
+
+    node["allele_markers"][0]["position"] = 581;
+    EXPECT_THROW(node.as<GenotypeParameters>(), std::runtime_error);
+    node["allele_markers"][0]["position"] = 580;
+    node["allele_markers"][0]["gene"] = "Pfunknown";
+    EXPECT_THROW(node.as<GenotypeParameters>(), std::runtime_error);
+
+    // Pfkelch13 has a single copy
+    node["allele_markers"] = YAML::Load("[{gene: Pfkelch13, copy_number: 2}]");
+    EXPECT_THROW(node.as<GenotypeParameters>(), std::runtime_error);
+
+    node["allele_markers"] = YAML::Node(YAML::NodeType::Sequence);
+    for (auto i = 0; i < 65; i++) {
+        node["allele_markers"].push_back(YAML::Load("{gene: Pfkelch13, position: 580, amino_acid: Y}"));
+    }
+    EXPECT_THROW(node.as<GenotypeParameters>(), std::runtime_error);
+}
+
 // Test for decoding with missing fields
 TEST_F(GenotypeParametersTest, DecodeGenotypeParametersMissingField) {
     // Test case: Missing mutation_probability_per_locus
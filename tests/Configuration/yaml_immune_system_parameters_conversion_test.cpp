@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
+
+#include <cmath>
+
 #include "Configuration/ImmuneSystemParameters.h"
 
 class ImmuneSystemParametersYAMLTest : public ::testing::Test {
@@ -87,3 +90,32 @@ TEST_F(ImmuneSystemParametersYAMLTest, DecodeImmuneSystemParametersMissingField)
     ImmuneSystemParameters decoded_parameters;
     EXPECT_THROW(YAML::convert<ImmuneSystemParameters>::decode(node, decoded_parameters), std::runtime_error);
 }
+
+// The tables over the immune level match the functions they replace
+TEST_F(ImmuneSystemParametersYAMLTest, ProcessConfigBuildsImmuneTables) {
+    // A realistic slope, the curve is steep near zero for slopes below 1
+    immune_parameters.set_immune_effect_on_progression_to_clinical(5.4);
+    immune_parameters.process_config_with_parasite_density(3.0, -2.0);
+
+    ASSERT_EQ(immune_parameters.clinical_probability_by_immune.size(),
+              ImmuneSystemParameters::IMMUNE_TABLE_INTERVALS + 1);
+    ASSERT_EQ(immune_parameters.log10_growth_by_immune.size(),
+              ImmuneSystemParameters::IMMUNE_TABLE_INTERVALS + 1);
+
+    for (const double immune : {0.0, 0.0004, 0.1234, 0.3, 0.5, 0.87654, 1.0}) {
+        const double clinical = 0.9 / (1 + std::pow(immune / 0.3, 5.4));
+        const double growth = std::log10((immune_parameters.c_max * (1 - immune))
+                                         + (immune_parameters.c_min * immune));
+        EXPECT_NEAR(ImmuneSystemParameters::interpolate(
+                        immune_parameters.clinical_probability_by_immune, immune),
+                    clinical, 1e-4);
+        EXPECT_NEAR(ImmuneSystemParameters::interpolate(
+                        immune_parameters.log10_growth_by_immune, immune),
+                    growth, 1e-6);
+    }
+
+    // Out of range immune levels are clamped
+    EXPECT_DOUBLE_EQ(
+        ImmuneSystemParameters::interpolate(immune_parameters.clinical_probability_by_immune, 1.5),
+        immune_parameters.clinical_probability_by_immune.back());
+}
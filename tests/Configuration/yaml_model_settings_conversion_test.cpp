@@ -29,6 +29,8 @@ TEST_F(ModelSettingsTest, EncodeModelSettings) {
   default_settings.get_record_genome_db());
   EXPECT_EQ(node["cell_level_reporting"].as<bool>(),
             default_settings.get_cell_level_reporting());
+  EXPECT_EQ(node["event_sample_capacity"].as<int>(),
+            default_settings.get_event_sample_capacity());
 }
 
 // Test decoding functionality
@@ -46,6 +48,25 @@ TEST_F(ModelSettingsTest, DecodeModelSettings) {
   EXPECT_EQ(decoded_settings.get_initial_seed_number(), 123);
   EXPECT_EQ(decoded_settings.get_record_genome_db(), true);
   EXPECT_EQ(decoded_settings.get_cell_level_reporting(), true);
+  EXPECT_EQ(decoded_settings.get_event_sample_capacity(), 0);
+}
+
+// The event sample capacity is optional but must not be negative
+TEST_F(ModelSettingsTest, DecodeEventSampleCapacity) {
+  YAML::Node node;
+  node["days_between_stdout_output"] = 10;
+  node["initial_seed_number"] = 123;
+  node["record_genome_db"] = true;
+  node["cell_level_reporting"] = true;
+  node["event_sample_capacity"] = 256;
+
+  ModelSettings decoded_settings;
+  EXPECT_NO_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings));
+  EXPECT_EQ(decoded_settings.get_event_sample_capacity(), 256);
+
+  node["event_sample_capacity"] = -1;
+  EXPECT_THROW(YAML::convert<ModelSettings>::decode(node, decoded_settings),
+               std::invalid_argument);
 }
 
 // Test missing fields during decoding
@@ -115,3 +115,17 @@ TEST_F(StrategyParametersTest, DecodeStrategyParametersMissingField) {
     StrategyParameters decoded_parameters;
     EXPECT_THROW(YAML::convert<StrategyParameters>::decode(node, decoded_parameters), std::runtime_error);
 }
+
+// Test the age bracket lookup used to find the probability of being present at MDA
+TEST_F(StrategyParametersTest, MdaAgeBracketOf) {
+    StrategyParameters::MassDrugAdministration mda;
+    EXPECT_EQ(mda.age_bracket_of(25), 0);
+
+    mda.set_age_bracket_prob_individual_present_at_mda({10, 40});
+    EXPECT_EQ(mda.age_bracket_of(0), 0);
+    EXPECT_EQ(mda.age_bracket_of(10), 0);
+    EXPECT_EQ(mda.age_bracket_of(11), 1);
+    EXPECT_EQ(mda.age_bracket_of(40), 1);
+    EXPECT_EQ(mda.age_bracket_of(41), 2);
+    EXPECT_EQ(mda.age_bracket_of(90), 2);
+}
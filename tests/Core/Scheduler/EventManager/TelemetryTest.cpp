@@ -0,0 +1,80 @@
+#include "Core/Scheduler/EventTelemetry.h"
+#include "EventManagerTestCommon.h"
+
+class TelemetryTest : public EventManagerTestBase {
+protected:
+  void SetUp() override {
+    EventManagerTestBase::SetUp();
+    EventTelemetry::get_instance().reset();
+    EventTelemetry::get_instance().set_enabled(true);
+  }
+
+  void TearDown() override {
+    event_manager.clear_all_events();
+    EventTelemetry::get_instance().set_enabled(false);
+    EventTelemetry::get_instance().reset();
+    EventManagerTestBase::TearDown();
+  }
+
+  static const EventTelemetry::Counters &counters_of(const Event* event) {
+    return EventTelemetry::get_instance().get_counters()[event->get_telemetry_type()];
+  }
+};
+
+TEST_F(TelemetryTest, CountsScheduledAndExecutedEvents) {
+  auto event = std::make_unique<NiceMock<MockEvent>>(10);
+  auto* raw_event = event.get();
+  EXPECT_CALL(*event, do_execute()).Times(1);
+
+  event_manager.schedule_event(std::move(event));
+  ASSERT_GE(raw_event->get_telemetry_type(), 0);
+  const auto type_id = raw_event->get_telemetry_type();
+  EXPECT_EQ(counters_of(raw_event).scheduled, 1);
+  EXPECT_EQ(counters_of(raw_event).pending, 1);
+  EXPECT_GT(EventTelemetry::get_instance().get_pending_bytes(), 0);
+
+  event_manager.execute_events(10);
+  const auto &counters = EventTelemetry::get_instance().get_counters()[type_id];
+  EXPECT_EQ(counters.executed, 1);
+  EXPECT_EQ(counters.stale, 0);
+  EXPECT_EQ(counters.pending, 0);
+}
+
+TEST_F(TelemetryTest, CancelledEventsBecomeStaleWhenTheirTimePasses) {
+  auto event = std::make_unique<NiceMock<MockEvent>>(10);
+  auto* raw_event = event.get();
+  EXPECT_CALL(*event, do_execute()).Times(0);
+
+  event_manager.schedule_event(std::move(event));
+  const auto type_id = raw_event->get_telemetry_type();
+  event_manager.cancel_event(raw_event);
+  // Cancelling twice is counted once
+  event_manager.cancel_event(raw_event);
+  EXPECT_EQ(counters_of(raw_event).cancelled, 1);
+  EXPECT_EQ(counters_of(raw_event).pending, 1);
+
+  event_manager.execute_events(10);
+  const auto &counters = EventTelemetry::get_instance().get_counters()[type_id];
+  EXPECT_EQ(counters.executed, 0);
+  EXPECT_EQ(counters.stale, 1);
+  EXPECT_EQ(counters.pending, 0);
+}
+
+TEST_F(TelemetryTest, ClearedEventsAreNoLongerPending) {
+  event_manager.schedule_event(std::make_unique<NiceMock<MockEvent>>(10));
+  event_manager.schedule_event(std::make_unique<NiceMock<MockEvent>>(20));
+  EXPECT_EQ(EventTelemetry::get_instance().get_total_pending(), 2);
+
+  event_manager.clear_all_events();
+  EXPECT_EQ(EventTelemetry::get_instance().get_total_pending(), 0);
+}
+
+TEST_F(TelemetryTest, DisabledTelemetryDoesNotTagEvents) {
+  EventTelemetry::get_instance().set_enabled(false);
+  auto event = std::make_unique<NiceMock<MockEvent>>(10);
+  auto* raw_event = event.get();
+
+  event_manager.schedule_event(std::move(event));
+  EXPECT_EQ(raw_event->get_telemetry_type(), -1);
+  EXPECT_EQ(EventTelemetry::get_instance().get_total_pending(), 0);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "EfficacyEstimator/ParameterSweep.h"
+#include "Utils/Random.h"
+
+namespace {
+// Stands in for a DxGGenerator cell: the shared generator is reseeded from
+// the cell index before the cell draws from it
+double evaluate_cell(utils::Random &random, std::size_t cell) {
+  random.set_seed(1000 + cell);
+  auto sum = 0.0;
+  for (auto i = 0; i < 100; i++) { sum += random.random_flat(0.0, 1.0); }
+  return sum;
+}
+}  // namespace
+
+TEST(ParameterSweepTest, ResultsDoNotDependOnTheNumberOfWorkers) {
+  utils::Random random{nullptr, 42};
+  const auto evaluate = [&random](std::size_t cell) { return evaluate_cell(random, cell); };
+
+  const auto serial = ParameterSweep(0).run(7, evaluate);
+  const auto one_worker = ParameterSweep(1).run(7, evaluate);
+  const auto three_workers = ParameterSweep(3).run(7, evaluate);
+
+  ASSERT_EQ(serial.size(), 7U);
+  EXPECT_EQ(serial, one_worker);
+  EXPECT_EQ(serial, three_workers);
+  EXPECT_NE(serial[0], serial[1]);
+}
+
+TEST(ParameterSweepTest, RejectsANegativeNumberOfWorkers) {
+  EXPECT_THROW(ParameterSweep(-1), std::invalid_argument);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(ParameterSweepTest, FailedPipeStopsTheWorkersForkedSoFar) {
+  // Leave room for the pipes of two workers only: the next free descriptor
+  // and the three after it
+  const auto next_fd = ::dup(0);
+  ASSERT_GE(next_fd, 0);
+  ::close(next_fd);
+  rlimit limit{};
+  ASSERT_EQ(::getrlimit(RLIMIT_NOFILE, &limit), 0);
+  auto lowered = limit;
+  lowered.rlim_cur = static_cast<rlim_t>(next_fd) + 3;
+  ASSERT_EQ(::setrlimit(RLIMIT_NOFILE, &lowered), 0);
+
+  // The workers would otherwise never finish their cells
+  const auto evaluate = [](std::size_t) -> double {
+    ::pause();
+    return 0.0;
+  };
+  EXPECT_THROW(ParameterSweep(4).run(4, evaluate), std::runtime_error);
+  ASSERT_EQ(::setrlimit(RLIMIT_NOFILE, &limit), 0);
+
+  // Every worker was reaped and every read end closed
+  EXPECT_EQ(::waitpid(-1, nullptr, WNOHANG), -1);
+  EXPECT_EQ(errno, ECHILD);
+  const auto fd = ::dup(0);
+  EXPECT_EQ(fd, next_fd);
+  ::close(fd);
+}
+#endif
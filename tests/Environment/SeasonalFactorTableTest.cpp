@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "Configuration/Config.h"
+#include "Configuration/SeasonalitySettings.h"
+#include "Events/Environment/UpdateEcozoneEvent.hxx"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+
+class SeasonalFactorTableTest : public ::testing::Test {
+protected:
+  // Equation with different parameters for each of the two locations
+  static std::unique_ptr<SeasonalEquation> create_equation() {
+    auto equation = std::make_unique<SeasonalEquation>();
+    equation->set_raster(false);
+    equation->set_raster_base({0.1, 0.3});
+    equation->set_raster_A({1.0, 0.5});
+    equation->set_raster_B({2.0, 1.0});
+    equation->set_raster_phi({30, 146});
+    equation->set_base(equation->get_raster_base());
+    equation->set_A(equation->get_raster_A());
+    equation->set_B(equation->get_raster_B());
+    equation->set_phi(equation->get_raster_phi());
+    return equation;
+  }
+};
+
+TEST_F(SeasonalFactorTableTest, DisabledSeasonalityIsOne) {
+  SeasonalitySettings settings;
+  settings.set_enable(false);
+  settings.process_config_using_number_of_locations(nullptr, 3);
+
+  const auto* factors = settings.get_seasonal_factors(date::sys_days{date::year{2024} / 7 / 1});
+  for (auto loc = 0; loc < 3; loc++) { EXPECT_DOUBLE_EQ(factors[loc], 1.0); }
+}
+
+TEST_F(SeasonalFactorTableTest, EquationTableMatchesModel) {
+  SeasonalitySettings settings;
+  settings.set_enable(true);
+  settings.set_mode("equation");
+  settings.set_seasonal_equation(create_equation());
+  settings.process_config_using_number_of_locations(nullptr, 2);
+
+  // Walk over a common and a leap year
+  const auto first_day = date::sys_days{date::year{2023} / 1 / 1};
+  for (auto day = 0; day < 731; day++) {
+    const auto today = first_day + date::days{day};
+    const auto* factors = settings.get_seasonal_factors(today);
+    for (auto loc = 0; loc < 2; loc++) {
+      EXPECT_EQ(factors[loc], settings.get_seasonal_equation()->get_seasonal_factor(today, loc));
+      EXPECT_EQ(settings.get_seasonal_factor(today, loc), factors[loc]);
+    }
+  }
+}
+
+TEST_F(SeasonalFactorTableTest, RainfallTableFollowsDayOfYear) {
+  const auto filename =
+      (std::filesystem::temp_directory_path() / "malasim_seasonal_factor_table.csv").string();
+  std::ofstream out(filename);
+  for (auto day = 0; day < 365; day++) { out << day / 1000.0 << "\n"; }
+  out.close();
+
+  auto rainfall = std::make_unique<SeasonalRainfall>();
+  rainfall->set_filename(filename);
+  rainfall->set_period(365);
+  SeasonalitySettings settings;
+  settings.set_enable(true);
+  settings.set_mode("rainfall");
+  settings.set_seasonal_rainfall(std::move(rainfall));
+  settings.process_config_using_number_of_locations(nullptr, 4);
+  std::filesystem::remove(filename);
+
+  // Day of year 61 is March 2nd in a common year and March 1st in a leap year
+  EXPECT_DOUBLE_EQ(settings.get_seasonal_factors(date::sys_days{date::year{2023} / 3 / 2})[3],
+                   60 / 1000.0);
+  EXPECT_DOUBLE_EQ(settings.get_seasonal_factors(date::sys_days{date::year{2024} / 3 / 1})[3],
+                   60 / 1000.0);
+  // The last day of a leap year reuses the last data point
+  EXPECT_DOUBLE_EQ(settings.get_seasonal_factors(date::sys_days{date::year{2024} / 12 / 31})[0],
+                   364 / 1000.0);
+}
+
+TEST_F(SeasonalFactorTableTest, RainfallWithoutDataIsRejected) {
+  const auto filename =
+      (std::filesystem::temp_directory_path() / "malasim_seasonal_factor_empty.csv").string();
+  std::ofstream out(filename);
+  out << "\n";
+  out.close();
+
+  SeasonalRainfall rainfall;
+  rainfall.set_filename(filename);
+  rainfall.set_period(0);
+  EXPECT_THROW(rainfall.build(), std::invalid_argument);
+  std::filesystem::remove(filename);
+
+  EXPECT_DOUBLE_EQ(rainfall.get_seasonal_factor(date::sys_days{date::year{2024} / 7 / 1}, 0), 1.0);
+}
+
+// Runs against the model, whose seasonality settings are put back afterwards
+class SeasonalFactorTableModelTest : public SeasonalFactorTableTest {
+protected:
+  void SetUp() override {
+    if (Model::get_config() == nullptr) {
+      utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+      ASSERT_TRUE(Model::get_instance()->initialize());
+    }
+    saved_settings_ = std::move(Model::get_config()->get_seasonality_settings());
+  }
+
+  void TearDown() override {
+    Model::get_config()->get_seasonality_settings() = std::move(saved_settings_);
+  }
+
+private:
+  SeasonalitySettings saved_settings_;
+};
+
+TEST_F(SeasonalFactorTableModelTest, UpdateEcozoneEventRebuildsTheTable) {
+  const auto number_of_locations = Model::get_config()->number_of_locations();
+
+  // The first location is in ecozone 0, the others in ecozone 1
+  auto equation = create_equation();
+  equation->set_reference_base(equation->get_raster_base());
+  equation->set_reference_A(equation->get_raster_A());
+  equation->set_reference_B(equation->get_raster_B());
+  equation->set_reference_phi(equation->get_raster_phi());
+  std::vector<double> base(number_of_locations, 0.3);
+  std::vector<double> a(number_of_locations, 0.5);
+  std::vector<double> b(number_of_locations, 1.0);
+  std::vector<int> phi(number_of_locations, 146);
+  base[0] = 0.1;
+  a[0] = 1.0;
+  b[0] = 2.0;
+  phi[0] = 30;
+  equation->set_base(base);
+  equation->set_A(a);
+  equation->set_B(b);
+  equation->set_phi(phi);
+
+  auto &settings = Model::get_config()->get_seasonality_settings();
+  settings.set_enable(true);
+  settings.set_mode("equation");
+  settings.set_seasonal_equation(std::move(equation));
+  settings.build_seasonal_factor_table(number_of_locations);
+
+  const auto today = date::sys_days{date::year{2024} / 4 / 1};
+  const auto before = settings.get_seasonal_factors(today)[0];
+
+  UpdateEcozoneEvent event(0, 1, 0);
+  event.set_executable(true);
+  event.execute();
+
+  // The moved location now follows the ecozone 1 curve, as the others
+  const auto* factors = settings.get_seasonal_factors(today);
+  EXPECT_NE(factors[0], before);
+  EXPECT_DOUBLE_EQ(factors[0], settings.get_seasonal_equation()->get_seasonal_factor(today, 0));
+  if (number_of_locations > 1) { EXPECT_DOUBLE_EQ(factors[0], factors[1]); }
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+
+#include "MDC/CounterArena.h"
+
+namespace {
+enum Group : std::size_t { KEPT = 0, RESET };
+}  // namespace
+
+TEST(CounterArenaTest, CountersIndexLikeNestedVectors) {
+  CounterArena arena;
+  IntCounter2 by_location_age;
+  IntCounter3 by_location_state_age;
+  arena.add(by_location_age, KEPT, {3, 4});
+  arena.add(by_location_state_age, KEPT, {2, 3, 4});
+  arena.allocate();
+
+  EXPECT_EQ(by_location_age.size(), 3U);
+  EXPECT_EQ(by_location_age[0].size(), 4U);
+  EXPECT_EQ(by_location_state_age[1][2].size(), 4U);
+
+  by_location_age[1][2] = 5;
+  by_location_state_age[1][2][3]++;
+  EXPECT_EQ(by_location_age.data()[(1 * 4) + 2], 5);
+  EXPECT_EQ(by_location_state_age.data()[(((1 * 3) + 2) * 4) + 3], 1);
+
+  auto rows = 0;
+  for (const auto &row : by_location_age) {
+    EXPECT_EQ(row.size(), 4U);
+    rows++;
+  }
+  EXPECT_EQ(rows, 3);
+  EXPECT_EQ(std::accumulate(by_location_age[1].begin(), by_location_age[1].end(), 0), 5);
+}
+
+TEST(CounterArenaTest, ResetOnlyZeroesTheGroup) {
+  CounterArena arena;
+  LongCounter kept;
+  DoubleCounter2 reset;
+  IntCounter also_reset;
+  arena.add(kept, KEPT, {5});
+  arena.add(reset, RESET, {2, 3});
+  arena.add(also_reset, RESET, {7});
+  arena.allocate();
+
+  kept[4] = 11;
+  reset[1][2] = 0.5;
+  also_reset[6] = 3;
+  arena.reset(RESET);
+
+  EXPECT_EQ(kept[4], 11U);
+  EXPECT_EQ(reset[1][2], 0.0);
+  EXPECT_EQ(also_reset[6], 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(reset.data()) % CounterArena::GROUP_ALIGNMENT, 0U);
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "MDC/EventTally.h"
+
+TEST(EventTallyTest, CountsEventsByKey) {
+  EventTally<3> tally;
+  EXPECT_TRUE(tally.empty());
+
+  tally.record(10, {1, 2, 3});
+  tally.record(11, {1, 2, 3});
+  tally.record(12, {0, 5, 1});
+
+  EXPECT_EQ(tally.total(), 3U);
+  EXPECT_EQ(tally.counts().size(), 2U);
+  EXPECT_TRUE(tally.samples().empty());
+
+  const auto counts = tally.sorted_counts();
+  ASSERT_EQ(counts.size(), 2U);
+  EXPECT_EQ(counts[0].first, (EventTally<3>::Key{0, 5, 1}));
+  EXPECT_EQ(counts[0].second, 1U);
+  EXPECT_EQ(counts[1].first, (EventTally<3>::Key{1, 2, 3}));
+  EXPECT_EQ(counts[1].second, 2U);
+
+  tally.clear();
+  EXPECT_TRUE(tally.empty());
+  EXPECT_TRUE(tally.counts().empty());
+}
+
+TEST(EventTallyTest, SampleIsBoundedByItsCapacity) {
+  EventTally<1> tally(16);
+  for (auto day = 0; day < 10000; day++) { tally.record(day, {day % 7}); }
+
+  EXPECT_EQ(tally.total(), 10000U);
+  EXPECT_EQ(tally.counts().size(), 7U);
+  ASSERT_EQ(tally.samples().size(), 16U);
+
+  std::set<int> days;
+  for (const auto &sample : tally.samples()) {
+    EXPECT_EQ(sample.key[0], sample.day % 7);
+    days.insert(sample.day);
+  }
+  EXPECT_EQ(days.size(), 16U);
+  // Later events replace earlier ones, the sample is not just the first events
+  EXPECT_GT(*days.rbegin(), 16);
+
+  tally.set_sample_capacity(4);
+  EXPECT_EQ(tally.samples().size(), 4U);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "Configuration/Config.h"
+#include "MDC/ModelDataCollector.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+
+class ModelDataCollectorTrackerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    Model::get_instance()->release();
+    utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  void TearDown() override { Model::get_instance()->release(); }
+};
+
+TEST_F(ModelDataCollectorTrackerTest, SampleCapacityComesFromTheModelSettings) {
+  auto* mdc = Model::get_mdc();
+  EXPECT_EQ(mdc->mutation_tracker.sample_capacity(),
+            Model::get_config()->get_model_settings().get_event_sample_capacity());
+  EXPECT_EQ(mdc->mosquito_recombined_resistant_genotype_tracker.sample_capacity(),
+            Model::get_config()->get_model_settings().get_event_sample_capacity());
+}
+
+TEST_F(ModelDataCollectorTrackerTest, MonthlyUpdateClearsTheTrackers) {
+  // Events of the same month in two different years must not be counted together
+  auto* mdc = Model::get_mdc();
+  mdc->mutation_tracker.set_sample_capacity(4);
+  mdc->mutation_tracker.record(10, {0, 1, 0, 1, 2});
+  mdc->mosquito_recombined_resistant_genotype_tracker.record(10, {0, 1, 1, 2, 3});
+  EXPECT_EQ(mdc->mutation_tracker.samples().size(), 1);
+
+  mdc->monthly_update();
+  EXPECT_TRUE(mdc->mutation_tracker.empty());
+  EXPECT_TRUE(mdc->mutation_tracker.samples().empty());
+  EXPECT_TRUE(mdc->mosquito_recombined_resistant_genotype_tracker.empty());
+
+  mdc->mutation_tracker.record(375, {0, 1, 0, 1, 2});
+  EXPECT_EQ(mdc->mutation_tracker.counts().at({0, 1, 0, 1, 2}), 1);
+}
@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "Configuration/Config.h"
+#include "Utils/Cli.h"
 #include "Utils/Random.h"
 #include "Mosquito/Mosquito.h"
+#include "Parasites/Genotype.h"
 #include "Population/Person/Person.h"
+#include "Simulation/Model.h"
 
 class MosquitoTest : public ::testing::Test {
 protected:
@@ -84,3 +89,37 @@ TEST_F(MosquitoTest, PrmcSampleWhenThereIsNoFOI) {
     all_person_ptr.clear();
   }
 }
+
+TEST_F(MosquitoTest, RandomGenotypesMatchesOneDrawPerBite) {
+  // The genotypes are drawn with the random generator of the model
+  utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+  ASSERT_TRUE(Model::get_instance()->initialize());
+
+  Genotype first("first");
+  first.set_genotype_id(3);
+  Genotype second("second");
+  second.set_genotype_id(5);
+  Mosquito m;
+  // Two tracking days, two locations; the filled slots come first
+  m.genotypes_table = {{{nullptr, nullptr}, {nullptr, nullptr}},
+                       {{nullptr, nullptr}, {&first, &second, nullptr}}};
+
+  Model::get_random()->set_seed(7);
+  std::vector<int> genotype_ids{42};
+  ASSERT_TRUE(m.random_genotypes(1, 1, 50, genotype_ids));
+  ASSERT_EQ(genotype_ids.size(), 50);
+  EXPECT_EQ(std::set<int>(genotype_ids.begin(), genotype_ids.end()), std::set<int>({3, 5}));
+
+  Model::get_random()->set_seed(7);
+  for (const auto genotype_id : genotype_ids) { EXPECT_EQ(m.random_genotype(1, 1), genotype_id); }
+}
+
+TEST_F(MosquitoTest, RandomGenotypesOfAnEmptyTable) {
+  Mosquito m;
+  m.genotypes_table = {{{nullptr, nullptr}}};
+
+  std::vector<int> genotype_ids{42};
+  EXPECT_FALSE(m.random_genotypes(0, 0, 10, genotype_ids));
+  EXPECT_TRUE(genotype_ids.empty());
+  EXPECT_EQ(m.random_genotype(0, 0), -1);
+}
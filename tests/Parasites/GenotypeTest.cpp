@@ -49,4 +49,28 @@ TEST_F(GenotypeTest, MatchPattern) {
     EXPECT_TRUE(g.match_pattern(override_pattern));
 }
 
+TEST_F(GenotypeTest, AlleleMarkerMask) {
+    YAML::Node config = YAML::LoadFile("../../sample_inputs/input.yml");
+    auto genotype_parameters = config["genotype_parameters"].as<GenotypeParameters>();
+    Genotype g(genotype_parameters.get_initial_parasite_info_raw()[0].get_parasite_info()[0]
+                   .get_aa_sequence());
+
+    std::vector<GenotypeParameters::AlleleMarker> markers(4);
+    markers[0].set_gene("Pfmdr1");
+    markers[0].set_position(86);
+    markers[0].set_amino_acid("Y");
+    markers[1].set_gene("Pfkelch13");
+    markers[1].set_position(580);
+    markers[1].set_amino_acid("Y");
+    markers[2].set_gene("Pfplasmepsin");
+    markers[2].set_copy_number(2);
+    markers[3].set_gene("Pfmdr1");
+    markers[3].set_position(184);
+    markers[3].set_amino_acid("F");
+
+    // ||||YF1||TTHFIMG,x||||||FNCMYRIPRPCRA|1 carries 86Y and 184F only
+    g.calculate_allele_marker_mask(genotype_parameters.get_pf_genotype_info(), markers);
+    EXPECT_EQ(g.allele_marker_mask, 0b1001U);
+}
+
 // Additional tests for mutation, recombination, etc. can be added here
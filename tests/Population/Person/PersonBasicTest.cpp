@@ -218,6 +218,38 @@ TEST_F(PersonBasicTest, UpdateTime) {
   EXPECT_EQ(person_->get_latest_update_time(), test_time);
 }
 
+TEST_F(PersonBasicTest, DormantHostSkipsUpdateUntilCaughtUp) {
+  person_->set_age(20);
+  person_->set_latest_update_time(10);
+  mock_scheduler_->set_current_time(15);
+  ASSERT_TRUE(person_->is_dormant());
+
+  // The daily update leaves the host behind
+  EXPECT_CALL(*mock_immune_system_, update()).Times(0);
+  person_->update();
+  EXPECT_EQ(person_->get_latest_update_time(), 10);
+  Mock::VerifyAndClearExpectations(mock_immune_system_);
+
+  // Touching the host settles the whole gap at once
+  EXPECT_CALL(*mock_immune_system_, update()).Times(1);
+  person_->catch_up();
+  person_->catch_up();
+  EXPECT_EQ(person_->get_latest_update_time(), 15);
+}
+
+TEST_F(PersonBasicTest, IncreasingImmunityIsNotDormant) {
+  person_->set_age(20);
+  person_->set_latest_update_time(10);
+  mock_scheduler_->set_current_time(15);
+  person_->get_immune_system()->set_increase(true);
+
+  EXPECT_FALSE(person_->is_dormant());
+  // Never skipped, so there is nothing to catch up
+  EXPECT_CALL(*mock_immune_system_, update()).Times(0);
+  person_->catch_up();
+  EXPECT_EQ(person_->get_latest_update_time(), 10);
+}
+
 TEST_F(PersonBasicTest, RecurrenceStatus) {
   // Test status transitions
   EXPECT_EQ(person_->get_recurrence_status(), Person::RecurrenceStatus::NONE);
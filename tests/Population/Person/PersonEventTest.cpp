@@ -6,6 +6,7 @@
 
 #include "Simulation/Model.h"
 #include "Population/Person/Person.h"
+#include "Population/Population.h"
 #include "Population/ImmuneSystem/ImmuneSystem.h"
 #include "Population/ImmuneSystem/InfantImmuneComponent.h"
 #include "Population/ImmuneSystem/NonInfantImmuneComponent.h"
@@ -16,9 +17,6 @@
 #include "Treatment/Therapies/Drug.h"
 #include "Utils/Cli.h"
 #include "Utils/Constants.h"
-#include "Events/BirthdayEvent.h"
-#include "Events/SwitchImmuneComponentEvent.h"
-#include "Events/MoveParasiteToBloodEvent.h"
 #include "Events/MatureGametocyteEvent.h"
 #include "Events/ProgressToClinicalEvent.h"
 #include "Events/EndClinicalEvent.h"
@@ -97,42 +95,25 @@ protected:
     int location_;
 };
 
-// Test BirthdayEvent
-TEST_F(PersonInternalEventTest, BirthdayEventTest) {
-    // Get initial age
-    uint initial_age = person_->get_age();
-    
-    // Create and schedule a birthday event
-    auto event = std::make_unique<BirthdayEvent>(person_.get());
-    event->set_time(calculate_future_time(0)); // Execute immediately
-    person_->schedule_basic_event(std::move(event));
-    
-    // Execute events at current time
-    person_->update_events(Model::get_scheduler()->current_time());
-    
-    // Verify age increased by 1
-    ASSERT_EQ(person_->get_age(), initial_age + 1);
-}
-
-// Test SwitchImmuneComponentEvent
-TEST_F(PersonInternalEventTest, SwitchImmuneComponentEventTest) {
-    // Set up an infant immune component first
+// Test the switch of the immune component at six months
+TEST_F(PersonInternalEventTest, SwitchImmuneComponentAtSixMonthsTest) {
+    // An infant who turns six months old today
+    person_->set_age(0);
+    person_->set_birthday(Model::get_scheduler()->current_time() - Constants::DAYS_IN_YEAR / 2);
     person_->get_immune_system()->set_immune_component(std::make_unique<InfantImmuneComponent>());
-    
-    // Create and schedule a switch immune component event
-    auto event = std::make_unique<SwitchImmuneComponentEvent>(person_.get());
-    event->set_time(calculate_future_time(0)); // Execute immediately
-    person_->schedule_basic_event(std::move(event));
-    
-    // Execute events at current time
-    person_->update_events(Model::get_scheduler()->current_time());
-    
-    // Verify immune component was switched to NonInfantImmuneComponent
-    ASSERT_NE(person_->get_immune_system()->immune_component(), nullptr);
+    auto* infant = person_.get();
+    Model::get_population()->add_person(std::move(person_));
+
+    // The birthday pass of the population switches the infants of the day
+    Model::get_population()->perform_birthday_event();
+
+    ASSERT_NE(infant->get_immune_system()->immune_component(), nullptr);
+    EXPECT_NE(dynamic_cast<NonInfantImmuneComponent*>(infant->get_immune_system()->immune_component()),
+              nullptr);
 }
 
-// Test MoveParasiteToBloodEvent
-TEST_F(PersonInternalEventTest, MoveParasiteToBloodEventTest) {
+// Test the end of the liver stage
+TEST_F(PersonInternalEventTest, MoveLiverParasiteToBloodTest) {
     // Create a genotype
     auto genotype = std::make_unique<Genotype>("||||YF1||TTHFIMG,x||||||FNCMYRIPRPCRA|1");
     genotype->set_genotype_id(999);
@@ -141,14 +122,9 @@ TEST_F(PersonInternalEventTest, MoveParasiteToBloodEventTest) {
     // Add the genotype to the database
     Model::get_genotype_db()->add(std::move(genotype));
     
-    // Create and schedule a move parasite to blood event
-    auto event = std::make_unique<MoveParasiteToBloodEvent>(person_.get());
-    event->set_time(calculate_future_time(0)); // Execute immediately
-    event->set_infection_genotype(genotype_ptr);
-    person_->schedule_basic_event(std::move(event));
-    
-    // Execute events at current time
-    person_->update_events(Model::get_scheduler()->current_time());
+    // Move the liver parasite to the blood
+    person_->set_liver_parasite_type(genotype_ptr);
+    person_->move_liver_parasite_to_blood();
     
     // Verify parasite was added to blood
     ASSERT_GT(person_->get_all_clonal_parasite_populations()->size(), 0);
@@ -187,11 +163,9 @@ TEST_F(PersonInternalEventTest, ProgressToClinicalEventTest) {
     // Add the genotype to the database
     Model::get_genotype_db()->add(std::move(genotype));
 
-    // Create and schedule a move parasite to blood event
-    auto event_1 = std::make_unique<MoveParasiteToBloodEvent>(person_.get());
-    event_1->set_time(calculate_future_time(0)); // Execute immediately
-    event_1->set_infection_genotype(genotype_ptr);
-    person_->schedule_basic_event(std::move(event_1));
+    // Move a liver parasite to the blood
+    person_->set_liver_parasite_type(genotype_ptr);
+    person_->move_liver_parasite_to_blood();
 
     // Set initial host state
     person_->set_host_state(Person::ASYMPTOMATIC);
@@ -248,11 +222,9 @@ TEST_F(PersonInternalEventTest, ReceiveTherapyEventTest) {
     // Add the genotype to the database
     Model::get_genotype_db()->add(std::move(genotype));
 
-    // Create and schedule a move parasite to blood event
-    auto event_1 = std::make_unique<MoveParasiteToBloodEvent>(person_.get());
-    event_1->set_time(calculate_future_time(0)); // Execute immediately
-    event_1->set_infection_genotype(genotype_ptr);
-    person_->schedule_basic_event(std::move(event_1));
+    // Move a liver parasite to the blood
+    person_->set_liver_parasite_type(genotype_ptr);
+    person_->move_liver_parasite_to_blood();
 
     // Set initial host state
     person_->set_host_state(Person::ASYMPTOMATIC);
@@ -1,9 +1,9 @@
 #include "PersonTestBase.h"
 #include "Population/SingleHostClonalParasitePopulations.h"
 #include "Parasites/Genotype.h"
-#include "Events/MoveParasiteToBloodEvent.h"
 #include "Events/MatureGametocyteEvent.h"
 #include "Events/UpdateWhenDrugIsPresentEvent.h"
+#include "Utils/Index/PersonIndexByLiverStage.h"
 
 class PersonParasiteTest : public PersonTestBase {
 protected:
@@ -44,13 +44,10 @@ TEST_F(PersonParasiteTest, InfectedByWhenLiverParasiteTypeIsNotSet) {
     // check if just liver parasite type is set, using the raw pointer
     EXPECT_EQ(person_->liver_parasite_type(), genotype_raw);
 
-    // a parasite is scheduled to be moved to blood in next 7 days
-    EXPECT_EQ(person_->get_events().size(), 1);
-
-    // cast to MoveParasiteToBloodEvent and check its genotype using the raw pointer
-    auto event = dynamic_cast<MoveParasiteToBloodEvent*>(person_->get_events().begin()->second.get());
-    EXPECT_EQ(event->infection_genotype(), genotype_raw);
-    EXPECT_EQ(event->get_time(), current_time_ + 7);
+    // the liver parasite is queued to move to blood in 7 days, without an event
+    EXPECT_EQ(person_->get_events().size(), 0);
+    EXPECT_EQ(person_->get_liver_stage_end_time(), current_time_ + 7);
+    EXPECT_EQ(mock_population_->person_indexes().get<PersonIndexByLiverStage>().size(), 1);
 }
 
 TEST_F(PersonParasiteTest, InfectedByWhenLiverParasiteTypeIsSet) {
@@ -78,14 +75,10 @@ TEST_F(PersonParasiteTest, InfectedByWhenLiverParasiteTypeIsSet) {
     // new genotype is not set to liver parasite type
     EXPECT_EQ(person_->liver_parasite_type(), genotype_raw);
 
-    // a parasite is scheduled to be moved to blood in next 7 days by the old genotype
-    EXPECT_EQ(person_->get_events().size(), 1);
-
-    // cast to MoveParasiteToBloodEvent
-    auto event = dynamic_cast<MoveParasiteToBloodEvent*>(person_->get_events().begin()->second.get());
-    // infection genotype is the old genotype
-    EXPECT_EQ(event->infection_genotype(), genotype_raw);
-    EXPECT_EQ(event->get_time(), current_time_ + 7);
+    // the liver parasite is queued to move to blood in 7 days, without an event
+    EXPECT_EQ(person_->get_events().size(), 0);
+    EXPECT_EQ(person_->get_liver_stage_end_time(), current_time_ + 7);
+    EXPECT_EQ(mock_population_->person_indexes().get<PersonIndexByLiverStage>().size(), 1);
 }
 
 TEST_F(PersonParasiteTest, HasDetectableParasiteWhenNoParasiteInBlood) {
@@ -212,11 +205,10 @@ TEST_F(PersonParasiteTest, RandomlyChooseParasiteFrom2Infections) {
     EXPECT_EQ(person_->liver_parasite_type(), genotype2_raw);
     EXPECT_EQ(person_->get_today_infections().size(), 0);
 
-    // should have 1 event scheduled
-    EXPECT_EQ(person_->get_events().size(), 1);
-    auto event = dynamic_cast<MoveParasiteToBloodEvent*>(person_->get_events().begin()->second.get());
-    EXPECT_EQ(event->infection_genotype(), genotype2_raw);
-    EXPECT_EQ(event->get_time(), current_time_ + 7);
+    // the liver parasite is queued to move to blood in 7 days, without an event
+    EXPECT_EQ(person_->get_events().size(), 0);
+    EXPECT_EQ(person_->get_liver_stage_end_time(), current_time_ + 7);
+    EXPECT_EQ(mock_population_->person_indexes().get<PersonIndexByLiverStage>().size(), 1);
 }
 
 TEST_F(PersonParasiteTest, RandomlyChooseParasiteFrom1Infection) {
@@ -234,11 +226,10 @@ TEST_F(PersonParasiteTest, RandomlyChooseParasiteFrom1Infection) {
     EXPECT_EQ(person_->liver_parasite_type(), genotype_raw1);
     EXPECT_EQ(person_->get_today_infections().size(), 0);
 
-    // should have 1 event scheduled
-    EXPECT_EQ(person_->get_events().size(), 1);
-    auto event = dynamic_cast<MoveParasiteToBloodEvent*>(person_->get_events().begin()->second.get());
-    EXPECT_EQ(event->infection_genotype(), genotype_raw1);
-    EXPECT_EQ(event->get_time(), current_time_ + 7);
+    // the liver parasite is queued to move to blood in 7 days, without an event
+    EXPECT_EQ(person_->get_events().size(), 0);
+    EXPECT_EQ(person_->get_liver_stage_end_time(), current_time_ + 7);
+    EXPECT_EQ(mock_population_->person_indexes().get<PersonIndexByLiverStage>().size(), 1);
 }
 
 TEST_F(PersonParasiteTest, RandomlyChooseParasiteFrom0Infections) {
@@ -283,27 +274,13 @@ TEST_F(PersonParasiteTest, RandomlyChooseParasiteFrom4Infections) {
     EXPECT_EQ(person_->liver_parasite_type(), genotype_raw3);
     EXPECT_EQ(person_->get_today_infections().size(), 0);
 
-    // should have 1 event scheduled
-    EXPECT_EQ(person_->get_events().size(), 1);
-    auto event = dynamic_cast<MoveParasiteToBloodEvent*>(person_->get_events().begin()->second.get());
-    EXPECT_EQ(event->infection_genotype(), genotype_raw3);
-    EXPECT_EQ(event->get_time(), current_time_ + 7);
+    // the liver parasite is queued to move to blood in 7 days, without an event
+    EXPECT_EQ(person_->get_events().size(), 0);
+    EXPECT_EQ(person_->get_liver_stage_end_time(), current_time_ + 7);
+    EXPECT_EQ(mock_population_->person_indexes().get<PersonIndexByLiverStage>().size(), 1);
 }
 
 
-TEST_F(PersonParasiteTest, ScheduleMoveParasiteToBloodEvent) {
-    auto genotype_ptr = std::make_unique<Genotype>("aaabbbccc");
-    genotype_ptr->set_genotype_id(1);
-    auto genotype_raw = genotype_ptr.get();
-    Model::get_genotype_db()->add(std::move(genotype_ptr));
-    person_->schedule_move_parasite_to_blood(genotype_raw, 5);
-    EXPECT_EQ(person_->get_events().size(), 1);
-
-    auto event = dynamic_cast<MoveParasiteToBloodEvent*>(person_->get_events().begin()->second.get());
-    EXPECT_EQ(event->infection_genotype(), genotype_raw);
-    EXPECT_EQ(event->get_time(), current_time_ + 5);
-}
-
 TEST_F(PersonParasiteTest, ScheduleMatureGametocyteEventOver5) {
     // change age
     EXPECT_CALL(*mock_population_, notify_change(_, Person::Property::AGE, _, _)).Times(1);
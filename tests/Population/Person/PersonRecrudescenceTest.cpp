@@ -17,7 +17,6 @@
 #include "Treatment/Therapies/Drug.h"
 #include "Treatment/Therapies/DrugType.h"
 #include "Core/Scheduler/Scheduler.h"
-#include "Events/MoveParasiteToBloodEvent.h"
 #include "Events/ReceiveTherapyEvent.h"
 #include "Events/ProgressToClinicalEvent.h"
 #include "Utils/Constants.h"
@@ -76,15 +75,12 @@ protected:
              - date::years(person_->get_age() + 1);
     auto simulation_time_birthday = Model::get_scheduler()->get_days_to_ymd(ymd);
     person_->set_birthday(simulation_time_birthday);
-    person_->schedule_birthday_event(days_to_next_birthday);
 
     // Set immune component at 6 months
     if (simulation_time_birthday + Constants::DAYS_IN_YEAR / 2 >= 0) {
         if (person_->get_age() > 0) { spdlog::error("Error in calculating simulation_time_birthday"); }
+        // The population switches the component at six months in perform_birthday_event
         person_->get_immune_system()->set_immune_component(std::make_unique<InfantImmuneComponent>());
-        // schedule for switch
-        person_->schedule_switch_immune_component_event(simulation_time_birthday
-                                                     + (Constants::DAYS_IN_YEAR / 2));
     } else {
         person_->get_immune_system()->set_immune_component(std::make_unique<NonInfantImmuneComponent>());
     }
@@ -142,14 +138,9 @@ TEST_F(PersonRecrudescenceTest, SymptomaticRecrudescenceYoungChild) {
         Model::get_config()->get_parasite_parameters().get_parasite_density_levels().get_log_parasite_density_asymptomatic()
     );
 
-    // Create and schedule a move parasite to blood event
-    auto event = std::make_unique<MoveParasiteToBloodEvent>(person_.get());
-    event->set_time(Model::get_scheduler()->current_time()); // Execute immediately
-    event->set_infection_genotype(genotype_.get());
-    person_->schedule_basic_event(std::move(event));
-
-    // Execute events at current time
-    person_->update_events(Model::get_scheduler()->current_time());
+    // Move a liver parasite to the blood
+    person_->set_liver_parasite_type(genotype_.get());
+    person_->move_liver_parasite_to_blood();
     
     // Execute determine_symptomatic_recrudescence
     person_->determine_symptomatic_recrudescence(clinical_parasite_.get());
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <unordered_map>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Population/ImmuneSystem/ImmuneSystem.h"
+#include "Population/ImmuneSystem/InfantImmuneComponent.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Constants.h"
+#include "Utils/Index/PersonIndexAll.h"
+#include "Utils/Index/PersonIndexByBirthday.h"
+
+class PopulationBirthdayEventTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    Model::get_instance()->release();
+    utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  void TearDown() override { Model::get_instance()->release(); }
+
+  // Move the calendar to the next day without running the rest of the model
+  static void advance_one_day() {
+    auto* scheduler = Model::get_scheduler();
+    const auto time = scheduler->current_time() + 1;
+    const auto tomorrow = scheduler->get_ymd_after_days(1);
+    scheduler->initialize(tomorrow, tomorrow);
+    scheduler->set_current_time(time);
+  }
+
+  static bool is_infant(Person* person) {
+    return dynamic_cast<InfantImmuneComponent*>(person->get_immune_system()->immune_component())
+           != nullptr;
+  }
+};
+
+TEST_F(PopulationBirthdayEventTest, CohortsFollowTheDaysOfALeapYear) {
+  EXPECT_EQ(PersonIndexByBirthday::cohort_of(date::year{2001} / 1 / 1), 0);
+  EXPECT_EQ(PersonIndexByBirthday::cohort_of(date::year{2000} / 2 / 29), 59);
+  EXPECT_EQ(PersonIndexByBirthday::cohort_of(date::year{2001} / 3 / 1), 60);
+  EXPECT_EQ(PersonIndexByBirthday::cohort_of(date::year{2001} / 12 / 31),
+            PersonIndexByBirthday::NUMBER_OF_COHORTS - 1);
+}
+
+TEST_F(PopulationBirthdayEventTest, EveryoneAgesOnceAYearAndInfantsSwitchAtSixMonths) {
+  auto* population = Model::get_population();
+  auto& all_persons = population->get_person_index<PersonIndexAll>()->v_person();
+  ASSERT_FALSE(all_persons.empty());
+
+  std::unordered_map<Person*, uint> ages;
+  auto infants = 0;
+  for (auto& person : all_persons) {
+    ages[person.get()] = person->get_age();
+    if (is_infant(person.get())) { infants++; }
+  }
+  EXPECT_GT(infants, 0);
+
+  // Every day of the year once, the first day only places the new persons
+  for (auto day = 0; day <= Constants::DAYS_IN_YEAR; day++) {
+    population->perform_birthday_event();
+    advance_one_day();
+  }
+
+  for (auto& person : all_persons) {
+    EXPECT_EQ(person->get_age(), ages[person.get()] + 1);
+    EXPECT_FALSE(is_infant(person.get()));
+  }
+  EXPECT_EQ(population->person_indexes().get<PersonIndexByBirthday>().size(), all_persons.size());
+}
+
+TEST_F(PopulationBirthdayEventTest, NewbornsAreNotAgedOnTheirBirthday) {
+  auto* population = Model::get_population();
+  population->give_1_birth(0);
+  auto* newborn = population->get_person_index<PersonIndexAll>()->v_person().back().get();
+  ASSERT_EQ(newborn->get_birthday(), Model::get_scheduler()->current_time());
+
+  population->perform_birthday_event();
+  EXPECT_EQ(newborn->get_age(), 0);
+  EXPECT_TRUE(is_infant(newborn));
+
+  auto& index = population->person_indexes().get<PersonIndexByBirthday>();
+  const auto size = index.size();
+  population->remove_person(newborn);
+  EXPECT_EQ(index.size(), size - 1);
+}
+
+TEST_F(PopulationBirthdayEventTest, PromotedNewbornsMatchIndividualNewborns) {
+  auto* population = Model::get_population();
+  const auto birthday = Model::get_scheduler()->current_time();
+  population->give_1_birth(0);
+  auto* newborn = population->get_person_index<PersonIndexAll>()->v_person().back().get();
+
+  for (auto day = 0; day < 30; day++) {
+    population->perform_birthday_event();
+    advance_one_day();
+  }
+
+  // Born on the same day but kept aggregated until today
+  auto* promoted = population->promote_susceptible(
+      0, SusceptibleCompartment::Member{0, newborn->get_innate_relative_biting_rate(), birthday,
+                                        false});
+  EXPECT_EQ(promoted->get_birthday(), birthday);
+  EXPECT_EQ(promoted->get_age(), 0);
+  EXPECT_EQ(promoted->get_age_class(), 0);
+  EXPECT_TRUE(is_infant(promoted));
+  EXPECT_DOUBLE_EQ(promoted->get_immune_system()->get_current_value(),
+                   newborn->get_immune_system()->get_current_value());
+  EXPECT_GT(promoted->get_immune_system()->get_current_value(), 0.0);
+  EXPECT_LT(promoted->get_immune_system()->get_current_value(), 1.0);
+
+  // Both lose the maternal immunity at six months
+  for (auto day = 30; day <= Constants::DAYS_IN_YEAR / 2; day++) {
+    population->perform_birthday_event();
+    advance_one_day();
+  }
+  EXPECT_FALSE(is_infant(newborn));
+  EXPECT_FALSE(is_infant(promoted));
+  EXPECT_DOUBLE_EQ(promoted->get_immune_system()->get_current_value(),
+                   newborn->get_immune_system()->get_current_value());
+}
+
+TEST_F(PopulationBirthdayEventTest, PromotedPersonsTakeTheirAgeFromTheBirthday) {
+  auto* population = Model::get_population();
+  const auto birthday = Model::get_scheduler()->current_time() - (2 * 365) - 10;
+
+  auto* never_infected = population->promote_susceptible(
+      0, SusceptibleCompartment::Member{0, 1.0, birthday, false});
+  EXPECT_EQ(never_infected->get_age(), 2);
+  EXPECT_EQ(never_infected->get_birthday(), birthday);
+  EXPECT_FALSE(is_infant(never_infected));
+  EXPECT_DOUBLE_EQ(never_infected->get_immune_system()->get_current_value(), 0.0);
+
+  // The initial population carries the immunity of its past exposure
+  auto* initial = population->promote_susceptible(
+      0, SusceptibleCompartment::Member{0, 1.0, birthday, true});
+  EXPECT_EQ(initial->get_age(), 2);
+  EXPECT_FALSE(is_infant(initial));
+  EXPECT_GT(initial->get_immune_system()->get_latest_immune_value(), 0.0);
+}
+
+TEST_F(PopulationBirthdayEventTest, LatePromotedInitialPopulationHasDecayedImmunity) {
+  auto* population = Model::get_population();
+  auto* random = Model::get_random();
+  const auto start = Model::get_scheduler()->current_time();
+  const auto birthday = start - (20 * 365);
+  const auto seed = random->get_seed();
+
+  // Same draw from the immune distribution, promoted on the first day and 100 days later
+  random->set_seed(seed);
+  auto* early = population->promote_susceptible(
+      0, SusceptibleCompartment::Member{0, 1.0, birthday, true});
+  const auto drawn = early->get_immune_system()->get_latest_immune_value();
+
+  Model::get_scheduler()->set_current_time(start + 100);
+  random->set_seed(seed);
+  auto* late = population->promote_susceptible(
+      0, SusceptibleCompartment::Member{0, 1.0, birthday, true});
+  const auto decay_rate =
+      late->get_immune_system()->immune_component()->get_decay_rate(late->get_age());
+  EXPECT_LT(late->get_immune_system()->get_latest_immune_value(), drawn);
+  EXPECT_NEAR(late->get_immune_system()->get_latest_immune_value(),
+              drawn * std::exp(-decay_rate * 100), 1e-12);
+  EXPECT_EQ(late->get_latest_update_time(), start + 100);
+}
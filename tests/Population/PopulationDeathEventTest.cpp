@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include "Configuration/Config.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Constants.h"
+#include "Utils/Index/PersonIndexByLocationStateAgeClass.h"
+
+class PopulationDeathEventTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    Model::get_instance()->release();
+    utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  void TearDown() override { Model::get_instance()->release(); }
+
+  // Expected number of deaths in a day given the current age classes
+  static double expected_deaths() {
+    auto* pi = Model::get_population()->get_person_index<PersonIndexByLocationStateAgeClass>();
+    const auto &death_rates =
+        Model::get_config()->get_population_demographic().get_death_rate_by_age_class();
+    double expected = 0;
+    for (auto &location : pi->vPerson()) {
+      for (auto &state : location) {
+        for (std::size_t ac = 0; ac < state.size(); ac++) {
+          expected += static_cast<double>(state[ac].size()) * death_rates[ac]
+                      / static_cast<double>(Constants::DAYS_IN_YEAR);
+        }
+      }
+    }
+    return expected;
+  }
+};
+
+TEST_F(PopulationDeathEventTest, DeathsLeaveTheIndexConsistent) {
+  auto* population = Model::get_population();
+  auto* pi = population->get_person_index<PersonIndexByLocationStateAgeClass>();
+
+  // A single day has less than one expected death, so accumulate a month
+  const auto before = population->size();
+  double expected = 0;
+  for (auto day = 0; day < 30; day++) {
+    expected += expected_deaths();
+    population->perform_death_event();
+  }
+  const auto deaths = static_cast<double>(before - population->size());
+
+  // Binomial deaths with a generous margin
+  EXPECT_GT(deaths, 0);
+  EXPECT_NEAR(deaths, expected, 6 * std::sqrt(expected) + 1);
+
+  // The dead are gone and everybody else is where their index says
+  for (auto loc = 0; loc < pi->vPerson().size(); loc++) {
+    for (auto hs = 0; hs < pi->vPerson()[loc].size(); hs++) {
+      for (auto ac = 0; ac < pi->vPerson()[loc][hs].size(); ac++) {
+        const auto &cell = pi->vPerson()[loc][hs][ac];
+        if (hs == Person::DEAD) { EXPECT_TRUE(cell.empty()); }
+        for (std::size_t i = 0; i < cell.size(); i++) {
+          ASSERT_EQ(cell[i]->PersonIndexByLocationStateAgeClassHandler::get_index(), i);
+          ASSERT_EQ(cell[i]->get_host_state(), hs);
+        }
+      }
+    }
+  }
+}
@@ -67,13 +67,10 @@ TEST_F(PersonGenerateIndividualTest, InitializePersonLikePopulationGenerateIndiv
     auto simulation_time_birthday = Model::get_scheduler()->get_days_to_ymd(ymd);
     person_->set_birthday(simulation_time_birthday);
     
-    // 6. Schedule birthday event
-    person_->schedule_birthday_event(days_to_next_birthday);
-    
     // 7. Set immune component based on age
     if (simulation_time_birthday + Constants::DAYS_IN_YEAR / 2 >= 0) {
+        // The population switches the component at six months in perform_birthday_event
         person_->get_immune_system()->set_immune_component(std::make_unique<InfantImmuneComponent>());
-        person_->schedule_switch_immune_component_event(simulation_time_birthday + (Constants::DAYS_IN_YEAR / 2));
     } else {
         person_->get_immune_system()->set_immune_component(std::make_unique<NonInfantImmuneComponent>());
     }
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Parasites/Genotype.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Population/SingleHostClonalParasitePopulations.h"
+#include "Simulation/Model.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexAll.h"
+#include "Utils/Index/PersonIndexByLiverStage.h"
+
+class PopulationMoveParasiteToBloodEventTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    Model::get_instance()->release();
+    utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+  }
+
+  void TearDown() override { Model::get_instance()->release(); }
+
+  // Move the calendar to the next day without running the rest of the model
+  static void advance_one_day() {
+    auto* scheduler = Model::get_scheduler();
+    const auto time = scheduler->current_time() + 1;
+    const auto tomorrow = scheduler->get_ymd_after_days(1);
+    scheduler->initialize(tomorrow, tomorrow);
+    scheduler->set_current_time(time);
+  }
+
+  // A person without any parasite, in the liver or in the blood
+  static Person* find_susceptible() {
+    for (auto &person : Model::get_population()->get_person_index<PersonIndexAll>()->v_person()) {
+      if (person->get_host_state() == Person::SUSCEPTIBLE
+          && person->liver_parasite_type() == nullptr) {
+        return person.get();
+      }
+    }
+    return nullptr;
+  }
+};
+
+TEST_F(PopulationMoveParasiteToBloodEventTest, ParasiteReachesTheBloodAfterTheLiverStage) {
+  auto* population = Model::get_population();
+  auto* person = find_susceptible();
+  ASSERT_NE(person, nullptr);
+
+  const auto infection_time = Model::get_scheduler()->current_time();
+  person->infected_by(0);
+  EXPECT_EQ(person->get_host_state(), Person::EXPOSED);
+  EXPECT_EQ(person->get_liver_stage_end_time(),
+            infection_time + PersonIndexByLiverStage::LIVER_STAGE_DAYS);
+  EXPECT_EQ(population->person_indexes().get<PersonIndexByLiverStage>().size(), 1);
+
+  for (auto day = 0; day < PersonIndexByLiverStage::LIVER_STAGE_DAYS; day++) {
+    population->perform_move_parasite_to_blood_event();
+    EXPECT_NE(person->liver_parasite_type(), nullptr);
+    advance_one_day();
+  }
+
+  population->perform_move_parasite_to_blood_event();
+  EXPECT_EQ(person->liver_parasite_type(), nullptr);
+  EXPECT_EQ(person->get_all_clonal_parasite_populations()->size(), 1);
+  EXPECT_NE(person->get_host_state(), Person::EXPOSED);
+  EXPECT_EQ(person->get_liver_stage_end_time(), -1);
+  EXPECT_EQ(population->person_indexes().get<PersonIndexByLiverStage>().size(), 0);
+}
+
+TEST_F(PopulationMoveParasiteToBloodEventTest, RemovedPersonsLeaveTheLiverStageQueue) {
+  auto* population = Model::get_population();
+  auto* removed = find_susceptible();
+  ASSERT_NE(removed, nullptr);
+  removed->infected_by(0);
+  auto* kept = find_susceptible();
+  ASSERT_NE(kept, nullptr);
+  kept->infected_by(0);
+
+  auto &index = population->person_indexes().get<PersonIndexByLiverStage>();
+  EXPECT_EQ(index.size(), 2);
+  population->remove_person(removed);
+  EXPECT_EQ(index.size(), 1);
+
+  for (auto day = 0; day <= PersonIndexByLiverStage::LIVER_STAGE_DAYS; day++) {
+    population->perform_move_parasite_to_blood_event();
+    advance_one_day();
+  }
+  EXPECT_EQ(kept->liver_parasite_type(), nullptr);
+  EXPECT_EQ(kept->get_all_clonal_parasite_populations()->size(), 1);
+  EXPECT_EQ(index.size(), 0);
+}
+
+TEST_F(PopulationMoveParasiteToBloodEventTest, RemovedPersonsLeaveTheQueueBeforeTheIndices) {
+  // The indices of this population are never initialized
+  Population population;
+  population.set_popsize_by_location(IntVector(Model::get_config()->number_of_locations(), 0));
+  auto owned = std::make_unique<Person>();
+  owned->initialize();
+  owned->set_location(0);
+  owned->set_host_state(Person::SUSCEPTIBLE);
+  auto* person = owned.get();
+  population.add_person(std::move(owned));
+
+  person->infected_by(0);
+  auto &index = population.person_indexes().get<PersonIndexByLiverStage>();
+  EXPECT_EQ(index.size(), 1);
+  population.remove_person(person);
+  EXPECT_EQ(index.size(), 0);
+}
+
+TEST_F(PopulationMoveParasiteToBloodEventTest, QueueRejectsEndTimesOutsideTheRing) {
+  auto &index = Model::get_population()->person_indexes().get<PersonIndexByLiverStage>();
+  auto* person = find_susceptible();
+  ASSERT_NE(person, nullptr);
+  const auto today = Model::get_scheduler()->current_time();
+
+  EXPECT_THROW(index.queue(person, today, today + PersonIndexByLiverStage::LIVER_STAGE_DAYS + 1),
+               std::invalid_argument);
+  EXPECT_THROW(index.queue(person, today, today - 1), std::invalid_argument);
+  EXPECT_EQ(index.size(), 0);
+
+  index.queue(person, today, today + PersonIndexByLiverStage::LIVER_STAGE_DAYS);
+  EXPECT_THROW(index.queue(person, today, today + 1), std::logic_error);
+  EXPECT_EQ(index.size(), 1);
+}
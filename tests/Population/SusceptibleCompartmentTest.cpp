@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "Population/SusceptibleCompartment.h"
+#include "Utils/Random.h"
+
+class SusceptibleCompartmentTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    // Two locations, age classes [0, 5), [5, 15) and 15+, rates in [1, 11]
+    compartment_ = std::make_unique<SusceptibleCompartment>(2, std::vector<int>{5, 15, 100}, 10,
+                                                            1.0, 11.0);
+  }
+
+  utils::Random random_{nullptr, 42};
+  std::unique_ptr<SusceptibleCompartment> compartment_;
+};
+
+TEST_F(SusceptibleCompartmentTest, AgeClassFollowsAgeStructure) {
+  EXPECT_EQ(compartment_->age_class_of(0), 0);
+  EXPECT_EQ(compartment_->age_class_of(4), 0);
+  EXPECT_EQ(compartment_->age_class_of(5), 1);
+  EXPECT_EQ(compartment_->age_class_of(15), 2);
+  EXPECT_EQ(compartment_->age_class_of(120), 2);
+}
+
+TEST_F(SusceptibleCompartmentTest, BucketsClampToRange) {
+  EXPECT_EQ(compartment_->bucket_of(0.5), 0);
+  EXPECT_EQ(compartment_->bucket_of(1.5), 0);
+  EXPECT_EQ(compartment_->bucket_of(2.5), 1);
+  EXPECT_EQ(compartment_->bucket_of(11.0), 9);
+  EXPECT_EQ(compartment_->bucket_of(20.0), 9);
+}
+
+TEST_F(SusceptibleCompartmentTest, AddAndRemoveKeepCountsAndWeight) {
+  compartment_->add(0, 0, -10, 2.0);
+  compartment_->add(0, 0, -10, 2.4);
+  compartment_->add(0, 2, -8000, 8.0);
+  compartment_->add(1, 1, -3000, 3.0);
+
+  EXPECT_EQ(compartment_->size(), 4);
+  EXPECT_EQ(compartment_->size(0), 3);
+  EXPECT_EQ(compartment_->size(0, 0), 2);
+  EXPECT_DOUBLE_EQ(compartment_->biting_weight(0), 12.4);
+
+  // Persons in the same cell leave with the mean rate of the cell
+  const auto member = compartment_->remove_uniform(0, 0, &random_);
+  EXPECT_EQ(member.age_class, 0);
+  EXPECT_EQ(member.birthday, -10);
+  EXPECT_FALSE(member.initial_population);
+  EXPECT_DOUBLE_EQ(member.relative_biting_rate, 2.2);
+  EXPECT_DOUBLE_EQ(compartment_->biting_weight(0), 10.2);
+
+  compartment_->remove_uniform(0, 0, &random_);
+  EXPECT_EQ(compartment_->size(0, 0), 0);
+  EXPECT_DOUBLE_EQ(compartment_->biting_weight(0), 8.0);
+  EXPECT_THROW(compartment_->remove_uniform(0, 0, &random_), std::logic_error);
+}
+
+TEST_F(SusceptibleCompartmentTest, RemoveByBitingFollowsWeight) {
+  for (auto i = 0; i < 1000; i++) {
+    compartment_->add(0, 0, -i, 1.0);
+    compartment_->add(0, 2, -6000 - i, 9.0);
+  }
+
+  auto adults = 0;
+  for (auto i = 0; i < 500; i++) {
+    const auto member = compartment_->remove_by_biting(0, &random_);
+    if (member.age_class == 2) { adults++; }
+  }
+  // Adults hold 90% of the biting weight
+  EXPECT_NEAR(adults / 500.0, 0.9, 0.05);
+  EXPECT_EQ(compartment_->size(0), 1500);
+}
+
+TEST_F(SusceptibleCompartmentTest, MembersKeepTheirCohort) {
+  compartment_->add(0, 1, -3000, 2.0, true);
+  compartment_->add(0, 1, -2000, 2.0);
+  compartment_->add(0, 1, -3000, 2.0);
+
+  auto initial = 0;
+  auto born = 0;
+  for (auto i = 0; i < 3; i++) {
+    const auto member = compartment_->remove_uniform(0, 1, &random_);
+    if (member.initial_population) {
+      EXPECT_EQ(member.birthday, -3000);
+      initial++;
+    } else {
+      EXPECT_TRUE(member.birthday == -3000 || member.birthday == -2000);
+      born++;
+    }
+  }
+  EXPECT_EQ(initial, 1);
+  EXPECT_EQ(born, 2);
+}
+
+TEST_F(SusceptibleCompartmentTest, CohortLeavesTheAgeClassOnItsBirthday) {
+  compartment_->add(0, 0, -1000, 2.0);
+  compartment_->add(0, 0, -1001, 4.0);
+
+  // Those born on or before the cutoff are at least 5 years old
+  compartment_->perform_ageing(0, {-1002, -5000});
+  EXPECT_EQ(compartment_->size(0, 0), 2);
+
+  compartment_->perform_ageing(0, {-1001, -5000});
+  EXPECT_EQ(compartment_->size(0, 0), 1);
+  EXPECT_EQ(compartment_->size(0, 1), 1);
+  EXPECT_DOUBLE_EQ(compartment_->biting_weight(0), 6.0);
+
+  const auto member = compartment_->remove_uniform(0, 1, &random_);
+  EXPECT_EQ(member.birthday, -1001);
+  EXPECT_DOUBLE_EQ(member.relative_biting_rate, 4.0);
+}
+
+TEST_F(SusceptibleCompartmentTest, DeathsAndAgeingConservePersons) {
+  // Four persons born on each day of the 5 years of the first age class
+  constexpr auto days_in_age_class = 5 * 365;
+  for (auto i = 0; i < 4 * days_in_age_class; i++) {
+    compartment_->add(1, 0, -(i % days_in_age_class), 2.0);
+  }
+
+  for (auto day = 1; day <= 365; day++) {
+    compartment_->perform_ageing(1, {day - days_in_age_class, day - (15 * 365)});
+  }
+  EXPECT_EQ(compartment_->size(1), 4 * days_in_age_class);
+  // The persons born in the first year of the age class move up in a year
+  EXPECT_EQ(compartment_->size(1, 1), 4 * 365);
+  EXPECT_EQ(compartment_->size(1, 0), 4 * (days_in_age_class - 365));
+  EXPECT_EQ(compartment_->size(0), 0);
+
+  const auto before = compartment_->size(1, 0);
+  const auto deaths = compartment_->perform_death_event(1, {0.1, 0.0, 0.0}, &random_);
+  EXPECT_NEAR(deaths, 584, 80);
+  EXPECT_EQ(compartment_->size(1, 0), before - deaths);
+  EXPECT_EQ(compartment_->size(1), 4 * days_in_age_class - deaths);
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "Parasites/Genotype.h"
+#include "Population/Person/Person.h"
+#include "Population/Population.h"
+#include "Reporters/AlleleMarkerReporter.h"
+#include "Simulation/Model.h"
+#include "Spatial/GIS/AdminLevelManager.h"
+#include "Spatial/GIS/SpatialData.h"
+#include "Utils/Cli.h"
+#include "Utils/Index/PersonIndexAll.h"
+
+class AlleleMarkerReporterTest : public ::testing::Test {
+protected:
+  using Counts = AlleleMarkerReporter::MarkerCounts;
+  static constexpr std::size_t MARKERS = 2;
+
+  void SetUp() override {
+    utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+    ASSERT_GE(Model::get_config()->number_of_locations(), 2);
+
+    std::vector<GenotypeParameters::AlleleMarker> markers(MARKERS);
+    markers[0].set_name("580Y");
+    markers[0].set_gene("Pfkelch13");
+    markers[0].set_position(580);
+    markers[0].set_amino_acid("Y");
+    markers[1].set_name("2x");
+    markers[1].set_gene("Pfplasmepsin");
+    markers[1].set_copy_number(2);
+    Model::get_config()->get_genotype_parameters().set_allele_markers(markers);
+
+    output_ = std::filesystem::temp_directory_path() / "malasim_allele_marker_reporter_test";
+    std::filesystem::create_directories(output_);
+  }
+
+  void TearDown() override {
+    spdlog::drop("allele_marker_reporter");
+    std::filesystem::remove_all(output_);
+    Model::get_config()->get_genotype_parameters().set_allele_markers({});
+  }
+
+  // Genotype carrying the markers of the mask
+  static Genotype* make_genotype(std::uint64_t mask) {
+    auto* db = Model::get_genotype_db();
+    auto genotype = std::make_unique<Genotype>("allele_marker_test_" + std::to_string(mask));
+    genotype->set_genotype_id(static_cast<int>(db->size()));
+    genotype->allele_marker_mask = mask;
+    auto* result = genotype.get();
+    db->add(std::move(genotype));
+    return result;
+  }
+
+  // Infect an uninfected person of the location with one clone of each genotype
+  static void infect(int location, const std::vector<Genotype*> &genotypes) {
+    for (auto &person : Model::get_population()->get_person_index<PersonIndexAll>()->v_person()) {
+      if (person->get_location() != location || person->get_host_state() != Person::SUSCEPTIBLE
+          || !person->get_all_clonal_parasite_populations()->empty()) {
+        continue;
+      }
+      for (auto* genotype : genotypes) { person->add_new_parasite_to_blood(genotype); }
+      person->set_host_state(Person::ASYMPTOMATIC);
+      return;
+    }
+    FAIL() << "No uninfected person at location " << location;
+  }
+
+  // Location 0: one person with a 580Y clone and a 580Y + 2x clone
+  // Location 1: one person with a single 2x clone
+  static void infect_test_persons() {
+    infect(0, {make_genotype(0b01), make_genotype(0b11)});
+    infect(1, {make_genotype(0b10)});
+  }
+
+  static double value(const std::vector<double> &values, std::size_t unit, std::size_t marker) {
+    return values[(unit * MARKERS) + marker];
+  }
+
+  std::filesystem::path output_;
+};
+
+TEST_F(AlleleMarkerReporterTest, CountsWeightedAndUnweightedFrequencies) {
+  Counts before;
+  AlleleMarkerReporter::count_by_location(before, MARKERS);
+  infect_test_persons();
+  Counts after;
+  AlleleMarkerReporter::count_by_location(after, MARKERS);
+
+  EXPECT_EQ(after.infected[0] - before.infected[0], 1);
+  EXPECT_EQ(after.clones[0] - before.clones[0], 2);
+  EXPECT_EQ(after.infected[1] - before.infected[1], 1);
+  EXPECT_EQ(after.clones[1] - before.clones[1], 1);
+
+  // Weighted: each clone counts for 1 / number of clones of its host
+  EXPECT_DOUBLE_EQ(value(after.weighted, 0, 0) - value(before.weighted, 0, 0), 1.0);
+  EXPECT_DOUBLE_EQ(value(after.weighted, 0, 1) - value(before.weighted, 0, 1), 0.5);
+  EXPECT_DOUBLE_EQ(value(after.weighted, 1, 0) - value(before.weighted, 1, 0), 0.0);
+  EXPECT_DOUBLE_EQ(value(after.weighted, 1, 1) - value(before.weighted, 1, 1), 1.0);
+
+  // Unweighted: every clone counts for 1
+  EXPECT_DOUBLE_EQ(value(after.unweighted, 0, 0) - value(before.unweighted, 0, 0), 2.0);
+  EXPECT_DOUBLE_EQ(value(after.unweighted, 0, 1) - value(before.unweighted, 0, 1), 1.0);
+  EXPECT_DOUBLE_EQ(value(after.unweighted, 1, 0) - value(before.unweighted, 1, 0), 0.0);
+  EXPECT_DOUBLE_EQ(value(after.unweighted, 1, 1) - value(before.unweighted, 1, 1), 1.0);
+}
+
+TEST_F(AlleleMarkerReporterTest, MonthlyReportSumsTheLocationsOfEachAdminUnit) {
+  AlleleMarkerReporter reporter;
+  reporter.initialize(0, output_.string() + "/");
+  infect_test_persons();
+  reporter.monthly_report();
+  spdlog::get("allele_marker_reporter")->flush();
+
+  // (level, unit, marker) -> infected, clones, weighted, unweighted
+  std::map<std::tuple<std::string, int, std::string>, std::vector<double>> rows;
+  std::ifstream file(output_ / "allele_marker_frequency_0.tsv");
+  std::string line;
+  std::getline(file, line);
+  EXPECT_EQ(line, "dayselapsed\tlevel\tunit\tmarker\tinfected\tclones\tweighted\tunweighted");
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    int day = 0;
+    std::string level;
+    int unit = 0;
+    std::string marker;
+    std::vector<double> values(4);
+    fields >> day >> level >> unit >> marker >> values[0] >> values[1] >> values[2] >> values[3];
+    rows[{level, unit, marker}] = values;
+  }
+
+  Counts cells;
+  AlleleMarkerReporter::count_by_location(cells, MARKERS);
+  const std::vector<std::string> labels{"580Y", "2x"};
+  const auto expect_row = [&rows, &labels](const std::string &level, int unit,
+                                           const Counts &counts, std::size_t index) {
+    for (std::size_t marker = 0; marker < MARKERS; marker++) {
+      const auto row = rows.find({level, unit, labels[marker]});
+      ASSERT_NE(row, rows.end()) << level << " " << unit << " " << labels[marker];
+      const std::vector<double> expected{
+          counts.infected[index], counts.clones[index],
+          value(counts.weighted, index, marker) / counts.infected[index],
+          value(counts.unweighted, index, marker) / counts.clones[index]};
+      for (std::size_t i = 0; i < expected.size(); i++) {
+        // The report is written with six significant digits
+        EXPECT_NEAR(row->second[i], expected[i], 1e-5 * std::abs(expected[i]));
+      }
+    }
+  };
+  expect_row("cell", 0, cells, 0);
+  expect_row("cell", 1, cells, 1);
+  EXPECT_GT(rows.at({"cell", 0, "580Y"})[2], 0.0);
+
+  auto* admin_manager = Model::get_spatial_data()->get_admin_level_manager();
+  ASSERT_NE(admin_manager, nullptr);
+  ASSERT_FALSE(admin_manager->get_level_names().empty());
+  for (const auto &level : admin_manager->get_level_names()) {
+    const auto* boundary = admin_manager->get_boundary(level);
+    Counts units;
+    units.resize(boundary->max_unit_id + 1, MARKERS);
+    for (int unit = 0; unit <= boundary->max_unit_id; unit++) {
+      for (const auto loc : boundary->unit_to_locations[unit]) {
+        units.add(unit, cells, loc, MARKERS);
+      }
+      if (units.infected[unit] > 0) { expect_row(level, unit, units, unit); }
+    }
+  }
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "Configuration/Config.h"
+#include "Core/Scheduler/Scheduler.h"
+#include "Population/Population.h"
+#include "Reporters/Specialist/MovementReporter.h"
+#include "Simulation/Model.h"
+#include "Spatial/GIS/SpatialData.h"
+#include "Utils/Cli.h"
+#include "Utils/Helpers/SQLiteDatabase.h"
+
+class MovementReporterTest : public ::testing::Test {
+protected:
+  using Row = std::tuple<int, int, int, int>;
+
+  void SetUp() override {
+    utils::Cli::get_instance().set_input_path("../../sample_inputs/input.yml");
+    ASSERT_TRUE(Model::get_instance()->initialize());
+    ASSERT_GE(Model::get_config()->number_of_locations(), 2);
+
+    output_ = std::filesystem::temp_directory_path() / "malasim_movement_reporter_test";
+    std::filesystem::create_directories(output_);
+    reporter_ = std::make_unique<MovementReporter>();
+    reporter_->initialize(0, output_.string() + "/");
+  }
+
+  void TearDown() override {
+    reporter_.reset();
+    std::filesystem::remove_all(output_);
+  }
+
+  // Rows of the table ordered by day, source and destination
+  [[nodiscard]] std::vector<Row> read(const std::string &query) const {
+    sqlite3* db = nullptr;
+    std::vector<Row> rows;
+    if (sqlite3_open_v2((output_ / "movement_0.db").string().c_str(), &db, SQLITE_OPEN_READONLY,
+                        nullptr)
+        != SQLITE_OK) {
+      sqlite3_close(db);
+      return rows;
+    }
+    sqlite3_stmt* stmt = nullptr;
+    sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      const auto count = sqlite3_column_count(stmt) > 3 ? sqlite3_column_int(stmt, 3) : 1;
+      rows.emplace_back(sqlite3_column_int(stmt, 0), sqlite3_column_int(stmt, 1),
+                        sqlite3_column_int(stmt, 2), count);
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    return rows;
+  }
+
+  [[nodiscard]] std::vector<Row> read_movement() const {
+    return read(
+        "SELECT days_elapsed, source, destination, count FROM movement "
+        "ORDER BY days_elapsed, source, destination;");
+  }
+
+  std::filesystem::path output_;
+  std::unique_ptr<MovementReporter> reporter_;
+};
+
+TEST_F(MovementReporterTest, CountsTripsByOriginAndDestination) {
+  auto* population = Model::get_population();
+  ASSERT_EQ(population->get_movement_reporter(), reporter_.get());
+
+  population->notify_movement(0, 1);
+  population->notify_movement(1, 0);
+  population->notify_movement(0, 1);
+  population->notify_movement(1, 0);
+  population->notify_movement(0, 1);
+
+  const auto &counts = reporter_->get_od_counts();
+  ASSERT_EQ(counts.size(), 2);
+  EXPECT_EQ(counts.at(MovementReporter::make_key(0, 1)), 3);
+  EXPECT_EQ(counts.at(MovementReporter::make_key(1, 0)), 2);
+  EXPECT_EQ(MovementReporter::source_of(MovementReporter::make_key(1, 0)), 1);
+  EXPECT_EQ(MovementReporter::destination_of(MovementReporter::make_key(1, 0)), 0);
+}
+
+TEST_F(MovementReporterTest, MonthlyReportFlushesAndResetsTheCounts) {
+  auto* population = Model::get_population();
+  const auto today = Model::get_scheduler()->current_time();
+  population->notify_movement(0, 1);
+  population->notify_movement(0, 1);
+  population->notify_movement(1, 0);
+
+  reporter_->monthly_report();
+  EXPECT_TRUE(reporter_->get_od_counts().empty());
+  EXPECT_EQ(read_movement(), (std::vector<Row>{{today, 0, 1, 2}, {today, 1, 0, 1}}));
+
+  // The next month starts from zero and nothing is written twice
+  Model::get_scheduler()->set_current_time(today + 30);
+  reporter_->monthly_report();
+  population->notify_movement(1, 0);
+  reporter_->monthly_report();
+  EXPECT_EQ(read_movement(),
+            (std::vector<Row>{{today, 0, 1, 2}, {today, 1, 0, 1}, {today + 30, 1, 0, 1}}));
+  Model::get_scheduler()->set_current_time(today);
+}
+
+TEST_F(MovementReporterTest, DistrictLevelAggregatesTheCells) {
+  ASSERT_TRUE(Model::get_spatial_data()->has_admin_level("district"));
+  reporter_->set_level(MovementReporter::Level::DISTRICT);
+  const auto district_of = [](int loc) {
+    return Model::get_spatial_data()->get_admin_unit("district", loc);
+  };
+  const auto today = Model::get_scheduler()->current_time();
+
+  auto* population = Model::get_population();
+  population->notify_movement(0, 1);
+  population->notify_movement(0, 1);
+  population->notify_movement(1, 0);
+  reporter_->monthly_report();
+
+  std::vector<Row> expected{{today, district_of(0), district_of(1), 2},
+                            {today, district_of(1), district_of(0), 1}};
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(read_movement(), expected);
+}
+
+TEST_F(MovementReporterTest, IndividualLevelKeepsEveryTrip) {
+  reporter_->set_level(MovementReporter::Level::INDIVIDUAL);
+  const auto today = Model::get_scheduler()->current_time();
+
+  Model::get_population()->notify_movement(0, 1);
+  Model::get_population()->notify_movement(1, 0);
+  EXPECT_TRUE(reporter_->get_od_counts().empty());
+  reporter_->monthly_report();
+
+  EXPECT_EQ(read("SELECT days_elapsed, source, destination FROM trip ORDER BY rowid;"),
+            (std::vector<Row>{{today, 0, 1, 1}, {today, 1, 0, 1}}));
+  EXPECT_TRUE(read_movement().empty());
+}
+
+TEST_F(MovementReporterTest, DestructionUnhooksFromThePopulation) {
+  auto* population = Model::get_population();
+  ASSERT_EQ(population->get_movement_reporter(), reporter_.get());
+
+  reporter_.reset();
+  EXPECT_EQ(population->get_movement_reporter(), nullptr);
+
+  // Trips after the reporter is gone are not recorded anywhere
+  population->notify_movement(0, 1);
+  population->notify_movement(1, 0);
+
+  // A reporter that is not the hooked one leaves the hook alone
+  MovementReporter hooked;
+  hooked.initialize(1, output_.string() + "/");
+  {
+    MovementReporter other;
+    other.initialize(2, output_.string() + "/");
+    population->set_movement_reporter(&hooked);
+  }
+  EXPECT_EQ(population->get_movement_reporter(), &hooked);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <filesystem>
+#include <set>
+
+#include "Spatial/GIS/AscFile.h"
+#include "scenario_generator/ScenarioGenerator.h"
+
+class ScenarioGeneratorTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    output_ = std::filesystem::temp_directory_path() / "malasim_scenario_test";
+    settings_.rows = 20;
+    settings_.cols = 30;
+    settings_.persons_per_cell = 50;
+    settings_.number_of_districts = 7;
+    settings_.number_of_ecozones = 3;
+    settings_.template_input = "../../sample_inputs/input.yml";
+    settings_.output_directory = output_.string();
+  }
+
+  void TearDown() override { std::filesystem::remove_all(output_); }
+
+  std::filesystem::path output_;
+  ScenarioSettings settings_;
+};
+
+TEST_F(ScenarioGeneratorTest, EveryDistrictIsUsed) {
+  const ScenarioGenerator generator(settings_);
+  std::set<int> districts;
+  for (auto row = 0; row < settings_.rows; row++) {
+    for (auto col = 0; col < settings_.cols; col++) {
+      districts.insert(generator.district_of(row, col));
+    }
+  }
+  EXPECT_EQ(districts.size(), 7);
+  EXPECT_EQ(*districts.begin(), 1);
+  EXPECT_EQ(*districts.rbegin(), 7);
+}
+
+TEST_F(ScenarioGeneratorTest, RejectsMoreDistrictsThanCells) {
+  settings_.number_of_districts = settings_.rows * settings_.cols + 1;
+  EXPECT_THROW(ScenarioGenerator generator(settings_), std::invalid_argument);
+}
+
+TEST_F(ScenarioGeneratorTest, WritesConsistentRastersAndInput) {
+  ScenarioGenerator generator(settings_);
+  const auto input_path = generator.generate();
+
+  auto total_population = 0.0;
+  for (const auto value : generator.get_population()->data.values()) {
+    EXPECT_GE(value, 1);
+    total_population += value;
+  }
+  EXPECT_NEAR(total_population, 50.0 * 20 * 30, 0.05 * 50 * 20 * 30);
+
+  const auto population = AscFileManager::read((output_ / "population.asc").string());
+  EXPECT_TRUE(AscFileManager::check_asc_file(population.get()).empty());
+  EXPECT_EQ(population->nrows, 20);
+  EXPECT_EQ(population->ncols, 30);
+
+  const auto input = YAML::LoadFile(input_path);
+  EXPECT_EQ(input["spatial_settings"]["mode"].as<std::string>(), "grid_based");
+  const auto grid = input["spatial_settings"]["grid_based"];
+  EXPECT_TRUE(std::filesystem::exists(grid["beta_raster"].as<std::string>()));
+  EXPECT_TRUE(std::filesystem::exists(
+      grid["administrative_boundaries"][0]["raster"].as<std::string>()));
+  EXPECT_EQ(input["seasonality_settings"]["equation"]["phi"].size(), 3);
+}
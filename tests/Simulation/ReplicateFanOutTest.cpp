@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <set>
+#include <stdexcept>
+
+#include "Simulation/ReplicateFanOut.h"
+#include "Utils/Logger.h"
+
+class ReplicateFanOutTest : public ::testing::Test {
+protected:
+  void SetUp() override { log_level_ = spdlog::get_level(); }
+
+  // Forking replaces the default logger, give the other tests a fresh one
+  void TearDown() override {
+    Logger::shutdown();
+    Logger::initialize(log_level_);
+  }
+
+private:
+  spdlog::level::level_enum log_level_{spdlog::level::info};
+};
+
+TEST_F(ReplicateFanOutTest, EveryReplicateRunsOnce) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+
+  const auto replicate = ReplicateFanOut(3).fork_replicates();
+  if (replicate != ReplicateFanOut::PARENT) {
+    // Replicates report their index and leave without running the other tests
+    ::close(fds[0]);
+    const auto written = ::write(fds[1], &replicate, sizeof(replicate));
+    ::_exit(written == sizeof(replicate) ? 0 : 1);
+  }
+  ::close(fds[1]);
+
+  std::set<int> replicates;
+  int value = 0;
+  while (::read(fds[0], &value, sizeof(value)) == sizeof(value)) { replicates.insert(value); }
+  ::close(fds[0]);
+  EXPECT_EQ(replicates, (std::set<int>{0, 1, 2}));
+}
+
+TEST_F(ReplicateFanOutTest, FailedReplicateThrows) {
+  auto run = [] {
+    const auto replicate = ReplicateFanOut(2).fork_replicates();
+    if (replicate != ReplicateFanOut::PARENT) { ::_exit(replicate == 1 ? 1 : 0); }
+  };
+  EXPECT_THROW(run(), std::runtime_error);
+  EXPECT_THROW(ReplicateFanOut(0), std::invalid_argument);
+}
+
+TEST_F(ReplicateFanOutTest, ConsecutiveJobsGetDistinctJobNumbers) {
+  const ReplicateFanOut fan_out(3);
+  std::set<int> job_numbers;
+  for (auto job = 0; job < 4; job++) {
+    for (auto replicate = 0; replicate < fan_out.number_of_replicates(); replicate++) {
+      job_numbers.insert(fan_out.job_number(job, replicate));
+    }
+  }
+  EXPECT_EQ(job_numbers.size(), 12);
+  EXPECT_EQ(*job_numbers.begin(), 0);
+  EXPECT_EQ(*job_numbers.rbegin(), 11);
+}
+
+TEST_F(ReplicateFanOutTest, ConsecutiveSeedsGetDistinctReplicateSeeds) {
+  // seed + replicate + 1 would give seed 1 replicate 0 the stream of seed 0 replicate 1
+  std::set<uint64_t> seeds;
+  for (uint64_t seed = 0; seed < 8; seed++) {
+    seeds.insert(seed);
+    for (auto replicate = 0; replicate < 8; replicate++) {
+      seeds.insert(ReplicateFanOut::seed(seed, replicate));
+    }
+  }
+  EXPECT_EQ(seeds.size(), 8 + 8 * 8);
+  EXPECT_EQ(ReplicateFanOut::seed(42, 3), ReplicateFanOut::seed(42, 3));
+}
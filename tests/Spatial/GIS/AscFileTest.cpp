@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "Spatial/GIS/AscFile.h"
+
+class AscFileTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    directory_ = std::filesystem::temp_directory_path() / "malasim_asc_file_test";
+    std::filesystem::create_directories(directory_);
+    AscFileManager::set_cache_directory((directory_ / "cache").string());
+  }
+
+  void TearDown() override {
+    AscFileManager::set_cache_directory("");
+    std::filesystem::remove_all(directory_);
+  }
+
+  // Write a raster of the given size where each cell holds row * 0.5 + col
+  std::string write_raster(const std::string &name, int nrows, int ncols) {
+    AscFile file;
+    file.nrows = nrows;
+    file.ncols = ncols;
+    file.xllcorner = 0;
+    file.yllcorner = 0;
+    file.cellsize = 5000;
+    file.nodata_value = -9999;
+    file.data.assign(nrows, ncols);
+    for (auto row = 0; row < nrows; row++) {
+      for (auto col = 0; col < ncols; col++) {
+        file.data[row][col] = static_cast<float>((row * 0.5) + col);
+      }
+    }
+    const auto path = (directory_ / name).string();
+    AscFileManager::write(&file, path);
+    return path;
+  }
+
+  std::filesystem::path directory_;
+};
+
+TEST_F(AscFileTest, ReadsWhatWasWritten) {
+  const auto path = write_raster("small.asc", 3, 4);
+  const auto file = AscFileManager::read(path);
+
+  EXPECT_EQ(file->nrows, 3);
+  EXPECT_EQ(file->ncols, 4);
+  EXPECT_DOUBLE_EQ(file->cellsize, 5000);
+  EXPECT_DOUBLE_EQ(file->nodata_value, -9999);
+  EXPECT_FLOAT_EQ(file->data[2][3], 4.0F);
+  EXPECT_EQ(file->data.values().size(), 12U);
+
+  // Small rasters are not cached
+  EXPECT_FALSE(std::filesystem::exists(AscFileManager::get_cache_path(path)));
+}
+
+TEST_F(AscFileTest, ThrowsOnTruncatedData) {
+  const auto path = (directory_ / "truncated.asc").string();
+  std::ofstream out(path);
+  out << "ncols 3\nnrows 2\nxllcorner 0\nyllcorner 0\ncellsize 1\nNODATA_value -9999\n";
+  out << "1 2 3\n4 5\n";
+  out.close();
+
+  EXPECT_THROW(AscFileManager::read(path), std::runtime_error);
+}
+
+TEST_F(AscFileTest, LargeRasterIsLoadedFromCache) {
+  const auto path = write_raster("large.asc", 300, 250);
+  const auto cache = AscFileManager::get_cache_path(path);
+  EXPECT_EQ(std::filesystem::path(cache).parent_path(), directory_ / "cache");
+
+  const auto parsed = AscFileManager::read(path);
+  ASSERT_TRUE(std::filesystem::exists(cache));
+  EXPECT_FALSE(parsed->data.is_mapped());
+
+  const auto cached = AscFileManager::read(path);
+  EXPECT_EQ(cached->nrows, 300);
+  EXPECT_EQ(cached->ncols, 250);
+  EXPECT_DOUBLE_EQ(cached->nodata_value, -9999);
+  for (auto row = 0; row < 300; row += 37) {
+    for (auto col = 0; col < 250; col += 41) {
+      EXPECT_FLOAT_EQ(cached->data[row][col], parsed->data[row][col]);
+    }
+  }
+
+  // Copies own their values
+  auto copy = *cached;
+  copy.data[0][0] = 42;
+  EXPECT_FLOAT_EQ(cached->data[0][0], 0.0F);
+}
+
+TEST_F(AscFileTest, RewritingTheRasterDropsTheCache) {
+  const auto path = write_raster("rewritten.asc", 300, 250);
+  AscFileManager::read(path);
+  ASSERT_TRUE(std::filesystem::exists(AscFileManager::get_cache_path(path)));
+
+  write_raster("rewritten.asc", 260, 260);
+  EXPECT_FALSE(std::filesystem::exists(AscFileManager::get_cache_path(path)));
+
+  const auto file = AscFileManager::read(path);
+  EXPECT_EQ(file->nrows, 260);
+  EXPECT_FLOAT_EQ(file->data[259][259], 388.5F);
+}
+
+TEST_F(AscFileTest, StaleCacheIsIgnored) {
+  const auto path = write_raster("stale.asc", 300, 250);
+  AscFileManager::read(path);
+
+  // Change the raster without going through AscFileManager
+  const auto cache = AscFileManager::get_cache_path(path);
+  AscFileManager::set_cache_directory("");
+  auto file = AscFileManager::read(path);
+  AscFileManager::set_cache_directory((directory_ / "cache").string());
+  file->data[0][0] = 7;
+  std::filesystem::rename(cache, cache + ".keep");
+  const auto modified = std::filesystem::last_write_time(path);
+  AscFileManager::write(file.get(), path);
+  // Same size, make sure the time differs on coarse file systems too
+  std::filesystem::last_write_time(path, modified + std::chrono::seconds(1));
+  std::filesystem::rename(cache + ".keep", cache);
+
+  EXPECT_FLOAT_EQ(AscFileManager::read(path)->data[0][0], 7.0F);
+}
+
+TEST_F(AscFileTest, NothingIsCachedWithoutACacheDirectory) {
+  AscFileManager::set_cache_directory("");
+  const auto path = write_raster("uncached.asc", 300, 250);
+  AscFileManager::read(path);
+
+  EXPECT_TRUE(AscFileManager::get_cache_path(path).empty());
+  EXPECT_FALSE(std::filesystem::exists(directory_ / "cache"));
+  EXPECT_FALSE(std::filesystem::exists(path + AscFileManager::CACHE_EXTENSION));
+}
+
+TEST_F(AscFileTest, UnwritableCacheStillReadsTheRaster) {
+  // A regular file where the cache directory should be
+  const auto blocked = directory_ / "blocked";
+  std::ofstream(blocked) << "not a directory";
+  AscFileManager::set_cache_directory(blocked.string());
+
+  const auto path = write_raster("blocked.asc", 300, 250);
+  const auto file = AscFileManager::read(path);
+  EXPECT_EQ(file->nrows, 300);
+  EXPECT_FLOAT_EQ(file->data[299][249], 398.5F);
+  EXPECT_FALSE(std::filesystem::exists(AscFileManager::get_cache_path(path)));
+}
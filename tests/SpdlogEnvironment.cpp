@@ -10,7 +10,7 @@ class SpdlogEnvironment : public ::testing::Environment {
 public:
   void SetUp() override { Logger::instance().initialize(spdlog::level::info); }
 
-  void TearDown() override { spdlog::shutdown(); }
+  void TearDown() override { Logger::shutdown(); }
 };
 
 // Register the test environment Gtest will take the ownership of the environment
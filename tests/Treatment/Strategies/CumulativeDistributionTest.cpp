@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Treatment/Strategies/CumulativeDistribution.h"
+
+// Index a linear scan of the weights selects, or the size when none matches
+static std::size_t linear_scan(const std::vector<double> &weights, double p) {
+  double sum = 0;
+  for (std::size_t i = 0; i < weights.size(); i++) {
+    sum += weights[i];
+    if (p <= sum) { return i; }
+  }
+  return weights.size();
+}
+
+TEST(CumulativeDistributionTest, SelectsLikeLinearScan) {
+  const std::vector<double> weights{0.1, 0.2, 0.0, 0.3, 0.4};
+  CumulativeDistribution cumulative;
+  cumulative.build(weights);
+  ASSERT_EQ(cumulative.size(), weights.size());
+
+  for (auto p : {0.0, 0.05, 0.1, 0.3, 0.30000001, 0.6, 0.99, 1.0}) {
+    EXPECT_EQ(cumulative.select(p), linear_scan(weights, p)) << "p = " << p;
+  }
+}
+
+TEST(CumulativeDistributionTest, ReturnsSizeWhenTotalIsExceeded) {
+  CumulativeDistribution cumulative;
+  cumulative.build(std::vector<double>{0.3, 0.3});
+  EXPECT_EQ(cumulative.select(0.9), 2U);
+
+  CumulativeDistribution empty;
+  empty.build(std::vector<double>{});
+  EXPECT_EQ(empty.select(0.5), 0U);
+}
+
+TEST(CumulativeDistributionTest, RebuildsWhenWeightsChange) {
+  std::vector<double> weights{0.5, 0.5};
+  CumulativeDistribution cumulative;
+  cumulative.build(weights);
+  EXPECT_EQ(cumulative.select(0.4), 0U);
+
+  weights = {0.2, 0.8};
+  cumulative.build(weights);
+  EXPECT_EQ(cumulative.select(0.4), 1U);
+}
+
+TEST(CumulativeDistributionTest, NegativeWeightsFallBackToScan) {
+  const std::vector<double> weights{0.6, -0.2, 0.6};
+  CumulativeDistribution cumulative;
+  cumulative.build(weights);
+  for (auto p : {0.3, 0.5, 0.7, 1.0}) {
+    EXPECT_EQ(cumulative.select(p), linear_scan(weights, p)) << "p = " << p;
+  }
+}
+
+TEST(CumulativeDistributionTest, FloatWeightsAccumulateInDouble) {
+  const std::vector<float> weights{0.7F, 0.3F};
+  CumulativeDistribution cumulative;
+  cumulative.build(weights);
+  EXPECT_EQ(cumulative.select(static_cast<double>(0.7F)), 0U);
+  EXPECT_EQ(cumulative.select(1.0), 1U);
+}
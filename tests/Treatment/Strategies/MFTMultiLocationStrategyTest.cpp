@@ -52,6 +52,7 @@ protected:
     
     // Current distributions (initially same as start)
     strategy->distribution = start_dist;
+    strategy->rebuild_cumulative_distribution();
     
     // Timing parameters
     strategy->starting_time = 0;
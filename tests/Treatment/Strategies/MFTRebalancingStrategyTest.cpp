@@ -108,6 +108,7 @@ TEST_F(MFTRebalancingStrategyTest, GetTherapy) {
   
   // Set distribution
   strategy->distribution = {0.6, 0.4};
+  strategy->rebuild_cumulative_distribution();
   
   // Test that the therapy selection follows the parent MFTStrategy behavior
   Therapy* selected_therapy = strategy->get_therapy(person.get());
@@ -94,6 +94,7 @@ TEST_F(MFTStrategyTest, GetTherapyDistribution) {
   
   // Set distribution
   strategy->distribution = {0.2, 0.3, 0.5};
+  strategy->rebuild_cumulative_distribution();
   
   // With fixed random seed, we could test exact distribution
   // For now, we'll just test that it returns a valid therapy
@@ -53,6 +53,7 @@ protected:
     mft_strategy->add_therapy(therapies[1]);
     mft_strategy->add_therapy(therapies[2]);
     mft_strategy->distribution = {0.4, 0.6};
+    mft_strategy->rebuild_cumulative_distribution();
     
     // Create test persons at different locations
     person_loc0 = std::make_unique<Person>();
@@ -80,6 +81,7 @@ protected:
     nested_strategy->start_distribution = start_dist;
     nested_strategy->peak_distribution = peak_dist;
     nested_strategy->distribution = current_dist;
+    nested_strategy->rebuild_cumulative_distribution();
   }
 
   void TearDown() override {
@@ -325,6 +327,7 @@ TEST_F(NestedMFTMultiLocationStrategyTest, GetTherapyWithUpdatedDistribution) {
   // Update distribution to be halfway between start and peak
   nested_strategy->distribution[0] = {0.5, 0.5}; // Location 0
   nested_strategy->distribution[1] = {0.4, 0.6}; // Location 1
+  nested_strategy->rebuild_cumulative_distribution();
   
   // Test therapy selection for location 0 with updated distribution
   const int iterations = 10000;
@@ -52,6 +52,7 @@ protected:
     mft_strategy->add_therapy(therapies[1]);
     mft_strategy->add_therapy(therapies[2]);
     mft_strategy->distribution = {0.4, 0.6};
+    mft_strategy->rebuild_cumulative_distribution();
     
     // Create test person
     person = std::make_unique<Person>();
@@ -60,6 +61,7 @@ protected:
     nested_strategy->start_distribution = {0.7, 0.3};    // Start: 70% SFT, 30% MFT
     nested_strategy->peak_distribution = {0.3, 0.7};     // Peak: 30% SFT, 70% MFT
     nested_strategy->distribution = {0.7, 0.3};         // Initial: same as start
+    nested_strategy->rebuild_cumulative_distribution();
   }
 
   void TearDown() override {
@@ -238,6 +240,7 @@ TEST_F(NestedMFTStrategyTest, GetTherapyWithUpdatedDistribution) {
   
   // Update distribution to be 50-50
   nested_strategy->distribution = {0.5, 0.5};
+  nested_strategy->rebuild_cumulative_distribution();
   
   // Test that the therapy selection follows the updated distribution
   const int iterations = 10000;
@@ -263,6 +266,7 @@ TEST_F(NestedMFTStrategyTest, GetTherapyWithFinalDistribution) {
   
   // Update distribution to final state
   nested_strategy->distribution = nested_strategy->peak_distribution;
+  nested_strategy->rebuild_cumulative_distribution();
   
   // Test that the therapy selection follows the peak distribution
   const int iterations = 10000;
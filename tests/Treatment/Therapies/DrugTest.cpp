@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 
+#include "Parasites/Genotype.h"
 #include "Treatment/Therapies/Drug.h"
 #include "Treatment/Therapies/DrugType.h"
 #include "Population/DrugsInBlood.h"
@@ -183,3 +184,16 @@ TEST_F(DrugTest, GetParasiteKillingRate) {
   // This relies on the existence of proper genotype in the DB - if this fails, might need to set up mock
   EXPECT_NO_THROW(drug->get_parasite_killing_rate(genotype_id));
 }
+
+TEST_F(DrugTest, GetParasiteKillingRateFollowsConcentration) {
+  Genotype genotype("||||YF1||TTHFIMG,x||||||FNCMYRIPRPCRA|1");
+  const double EC50_power_n = std::pow(0.5, drug_type->n());
+  genotype.EC50_power_n.assign(drug_type->id() + 1, EC50_power_n);
+
+  for (const auto concentration : {0.8, 1.2, 0.0, 1.2}) {
+    drug->set_last_update_value(concentration);
+    EXPECT_DOUBLE_EQ(drug->get_parasite_killing_rate(&genotype),
+                     drug_type->get_parasite_killing_rate_by_concentration(concentration,
+                                                                           EC50_power_n));
+  }
+}
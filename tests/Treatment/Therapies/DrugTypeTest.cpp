@@ -118,3 +118,17 @@ TEST_F(DrugTypeTest, PopulateResistantAALocations) {
   // We're just checking that the function doesn't crash and that resistant locations
   // might be populated depending on the configuration
 }
+
+TEST_F(DrugTypeTest, DecayFactorFollowsHalfLife) {
+  drug_type->set_drug_half_life(2.0);
+  EXPECT_DOUBLE_EQ(drug_type->get_decay_factor(0), 1.0);
+  for (auto days = 1; days <= 6; days++) {
+    EXPECT_EQ(drug_type->get_decay_factor(days), std::exp(-days * std::log(2) / 2.0));
+  }
+  // 2^(-7/2) is below the 10% cut off
+  EXPECT_EQ(drug_type->get_decay_factor(7), 0.0);
+  EXPECT_EQ(drug_type->get_decay_factor(100), 0.0);
+
+  drug_type->set_drug_half_life(0.0);
+  EXPECT_EQ(drug_type->get_decay_factor(1), 0.0);
+}
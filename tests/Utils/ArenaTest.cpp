@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "Utils/Arena.h"
+
+namespace {
+struct Allocated {
+  ARENA_ALLOCATED(Allocated)
+public:
+  Allocated() = default;
+  explicit Allocated(int value) : value(value) {}
+  virtual ~Allocated() = default;
+
+  int value{0};
+  double payload[3]{};
+};
+
+struct LargerDerived : Allocated {
+  double extra[8]{};
+};
+}  // namespace
+
+TEST(ArenaTest, SlotsAreAlignedAndHoldAFreeListPointer) {
+  utils::Arena arena(3, 1);
+  EXPECT_EQ(arena.slot_size(), sizeof(void*));
+
+  utils::Arena aligned(24, 16);
+  EXPECT_EQ(aligned.slot_size(), 32U);
+  for (auto i = 0; i < 10; i++) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned.allocate()) % 16, 0U);
+  }
+
+  EXPECT_THROW(utils::Arena(0, 8), std::invalid_argument);
+  EXPECT_THROW(utils::Arena(8, 3), std::invalid_argument);
+}
+
+TEST(ArenaTest, FreedSlotsAreReused) {
+  utils::Arena arena(64, 8);
+  auto* first = arena.allocate();
+  auto* second = arena.allocate();
+  EXPECT_NE(first, second);
+  EXPECT_EQ(arena.live_slots(), 2U);
+
+  arena.deallocate(first);
+  EXPECT_EQ(arena.live_slots(), 1U);
+  EXPECT_EQ(arena.allocate(), first);
+  EXPECT_EQ(arena.reserved_bytes(), utils::Arena::INITIAL_REGION_SIZE);
+}
+
+TEST(ArenaTest, GrowsWhenTheRegionIsFull) {
+  utils::Arena arena(1024, 8);
+  const auto per_region = utils::Arena::INITIAL_REGION_SIZE / 1024;
+  std::set<void*> slots;
+  for (std::size_t i = 0; i < per_region + 1; i++) { slots.insert(arena.allocate()); }
+
+  EXPECT_EQ(slots.size(), per_region + 1);
+  EXPECT_EQ(arena.reserved_bytes(), 3 * utils::Arena::INITIAL_REGION_SIZE);
+}
+
+TEST(ArenaTest, ClassesAllocateFromTheirArena) {
+  const auto live = Allocated::arena().live_slots();
+  {
+    std::vector<std::unique_ptr<Allocated>> objects;
+    for (auto i = 0; i < 100; i++) { objects.push_back(std::make_unique<Allocated>(i)); }
+    EXPECT_EQ(Allocated::arena().live_slots(), live + 100);
+    EXPECT_EQ(objects[42]->value, 42);
+
+    // Derived classes of another size use the global allocator
+    std::unique_ptr<Allocated> derived = std::make_unique<LargerDerived>();
+    EXPECT_EQ(Allocated::arena().live_slots(), live + 100);
+  }
+  EXPECT_EQ(Allocated::arena().live_slots(), live);
+}
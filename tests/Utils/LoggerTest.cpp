@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <spdlog/async.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+
+#include "Utils/Logger.h"
+
+TEST(LoggerTest, DefaultLoggerIsAsynchronous) {
+  auto logger = spdlog::default_logger();
+  ASSERT_NE(logger, nullptr);
+  EXPECT_EQ(logger->name(), "default_logger");
+  EXPECT_NE(std::dynamic_pointer_cast<spdlog::async_logger>(logger), nullptr);
+}
+
+TEST(LoggerTest, HotLoggingSkipsArgumentsBelowLevel) {
+  const auto level = spdlog::get_level();
+  spdlog::set_level(spdlog::level::info);
+
+  auto evaluations = 0;
+  auto count = [&evaluations]() { return ++evaluations; };
+  MALASIM_LOG_HOT_TRACE("count {}", count());
+  MALASIM_LOG_HOT_DEBUG("count {}", count());
+  EXPECT_EQ(evaluations, 0);
+
+  spdlog::set_level(level);
+}
+
+TEST(LoggerTest, FullQueueKeepsEveryMessage) {
+  const auto level = spdlog::get_level();
+  Logger::initialize(spdlog::level::info, 4);
+  auto logger = spdlog::default_logger();
+  logger->sinks() = {std::make_shared<spdlog::sinks::null_sink_mt>()};
+
+  for (auto i = 0; i < 1000; i++) { spdlog::info("message {}", i); }
+  EXPECT_EQ(spdlog::thread_pool()->overrun_counter(), 0);
+
+  Logger::initialize(level);
+}
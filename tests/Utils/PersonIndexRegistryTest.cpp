@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "Utils/Index/PersonIndexRegistry.h"
+
+namespace {
+struct LocationIndex {
+  static constexpr bool tracks(const Person::Property &property) {
+    return property == Person::LOCATION;
+  }
+  void add(Person* /*person*/) { added++; }
+  void remove(Person* /*person*/) { removed++; }
+  void notify_change(Person* /*person*/, const Person::Property & /*property*/,
+                     const void* /*old_value*/, const void* /*new_value*/) {
+    changed++;
+  }
+  int added{0};
+  int removed{0};
+  int changed{0};
+};
+
+struct LocationAndAgeIndex : LocationIndex {
+  static constexpr bool tracks(const Person::Property &property) {
+    return property == Person::LOCATION || property == Person::AGE;
+  }
+};
+
+using Registry = PersonIndexRegistry<LocationIndex, LocationAndAgeIndex>;
+}  // namespace
+
+TEST(PersonIndexRegistryTest, ContainsOnlyRegisteredIndexes) {
+  EXPECT_TRUE(Registry::contains<LocationIndex>);
+  EXPECT_TRUE(Registry::contains<LocationAndAgeIndex>);
+  EXPECT_FALSE(Registry::contains<int>);
+}
+
+TEST(PersonIndexRegistryTest, AddAndRemoveReachEveryIndex) {
+  Registry registry;
+  registry.add(nullptr);
+  registry.add(nullptr);
+  registry.remove(nullptr);
+
+  EXPECT_EQ(registry.get<LocationIndex>().added, 2);
+  EXPECT_EQ(registry.get<LocationIndex>().removed, 1);
+  EXPECT_EQ(registry.get<LocationAndAgeIndex>().added, 2);
+  EXPECT_EQ(registry.get<LocationAndAgeIndex>().removed, 1);
+}
+
+TEST(PersonIndexRegistryTest, ChangesOnlyReachIndexesTrackingTheProperty) {
+  Registry registry;
+  registry.notify_change(nullptr, Person::LOCATION, nullptr, nullptr);
+  registry.notify_change(nullptr, Person::AGE, nullptr, nullptr);
+  registry.notify_change(nullptr, Person::HOST_STATE, nullptr, nullptr);
+
+  EXPECT_EQ(registry.get<LocationIndex>().changed, 1);
+  EXPECT_EQ(registry.get<LocationAndAgeIndex>().changed, 2);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Utils/Profiler.h"
+
+class ProfilerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    utils::Profiler::get_instance().reset();
+    utils::Profiler::get_instance().set_enabled(true);
+    utils::Profiler::get_instance().set_trace_path("");
+  }
+
+  void TearDown() override {
+    utils::Profiler::get_instance().set_enabled(false);
+    utils::Profiler::get_instance().set_trace_path("");
+    utils::Profiler::get_instance().reset();
+  }
+};
+
+TEST_F(ProfilerTest, RegisterStageIsIdempotent) {
+  auto &profiler = utils::Profiler::get_instance();
+  const auto first = profiler.register_stage("ProfilerTest::stage_a");
+  const auto second = profiler.register_stage("ProfilerTest::stage_a");
+  const auto other = profiler.register_stage("ProfilerTest::stage_b");
+
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, other);
+}
+
+TEST_F(ProfilerTest, RecordAccumulatesTimeAndCalls) {
+  auto &profiler = utils::Profiler::get_instance();
+  const auto id = profiler.register_stage("ProfilerTest::accumulate");
+
+  const auto start = utils::Profiler::Clock::now();
+  profiler.record(id, start, start + std::chrono::microseconds(10));
+  profiler.record(id, start, start + std::chrono::microseconds(30));
+
+  const auto &stage = profiler.get_stages()[id];
+  EXPECT_EQ(stage.calls, 2);
+  EXPECT_EQ(stage.total_ns, 40000);
+  EXPECT_EQ(stage.max_ns, 30000);
+  EXPECT_TRUE(profiler.get_trace().empty());
+}
+
+TEST_F(ProfilerTest, ScopedTimerDoesNothingWhenDisabled) {
+  auto &profiler = utils::Profiler::get_instance();
+  const auto id = profiler.register_stage("ProfilerTest::disabled");
+  profiler.set_enabled(false);
+  { const utils::ScopedTimer timer(id); }
+
+  EXPECT_EQ(profiler.get_stages()[id].calls, 0);
+}
+
+TEST_F(ProfilerTest, ScopedTimerRecordsWhenEnabled) {
+  auto &profiler = utils::Profiler::get_instance();
+  const auto id = profiler.register_stage("ProfilerTest::enabled");
+  { const utils::ScopedTimer timer(id); }
+
+  EXPECT_EQ(profiler.get_stages()[id].calls, 1);
+}
+
+TEST_F(ProfilerTest, WritesCsvTraceWithDay) {
+  auto &profiler = utils::Profiler::get_instance();
+  const auto path = (std::filesystem::temp_directory_path() / "malasim_profiler_test.csv").string();
+  profiler.set_trace_path(path);
+  const auto id = profiler.register_stage("ProfilerTest::trace");
+
+  profiler.set_current_day(7);
+  const auto start = utils::Profiler::Clock::now();
+  profiler.record(id, start, start + std::chrono::nanoseconds(500));
+  ASSERT_EQ(profiler.get_trace().size(), 1);
+  EXPECT_EQ(profiler.get_trace()[0].day, 7);
+
+  profiler.write_trace();
+
+  std::ifstream in(path);
+  std::stringstream content;
+  content << in.rdbuf();
+  EXPECT_NE(content.str().find("day,stage,start_ns,duration_ns"), std::string::npos);
+  EXPECT_NE(content.str().find("7,ProfilerTest::trace,"), std::string::npos);
+  std::filesystem::remove(path);
+}